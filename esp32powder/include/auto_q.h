@@ -0,0 +1,147 @@
+#ifndef AUTO_Q_H
+#define AUTO_Q_H
+
+// Inventory Q (2^Q slots per round) tuned on distinct tags read per window,
+// as the R200 reports neither slots nor collisions. Q tracks round(log2(tags))
+// within AUTO_Q_CEILING, and periodic trial steps are kept only when the
+// second window after them reads more tags than the two before.
+
+#include <stdint.h>
+#include <string.h>
+
+#define AUTO_Q_WINDOW_MS 1000
+#define AUTO_Q_MAX 15
+#define AUTO_Q_PROBE_MAX 8     // 256 slots: an empty round is still well under 100 ms
+#define AUTO_Q_PROBE_EVERY 10  // windows
+#define AUTO_Q_PROBE_HOLD 30
+// 8x more slots than tags read is never worth it, and rounds that long
+// straddle several windows, which then no longer compare
+#define AUTO_Q_CEILING(tagQ) ((tagQ) + 3 < AUTO_Q_MAX ? (tagQ) + 3 : AUTO_Q_MAX)
+
+struct AutoQ {
+  uint32_t windowStart;
+  uint32_t reads;        // this window
+  uint32_t unique;
+  uint32_t emptyRounds;
+  uint32_t lastReads;    // the last finished window, for status
+  uint32_t lastUnique;
+  uint32_t lastEmptyRounds;
+  uint32_t prevUnique;   // the window before, at the same Q
+  int8_t probeFrom;      // Q before a trial step, -1 if none
+  uint32_t probeUnique;  // distinct tags read at probeFrom
+  bool probeSettling;    // first window of a trial, not judged
+  bool probeDownNext;    // direction of the next periodic trial
+  int8_t holdFrom;       // no trial from this Q ...
+  bool holdUp;           // ... in this direction ...
+  uint8_t holdWindows;   // ... for this many more windows
+  uint8_t steadyWindows; // since Q last changed
+  uint32_t changes;      // counted by the caller once the new Q is sent
+
+  void begin(uint32_t now) {
+    memset(this, 0, sizeof(*this));
+    restart(now);
+  }
+
+  // firstInWindow: the tag was not read since windowStart
+  void onRead(bool firstInWindow) {
+    reads++;
+    if (firstInWindow) unique++;
+  }
+
+  void onEmptyRound() { emptyRounds++; }
+
+  bool windowDone(uint32_t now) const { return now - windowStart >= AUTO_Q_WINDOW_MS; }
+
+  // Drop the window without a decision (not scanning, programming, Q set
+  // by hand, ...)
+  void restart(uint32_t now) {
+    reads = unique = emptyRounds = 0;
+    probeFrom = holdFrom = -1;
+    holdWindows = steadyWindows = 0;
+    windowStart = now;
+  }
+
+  // Close the window and return the Q to use from now on
+  uint8_t decide(uint8_t q, uint32_t now) {
+    prevUnique = steadyWindows > 0 ? lastUnique : 0;
+    lastReads = reads;
+    lastUnique = unique;
+    lastEmptyRounds = emptyRounds;
+    reads = unique = emptyRounds = 0;
+    windowStart = now;
+    if (holdWindows > 0 && --holdWindows == 0) holdFrom = -1;
+    if (steadyWindows < 255) steadyWindows++;
+    if (lastReads == 0 && lastEmptyRounds == 0) return q;  // the reader was not polling
+    if (probeFrom >= 0 && probeSettling) {
+      probeSettling = false;
+      return q;
+    }
+
+    // Nothing read: an empty field or a crowd that always collides
+    if (lastReads == 0) {
+      probeFrom = -1;
+      return step(q, q < AUTO_Q_PROBE_MAX ? q + 1 : q > AUTO_Q_PROBE_MAX ? q - 1 : q);
+    }
+
+    if (probeFrom >= 0) {
+      int8_t from = probeFrom;
+      probeFrom = -1;
+      bool up = q > from;
+      // a longer round has to earn its keep, a shorter one only not lose
+      bool kept = up ? lastUnique > probeUnique + probeUnique / 16 : lastUnique >= probeUnique;
+      if (!kept) {
+        hold(from, up);
+        return step(q, from);
+      }
+      if (!up) hold(q, true);  // do not climb straight back up
+    }
+
+    // About one slot per tag reads the most (framed ALOHA). Collisions make
+    // tagQ an undercount, so it is trusted downwards only when each tag was
+    // read several times.
+    uint8_t tagQ = 0;  // round(log2(tags)): up while tags > 2^(tagQ + 0.5)
+    while (tagQ < AUTO_Q_MAX && lastUnique * 100 > (141u << tagQ)) tagQ++;
+    if (tagQ > q) return step(q, tagQ);
+    if (tagQ + 2 <= q && lastReads > 2 * lastUnique) return step(q, tagQ + 1);
+    if (q > AUTO_Q_CEILING(tagQ)) return step(q, AUTO_Q_CEILING(tagQ));
+
+    // Each tag read about once a window: tags keep quiet (S1-S3) or most
+    // of the field is lost in collisions. Either way a step up is worth a try.
+    bool starved = steadyWindows >= 2 && (lastEmptyRounds > lastReads || lastReads < 2 * lastUnique);
+    bool due = steadyWindows >= AUTO_Q_PROBE_EVERY;
+    bool canUp = q < AUTO_Q_CEILING(tagQ) && !(holdFrom == (int8_t)q && holdUp);
+    bool canDown = tagQ < q && !(holdFrom == (int8_t)q && !holdUp);
+    if (canUp && starved) {
+      probeDownNext = true;
+      return trial(q, q + 1);
+    }
+    if (due) {
+      bool down = probeDownNext;
+      probeDownNext = !down;
+      if (down ? canDown : canUp) return trial(q, down ? q - 1 : q + 1);
+      steadyWindows = 0;
+    }
+    return q;
+  }
+
+private:
+  uint8_t step(uint8_t q, uint8_t next) {
+    if (next != q) steadyWindows = 0;
+    return next;
+  }
+
+  void hold(uint8_t q, bool up) {
+    holdFrom = (int8_t)q;
+    holdUp = up;
+    holdWindows = AUTO_Q_PROBE_HOLD;
+  }
+
+  uint8_t trial(uint8_t q, uint8_t next) {
+    probeFrom = q;
+    probeUnique = lastUnique > prevUnique ? lastUnique : prevUnique;  // rounds straddle windows
+    probeSettling = true;
+    return step(q, next);
+  }
+};
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+// Non-blocking R200 command queue. Frames go out one at a time, spaced by a
+// short gap. A command that expects a reply stays in flight until a response
+// frame with its command code (or an error frame) comes back, or until its
+// timeout passes, when it is resent while retries remain. Results reach the
+// caller through a handler called from poll()/onFrame() - nothing waits.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "r200_parser.h"
+
+#define R200_QUEUE_DEPTH 16
+#define R200_COMMAND_MAX_LEN 64
+#define R200_COMMAND_GAP_MS 20           // minimum spacing between frames to the module
+#define R200_COMMAND_TIMEOUT_MS 300
+#define R200_COMMAND_RETRIES 2
+#define R200_ERROR_INVENTORY_FAIL 0x15   // "no tag answered" - a polling result, not a failure
+
+enum R200CommandStatus {
+  R200_COMMAND_OK,           // response frame received (or sent, when no reply is expected)
+  R200_COMMAND_ERROR_REPLY,  // module answered with an error frame
+  R200_COMMAND_TIMEOUT       // no answer after all retries
+};
+
+// reply is only valid during the call and is nullptr on timeout and for
+// commands that expect no reply
+typedef void (*R200ReplyHandler)(uint8_t command, R200CommandStatus status, const R200Frame* reply);
+
+struct R200QueueStats {
+  uint32_t sent;      // frames written, retries included
+  uint32_t replies;
+  uint32_t errors;
+  uint32_t retries;
+  uint32_t timeouts;
+  uint32_t rejected;  // queue full
+};
+
+class R200CommandQueue {
+public:
+  R200CommandQueue() : port(nullptr), head(0), count(0), inFlight(false), sentAt(0), lastSend(0) {
+    memset(&stats, 0, sizeof(stats));
+  }
+
+  void begin(ReaderPort* readerPort) {
+    port = readerPort;
+    clear();
+  }
+
+  // false when the queue is full or the frame too long
+  bool enqueue(const uint8_t* frame, size_t len, bool expectsReply, R200ReplyHandler handler = nullptr,
+               uint16_t timeoutMs = R200_COMMAND_TIMEOUT_MS, uint8_t retries = R200_COMMAND_RETRIES) {
+    if (count == R200_QUEUE_DEPTH || len > R200_COMMAND_MAX_LEN || len < R200_FRAME_OVERHEAD) {
+      stats.rejected++;
+      return false;
+    }
+    Command& cmd = commands[(head + count) % R200_QUEUE_DEPTH];
+    memcpy(cmd.frame, frame, len);
+    cmd.len = (uint8_t)len;
+    cmd.expectsReply = expectsReply;
+    cmd.handler = handler;
+    cmd.timeoutMs = timeoutMs;
+    cmd.retriesLeft = retries;
+    count++;
+    return true;
+  }
+
+  // Offer a received frame; true when it answered the command in flight
+  bool onFrame(const R200Frame& frame) {
+    if (!inFlight || frame.type != R200_TYPE_RESPONSE) return false;
+    uint8_t code = commands[head].frame[2];
+    R200CommandStatus status;
+    if (frame.command == code) {
+      status = R200_COMMAND_OK;
+      stats.replies++;
+    } else if (frame.command == R200_CMD_ERROR && frame.length >= 1 &&
+               frame.payload[0] != R200_ERROR_INVENTORY_FAIL) {
+      status = R200_COMMAND_ERROR_REPLY;
+      stats.errors++;
+    } else {
+      return false;
+    }
+    finish(status, &frame);
+    return true;
+  }
+
+  // Send the next frame when its turn comes, resend or give up on timeouts
+  void poll(uint32_t now) {
+    if (count == 0) return;
+    Command& cmd = commands[head];
+    if (inFlight) {
+      if (now - sentAt < cmd.timeoutMs) return;
+      if (cmd.retriesLeft > 0) {
+        cmd.retriesLeft--;
+        stats.retries++;
+        transmit(cmd, now);
+        return;
+      }
+      stats.timeouts++;
+      finish(R200_COMMAND_TIMEOUT, nullptr);
+      return;
+    }
+    if (now - lastSend < R200_COMMAND_GAP_MS) return;
+    transmit(cmd, now);
+    if (!cmd.expectsReply) finish(R200_COMMAND_OK, nullptr);
+  }
+
+  // Drop everything not yet answered, without calling handlers
+  void clear() {
+    head = 0;
+    count = 0;
+    inFlight = false;
+  }
+
+  bool idle() const { return count == 0; }
+  int pending() const { return count; }
+  int room() const { return R200_QUEUE_DEPTH - count; }
+  const R200QueueStats& getStats() const { return stats; }
+
+private:
+  struct Command {
+    uint8_t frame[R200_COMMAND_MAX_LEN];
+    uint8_t len;
+    bool expectsReply;
+    uint8_t retriesLeft;
+    uint16_t timeoutMs;
+    R200ReplyHandler handler;
+  };
+
+  ReaderPort* port;
+  Command commands[R200_QUEUE_DEPTH];
+  int head;
+  int count;
+  bool inFlight;
+  uint32_t sentAt;
+  uint32_t lastSend;
+  R200QueueStats stats;
+
+  void transmit(const Command& cmd, uint32_t now) {
+    port->write(cmd.frame, cmd.len);
+    stats.sent++;
+    inFlight = cmd.expectsReply;
+    sentAt = now;
+    lastSend = now;
+  }
+
+  // Pop before calling the handler so it can queue follow-up commands
+  void finish(R200CommandStatus status, const R200Frame* reply) {
+    uint8_t code = commands[head].frame[2];
+    R200ReplyHandler handler = commands[head].handler;
+    head = (head + 1) % R200_QUEUE_DEPTH;
+    count--;
+    inFlight = false;
+    if (handler) handler(code, status, reply);
+  }
+};
+
+#endif
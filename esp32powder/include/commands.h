@@ -1,165 +1,74 @@
 #ifndef COMMANDS_H
 #define COMMANDS_H
 
-#include <Arduino.h>
+// R200 commands, queued on r200Commands; see src/core/commands.cpp
 
-// Calculate checksum for R200 commands - USE ADDITION NOT XOR!
-byte calculateChecksum(byte* data, int len) {
-  byte checksum = 0;
-  for (int i = 1; i < len; i++) {  // Start from 1 (skip 0xAA)
-    checksum += data[i];  // ADDITION!
-  }
-  return checksum;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "tag_store.h"
+#include "command_queue.h"
+#include "r200_frames.h"
+#include "r200_replies.h"
 
-// command to R200 via Serial2
-void sendR200Command(byte* cmd, int len) {
-  Serial.print("TX: ");
-  for (int i = 0; i < len; i++) {
-    if (cmd[i] < 0x10) Serial.print("0");
-    Serial.print(cmd[i], HEX);
-    Serial.print(" ");
-  }
-  Serial.println();
-  
-  Serial2.write(cmd, len);
-  delay(50);
-}
-//The below commands are taken from the user commands note 6.4demo command
-//{0xAA, 0x00, 0xB7, 0x00, 0x00, 0xB7, 0xDD,},            //22. Acquire transmitting power 
-//{0xAA, 0x00, 0xB6, 0x00, 0x02, 0x07, 0xD0, 0x8F, 0xDD,}, //23. Set the transmitting power 
+typedef uint8_t byte;
 
+// Link to the R200 - set up by the environment before any command is sent
+extern ReaderPort* r200Port;
 
-void setPower(int power) {
-  byte cmd[9];
-  cmd[0] = 0xAA;
-  cmd[1] = 0x00;
-  cmd[2] = 0xB6;
-  cmd[3] = 0x00;
-  cmd[4] = 0x02;
-  cmd[5] = (power >> 8) & 0xFF;
-  cmd[6] = power & 0xFF;
-  cmd[7] = calculateChecksum(cmd, 7);  // Sum of bytes 1-6
-  cmd[8] = 0xDD;
-  
-  Serial2.write(cmd, sizeof(cmd));
-  Serial.print("Power set to ");
-  Serial.print(power / 100.0);
-  Serial.println(" dBm");
-}
-
-// Get current power setting
-void getPower() {
-  byte cmd[] = {0xAA, 0x00, 0xB7, 0x00, 0x00, 0xB7, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println("Requesting power level...");
-}
-    //   {0xAA, 0x00, 0x22, 0x00, 0x00, 0x22, 0xDD,},             //3. Single polling instruction 
-    //   {0xAA, 0x00, 0x27, 0x00, 0x03, 0x22, 0x27, 0x10, 0x83, 0xDD,}, //4. Multiple polling instructions 
-// Start continuous multi-tag polling
-void startMultiplePolling() {
-  byte cmd[] = {0xAA, 0x00, 0x27, 0x00, 0x03, 0x22, 0x27, 0x10, 0x83, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println(">>> Scanning STARTED <<<");
-}
+// Outgoing commands wait here and are sent from trackerPoll()
+extern R200CommandQueue r200Commands;
 
-// Stop multi-tag polling
-void stopMultiplePolling() {
-  byte cmd[] = {0xAA, 0x00, 0x28, 0x00, 0x00, 0x28, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println(">>> Scanning STOPPED <<<");
-}
+#define R200_WRITE_TIMEOUT_MS 1000  // the module answers a write once it has been tried
+#define R200_SELECT_ALWAYS 0x00     // Select before every inventory round
+#define R200_SELECT_NEVER 0x01
 
-// Single tag poll (read once)
-void singlePoll() {
-  byte cmd[] = {0xAA, 0x00, 0x22, 0x00, 0x00, 0x22, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println("Single poll triggered");
-}
+void logR200Frame(const byte* cmd, int len);
 
+// Queue a command for the R200; false when the queue is full
+bool sendR200Command(const byte* cmd, int len, bool expectsReply = false,
+                     R200ReplyHandler handler = nullptr,
+                     uint16_t timeoutMs = R200_COMMAND_TIMEOUT_MS);
 
-// {0xAA, 0x00, 0x03, 0x00, 0x01, 0x00, 0x04, 0xDD,},       //0. Hardware version 
-//       {0xAA, 0x00, 0x03, 0x00, 0x01, 0x01, 0x05, 0xDD,},       //1. Software version 
+// For a sequence of commands that only makes sense whole: check that all of
+// them fit before queuing the first
+bool r200QueueHasRoom(int commands);
 
-// Get hardware version
-void getHardwareVersion() {
-  byte cmd[] = {0xAA, 0x00, 0x03, 0x00, 0x01, 0x00, 0x04, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println("Requesting hardware version...");
+// Fixed frames are queued straight from flash, built ones from the caller's
+// stack; the queue copies either
+template <uint8_t Command, uint8_t... Payload>
+bool sendR200Command(R200FixedFrame<Command, Payload...>, bool expectsReply = false,
+                     R200ReplyHandler handler = nullptr,
+                     uint16_t timeoutMs = R200_COMMAND_TIMEOUT_MS) {
+  typedef R200FixedFrame<Command, Payload...> Frame;
+  return sendR200Command(Frame::bytes, sizeof(Frame::bytes), expectsReply, handler, timeoutMs);
 }
 
-// Get software version
-void getSoftwareVersion() {
-  byte cmd[] = {0xAA, 0x00, 0x03, 0x00, 0x01, 0x01, 0x05, 0xDD};
-  sendR200Command(cmd, sizeof(cmd));
-  Serial.println("Requesting software version...");
+template <size_t MaxPayload>
+bool sendR200Command(const R200FrameBuilder<MaxPayload>& frame, bool expectsReply = false,
+                     R200ReplyHandler handler = nullptr,
+                     uint16_t timeoutMs = R200_COMMAND_TIMEOUT_MS) {
+  return sendR200Command(frame.frame(), frame.size(), expectsReply, handler, timeoutMs);
 }
 
+bool setPower(int power, R200ReplyHandler handler = nullptr);
+bool getPower(R200ReplyHandler handler = nullptr);
+bool startMultiplePolling();
+bool stopMultiplePolling(R200ReplyHandler handler = nullptr);
+bool singlePoll();
+bool getHardwareVersion(R200ReplyHandler handler = nullptr);
+bool getSoftwareVersion(R200ReplyHandler handler = nullptr);
+bool writeEPC(const uint8_t* epcBytes, R200ReplyHandler handler = nullptr);
+bool setSelectParams(uint8_t selParam, uint32_t pointer, const uint8_t* mask, uint8_t maskBits,
+                     R200ReplyHandler handler = nullptr);
+bool setSelectMode(uint8_t mode, R200ReplyHandler handler = nullptr);
+bool setQueryParams(uint16_t param, R200ReplyHandler handler = nullptr);
+bool setRegion(uint8_t region, R200ReplyHandler handler = nullptr);
+bool setChannel(uint8_t channel, R200ReplyHandler handler = nullptr);
+bool setHopping(bool on, R200ReplyHandler handler = nullptr);
+bool getQueryParams(R200ReplyHandler handler = nullptr);
+bool getSelectParams(R200ReplyHandler handler = nullptr);
+bool getRegion(R200ReplyHandler handler = nullptr);
+bool getChannel(R200ReplyHandler handler = nullptr);
 
-
-// Write EPC to tag
-bool writeEPC(String epcHex) {
-  if (epcHex.length() != 24) {
-    Serial.println("Error: EPC must be exactly 24 hex characters (12 bytes)");
-    return false;
-  }
-  
-  byte epcBytes[12];
-  for (int i = 0; i < 12; i++) {
-    String byteStr = epcHex.substring(i * 2, i * 2 + 2);
-    epcBytes[i] = strtol(byteStr.c_str(), NULL, 16);
-  }
-  
-  byte cmd[28];
-  cmd[0] = 0xAA;
-  cmd[1] = 0x00;
-  cmd[2] = 0x49;
-  cmd[3] = 0x00;
-  cmd[4] = 0x15;  // Length = 21 bytes
-  
-  // Access password
-  cmd[5] = 0x00;
-  cmd[6] = 0x00;
-  cmd[7] = 0x00;
-  cmd[8] = 0x00;
-  
-  // Memory bank: 0x01 = EPC
-  cmd[9] = 0x01;
-  
-  // Starting address: Word 2
-  cmd[10] = 0x00;
-  cmd[11] = 0x00;
-  cmd[12] = 0x02;
-  
-  // Word count: 6 words
-  cmd[13] = 0x06;
-  
-  // EPC data
-  for (int i = 0; i < 12; i++) {
-    cmd[14 + i] = epcBytes[i];
-  }
-  
-  // Calculate checksum - FIXED! Use ADDITION not XOR
-  byte checksum = 0;
-  for (int i = 1; i < 26; i++) {
-    checksum += cmd[i];  // ADDITION!
-  }
-  cmd[26] = checksum;
-  
-  cmd[27] = 0xDD;
-  
-  // Send
-  Serial.print("TX: ");
-  for (int i = 0; i < 28; i++) {
-    if (cmd[i] < 0x10) Serial.print("0");
-    Serial.print(cmd[i], HEX);
-    Serial.print(" ");
-  }
-  Serial.println();
-  
-  Serial2.write(cmd, 28);
-  Serial.println("Writing EPC with SUM checksum: " + epcHex);
-  
-  return true;
-}
-#endif
\ No newline at end of file
+#endif
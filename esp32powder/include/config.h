@@ -10,11 +10,32 @@ const char* WIFI_PASSWORD = "privateoxygen";
 #define R200_TX_PIN 17
 #define R200_BAUD 115200
 
+// R200 ingest task - UART driver ring sizes and where the task runs. Core 0
+// keeps it off the Arduino loop (core 1), so web requests cannot stall it.
+#define R200_UART_RX_RING 16384  // ~1.4 s of traffic at 115200 baud
+#define R200_UART_TX_RING 1024
+#define R200_UART_EVENT_QUEUE 32
+#define INGEST_TASK_CORE 0
+#define INGEST_TASK_PRIORITY 10
+#define INGEST_TASK_STACK 4096
+
 // Web Server Configuration - use default
 #define WEB_SERVER_PORT 80
 
 // Default Settings
 #define DEFAULT_POWER 3000  // 30.00 dBm (need to check this properly)
-#define BUFFER_SIZE 256
+
+// Tag database capacity - unique tags kept before TAG_FULL_POLICY applies
+#define TAG_CAPACITY_PSRAM 4096
+#define TAG_CAPACITY_INTERNAL 1024
+#define TAG_FULL_POLICY TAG_FULL_REJECT  // or TAG_FULL_EVICT_STALEST
+
+// Reading history ring - sized at boot from free PSRAM/heap within these bounds
+#define HISTORY_MIN_RECORDS 1000
+#define HISTORY_MAX_RECORDS 200000
+
+// Persistent reading log on LittleFS - segments of 2048 reads (44 KB), the
+// oldest deleted beyond this count. 24 fit the default 1.4 MB data partition.
+#define READING_LOG_SEGMENTS 24
 
 #endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef CSV_STREAM_H
+#define CSV_STREAM_H
+
+// CSV counterpart of JsonStream: rows are written through the same shared
+// chunk buffer and go out as chunked transfer-encoding, so an export of any
+// length costs one buffer. Quoted fields double embedded quotes (RFC 4180).
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform.h"
+#include "json_stream.h"
+
+class CsvStream {
+public:
+  explicit CsvStream(HttpRequest& request) : req(request), len(0), needComma(false) {}
+
+  void begin(int code = 200) {
+    req.beginChunked(code, "text/csv; charset=utf-8");
+  }
+
+  void end() {
+    flush();
+    req.endChunked();
+  }
+
+  // Quoted text field
+  CsvStream& str(const char* s) {
+    separate();
+    put('"');
+    for (; *s; s++) {
+      if (*s == '"') put('"');
+      put(*s);
+    }
+    put('"');
+    needComma = true;
+    return *this;
+  }
+
+  // Quoted upper-case hex, e.g. an EPC
+  CsvStream& hex(const uint8_t* data, int n) {
+    separate();
+    put('"');
+    char out[3];
+    for (int i = 0; i < n; i++) {
+      bytesToHex(data + i, 1, out);
+      put(out[0]);
+      put(out[1]);
+    }
+    put('"');
+    needComma = true;
+    return *this;
+  }
+
+  CsvStream& num(long value) {
+    char out[24];
+    snprintf(out, sizeof(out), "%ld", value);
+    separate();
+    return raw(out);
+  }
+
+  CsvStream& num(unsigned long value) {
+    char out[24];
+    snprintf(out, sizeof(out), "%lu", value);
+    separate();
+    return raw(out);
+  }
+
+  CsvStream& num(int value) { return num((long)value); }
+  CsvStream& num(unsigned int value) { return num((unsigned long)value); }
+
+  CsvStream& endRow() {
+    put('\n');
+    needComma = false;
+    return *this;
+  }
+
+  // Unescaped text, e.g. the header row
+  CsvStream& raw(const char* s) {
+    for (; *s; s++) put(*s);
+    needComma = true;
+    return *this;
+  }
+
+private:
+  HttpRequest& req;
+  size_t len;
+  bool needComma;
+
+  void flush() {
+    if (len == 0) return;
+    req.sendChunk(jsonChunkBuffer, len);
+    len = 0;
+  }
+
+  void put(char c) {
+    if (len == JSON_CHUNK_SIZE) flush();
+    jsonChunkBuffer[len++] = c;
+  }
+
+  void separate() {
+    if (needComma) put(',');
+  }
+};
+
+#endif
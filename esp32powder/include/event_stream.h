@@ -0,0 +1,102 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+// Server-sent events fan-out. Events are queued as text in one buffer and
+// written to every connected client in a single burst, so a batch of
+// coalesced tag updates costs one socket write per client. Clients whose
+// write fails or falls short are dropped; the browser reconnects on its own.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "json_stream.h"
+
+#define EVENT_MAX_CHANNELS 4
+#define EVENT_COALESCE_MS 50      // per-tag updates within this window become one event
+#define EVENT_KEEPALIVE_MS 15000  // comment line on an idle stream to detect dead clients
+#define EVENT_BUFFER_SIZE 1536
+
+struct EventStats {
+  uint32_t events;
+  uint32_t bytes;
+  uint32_t clientsDropped;
+};
+
+class EventHub : public JsonSink {
+public:
+  EventHub() : count(0), len(0), lastSend(0) { memset(&stats, 0, sizeof(stats)); }
+
+  bool hasRoom() const { return count < EVENT_MAX_CHANNELS; }
+  bool active() const { return count > 0; }
+  int clients() const { return count; }
+  const EventStats& getStats() const { return stats; }
+
+  void attach(EventChannel* channel) {
+    static const char hello[] = "retry: 2000\n\n";
+    channels[count++] = channel;
+    if (channel->write(hello, sizeof(hello) - 1) != sizeof(hello) - 1) drop(count - 1);
+  }
+
+  // event: <name>\ndata: <JSON written through a JsonStream on this hub>\n\n
+  void beginEvent(const char* name) {
+    append("event: ");
+    append(name);
+    append("\ndata: ");
+  }
+
+  void endEvent() {
+    append("\n\n");
+    stats.events++;
+  }
+
+  void write(const char* data, size_t n) override {
+    while (n > 0) {
+      if (len == EVENT_BUFFER_SIZE) send();
+      size_t room = EVENT_BUFFER_SIZE - len;
+      size_t part = n < room ? n : room;
+      memcpy(buffer + len, data, part);
+      len += part;
+      data += part;
+      n -= part;
+    }
+  }
+
+  // Push whatever is queued, or a keep-alive comment after a quiet spell
+  void flush(uint32_t now) {
+    if (len == 0 && count > 0 && now - lastSend >= EVENT_KEEPALIVE_MS) append(":\n\n");
+    if (len > 0) {
+      send();
+      lastSend = now;
+    }
+  }
+
+private:
+  EventChannel* channels[EVENT_MAX_CHANNELS];
+  int count;
+  char buffer[EVENT_BUFFER_SIZE];
+  size_t len;
+  uint32_t lastSend;
+  EventStats stats;
+
+  void append(const char* s) { write(s, strlen(s)); }
+
+  void send() {
+    for (int i = count - 1; i >= 0; i--) {
+      if (!channels[i]->connected() || channels[i]->write(buffer, len) != len) {
+        drop(i);
+      } else {
+        stats.bytes += len;
+      }
+    }
+    len = 0;
+  }
+
+  void drop(int i) {
+    channels[i]->close();
+    channels[i] = channels[--count];
+    stats.clientsDropped++;
+  }
+};
+
+#endif
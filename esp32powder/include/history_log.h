@@ -0,0 +1,59 @@
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+// Fixed-capacity circular reading log. When full the oldest record is
+// overwritten and counted as dropped, so long sessions keep the most recent
+// window. Every record gets a sequence number (starting at 1) that keeps
+// increasing across wrap-arounds and clears; it is derived from the write
+// position rather than stored.
+
+#include <stdint.h>
+
+#include "tag_store.h"
+
+class HistoryLog {
+public:
+  HistoryLog() : records(nullptr), cap(0), count(0), nextSeq(1), dropped(0) {}
+
+  void begin(ReadingHistory* storage, uint32_t capacity) {
+    records = storage;
+    cap = capacity;
+    count = 0;
+    dropped = 0;
+  }
+
+  // Slot for the next record; overwrites the oldest when full
+  ReadingHistory& append() {
+    ReadingHistory& slot = records[nextSeq % cap];
+    nextSeq++;
+    if (count < cap) {
+      count++;
+    } else {
+      dropped++;
+    }
+    return slot;
+  }
+
+  void clear() {
+    count = 0;
+    dropped = 0;
+  }
+
+  uint32_t size() const { return count; }
+  uint32_t capacity() const { return cap; }
+  uint32_t droppedCount() const { return dropped; }
+  uint32_t firstSeq() const { return nextSeq - count; }  // oldest record held
+  uint32_t lastSeq() const { return nextSeq - 1; }        // newest record, 0 if none yet
+
+  bool contains(uint32_t seq) const { return count > 0 && seq >= firstSeq() && seq <= lastSeq(); }
+  const ReadingHistory& at(uint32_t seq) const { return records[seq % cap]; }
+
+private:
+  ReadingHistory* records;
+  uint32_t cap;
+  uint32_t count;
+  uint32_t nextSeq;
+  uint32_t dropped;
+};
+
+#endif
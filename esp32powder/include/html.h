@@ -96,6 +96,13 @@ const char* HTML_PAGE = R"rawliteral(
     .btn-export { background: linear-gradient(135deg, #84fab0 0%, #8fd3f4 100%); color: #333; }
     .section { margin: 30px 0; padding-top: 20px; border-top: 2px solid #f0f0f0; }
     .section h3 { margin-bottom: 15px; color: #555; font-size: 1.1em; }
+    .reader-info { margin-top: 12px; color: #888; font-size: 0.85em; }
+    .reader-info .error { color: #c0392b; }
+    .select-row { display: grid; grid-template-columns: 1fr auto auto; gap: 12px; align-items: end; }
+    .select-row input[type="text"] { font-family: monospace; }
+    .query-row { display: grid; grid-template-columns: repeat(4, 1fr) auto; gap: 12px; align-items: center; margin-bottom: 12px; }
+    .query-row select, .query-row input[type="number"] { padding: 12px; border: 2px solid #e0e0e0; border-radius: 10px; font-size: 15px; background: white; }
+    .query-row label { color: #555; font-size: 0.9em; }
     .mode-buttons { display: grid; grid-template-columns: repeat(3, 1fr); gap: 12px; margin-bottom: 20px; }
     .btn-mode {
       padding: 15px;
@@ -124,7 +131,7 @@ const char* HTML_PAGE = R"rawliteral(
     .btn-power-medium { background: linear-gradient(135deg, #b794f6 0%, #9b72f5 100%); color: white; }
     .btn-power-high { background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); color: white; }
     .btn-power:hover { transform: translateY(-2px); box-shadow: 0 6px 20px rgba(0,0,0,0.2); }
-    .stats { display: grid; grid-template-columns: repeat(2, 1fr); gap: 15px; margin-top: 25px; }
+    .stats { display: grid; grid-template-columns: repeat(3, 1fr); gap: 15px; margin-top: 25px; }
     .stat-box {
       background: linear-gradient(135deg, #f5f7fa 0%, #c3cfe2 100%);
       padding: 20px;
@@ -266,7 +273,7 @@ const char* HTML_PAGE = R"rawliteral(
         <div class="status-left">
           <span class="status-indicator" id="statusDot"></span>
           <span class="status-text" id="statusText">Initializing...</span>
-          <span class="mode-badge" id="modeBadge">Controlled</span>
+          <span class="mode-badge" id="modeBadge">Multiple</span>
         </div>
         <div class="history-badge" id="historyBadge">0 reads logged</div>
       </div>
@@ -280,7 +287,44 @@ const char* HTML_PAGE = R"rawliteral(
         <button class="btn btn-export" onclick="showExportDialog()">Export CSV</button>
       </div>
       
+      <div class="section">
+        <h3>Reader Mode</h3>
+        <div class="mode-buttons">
+          <button class="btn-mode" id="modeSingle" onclick="setMode('single')">Single<br><small>one round per Start</small></button>
+          <button class="btn-mode" id="modeMultiple" onclick="setMode('multiple')">Multiple<br><small>continuous</small></button>
+          <button class="btn-mode" id="modeControlled" onclick="setMode('controlled')">Controlled<br><small>on/off duty cycle</small></button>
+        </div>
+      </div>
       
+      <div class="section">
+        <h3>EPC Filter</h3>
+        <div class="select-row">
+          <input type="text" id="selectPrefix" maxlength="24" placeholder="EPC prefix (hex), e.g. E2806915">
+          <button class="btn btn-start" onclick="applySelect()">Apply</button>
+          <button class="btn btn-clear" onclick="clearSelect()">Clear</button>
+        </div>
+        <div class="reader-info" id="selectInfo">All tags are read</div>
+      </div>
+      
+      <div class="section">
+        <h3>Inventory</h3>
+        <div class="query-row">
+          <select id="queryQ"></select>
+          <label><input type="checkbox" id="queryAuto"> Auto Q</label>
+          <select id="querySession">
+            <option value="0">S0</option><option value="1">S1</option><option value="2">S2</option><option value="3">S3</option>
+          </select>
+          <select id="queryTarget"><option value="A">Target A</option><option value="B">Target B</option></select>
+          <button class="btn btn-start" onclick="applyQuery()">Apply</button>
+        </div>
+        <div class="query-row">
+          <select id="rfRegion" onchange="fillChannels()"></select>
+          <select id="rfChannel"></select>
+          <span></span><span></span>
+          <button class="btn btn-start" onclick="applyRf()">Apply</button>
+        </div>
+        <div class="reader-info" id="queryInfo">Waiting for the reader...</div>
+      </div>
       
       <div class="section">
         <h3>Power Level Control</h3>
@@ -289,6 +333,24 @@ const char* HTML_PAGE = R"rawliteral(
           <button class="btn-power btn-power-medium" onclick="setPower(2600)">Medium<br><small>26 dBm</small></button>
           <button class="btn-power btn-power-high" onclick="setPower(3000)">Maximum<br><small>30 dBm</small></button>
         </div>
+        <div class="query-row" style="margin-top: 15px;">
+          <input type="number" id="sweepFrom" value="15" min="5" max="33" step="0.5" title="From (dBm)">
+          <input type="number" id="sweepTo" value="30" min="5" max="33" step="0.5" title="To (dBm)">
+          <input type="number" id="sweepStep" value="1" min="0.5" step="0.5" title="Step (dB)">
+          <input type="number" id="sweepDwell" value="3" min="0.5" max="60" step="0.5" title="Dwell per level (s)">
+          <button class="btn btn-start" id="sweepButton" onclick="toggleSweep()">Sweep</button>
+        </div>
+        <div class="reader-info" id="sweepInfo">Sweep: from, to and step in dBm, dwell in seconds</div>
+        <div class="query-row" style="grid-template-columns: auto repeat(4, 1fr) auto;">
+          <label><input type="checkbox" id="powerAuto"> Auto power</label>
+          <input type="number" id="powerLowRssi" min="-100" max="-20" title="Weakest tenth of own tags at least (dBm)">
+          <input type="number" id="powerHighRssi" min="-100" max="-20" title="Weakest tenth of own tags at most (dBm)">
+          <input type="number" id="powerMinTags" min="0" title="Own tags at least (0 = any)">
+          <input type="number" id="powerMaxTags" min="0" title="Tags at most, cross-reads included (0 = any)">
+          <button class="btn btn-start" onclick="applyPowerControl()">Apply</button>
+        </div>
+        <div class="reader-info" id="powerControlInfo">Auto power: RSSI band in dBm, tag counts (0 = any)</div>
+        <div class="reader-info" id="readerInfo">Waiting for the reader...</div>
       </div>
       
       <div class="stats">
@@ -296,6 +358,10 @@ const char* HTML_PAGE = R"rawliteral(
           <div class="stat-label">Unique Bottles</div>
           <div class="stat-value" id="tagCount">0</div>
         </div>
+        <div class="stat-box">
+          <div class="stat-label">Present</div>
+          <div class="stat-value" id="presentCount">0</div>
+        </div>
         <div class="stat-box">
           <div class="stat-label">Power (dBm)</div>
           <div class="stat-value" id="powerDisplay">30.0</div>
@@ -435,88 +501,351 @@ const char* HTML_PAGE = R"rawliteral(
     let currentTagData = [];
     let targetProgramEPC = '';
     let programMode = 'auto';
-    let currentMode = 'controlled';
+    let programWatching = false;  // a program/start is ours to follow until done or failed
+    let statusSeq = 0;
+    let statusState = {};
+    let statusTags = {};
+    
+    // Fold a /api/status?since= delta into the local copy. Tags are keyed by
+    // row number, so an evicted slot is simply overwritten.
+    function mergeStatus(delta) {
+      if (!delta.full && delta.seq < statusSeq) return;  // overtaken by a newer reply
+      if (delta.full) { statusState = {}; statusTags = {}; }
+      (delta.tags || []).forEach(tag => { statusTags[tag.no] = tag; });
+      delete delta.tags;
+      Object.assign(statusState, delta);
+      statusSeq = delta.seq;
+    }
+    
+    const REGIONS = { 1: 'China 900 MHz', 2: 'US', 3: 'Europe', 4: 'China 800 MHz', 6: 'Korea' };
+    
+    function renderReaderInfo(reader) {
+      if (!reader || !reader.hardware) return;
+      const parts = ['R200 ' + reader.hardware + ' / ' + reader.software];
+      if (reader.region) parts.push(REGIONS[reader.region] || 'region ' + reader.region);
+      if (reader.channel >= 0) parts.push('channel ' + reader.channel);
+      if (reader.q !== undefined) parts.push('Q' + reader.q + ' S' + reader.session + ' ' + reader.target);
+      const info = document.getElementById('readerInfo');
+      info.textContent = parts.join(' · ');
+      if (reader.lastError) {
+        const error = document.createElement('span');
+        error.className = 'error';
+        error.textContent = ' · last error: ' + reader.lastErrorText;
+        info.appendChild(error);
+      }
+    }
+    
+    // Filter as set, what the reader reports back, and reads the host dropped
+    function renderSelectInfo(data) {
+      const select = data.select || {};
+      const reader = data.reader || {};
+      let text = 'All tags are read';
+      if (select.active) {
+        text = (select.offset ? 'Bits ' + select.offset + '-' + (select.offset + select.bits - 1) + ' = ' : 'Prefix ') +
+          select.mask + ' (' + select.bits + ' bits)';
+        text += reader.selectBits === select.bits ? ' · set on reader' : ' · waiting for reader';
+      }
+      if (data.selectFiltered) text += ' · ' + data.selectFiltered + ' reads dropped on the ESP32';
+      document.getElementById('selectInfo').textContent = text;
+    }
+    
+    function applySelect() {
+      const prefix = document.getElementById('selectPrefix').value.trim().toUpperCase();
+      if (!/^[0-9A-F]{1,24}$/.test(prefix)) { alert('Enter 1 to 24 hex digits'); return; }
+      fetch('/api/select?prefix=' + prefix)
+        .then(response => { if (!response.ok) return response.text().then(t => alert(t)); })
+        .then(() => updateStatus());
+    }
+    
+    function clearSelect() {
+      document.getElementById('selectPrefix').value = '';
+      fetch('/api/select?clear=1').then(() => updateStatus());
+    }
+    
+    // Channels per region, as in r200RegionPlans
+    const REGION_CHANNELS = { 1: 20, 2: 52, 3: 15, 4: 20, 6: 32 };
+    let queryFormLoaded = false;
+    let powerFormLoaded = false;
+    
+    function fillChannels(selected) {
+      const channels = REGION_CHANNELS[document.getElementById('rfRegion').value] || 0;
+      const select = document.getElementById('rfChannel');
+      select.innerHTML = '<option value="-1">Hopping</option>';
+      for (let i = 0; i < channels; i++) select.add(new Option('Channel ' + i, i));
+      select.value = selected !== undefined && selected < channels ? selected : -1;
+    }
+    
+    // The form is filled once from the device; after that it is the user's
+    function loadQueryForm(data) {
+      const query = data.query, rf = data.rf, reader = data.reader || {};
+      if (queryFormLoaded || !query || !rf) return;
+      queryFormLoaded = true;
+      const q = document.getElementById('queryQ');
+      for (let i = 0; i <= 15; i++) q.add(new Option('Q' + i + ' (' + (1 << i) + ' slots)', i));
+      q.value = query.q;
+      document.getElementById('queryAuto').checked = query.auto;
+      document.getElementById('querySession').value = query.session;
+      document.getElementById('queryTarget').value = query.target;
+      const region = document.getElementById('rfRegion');
+      Object.keys(REGIONS).forEach(r => region.add(new Option(REGIONS[r], r)));
+      region.value = rf.region || reader.region || 1;
+      fillChannels(rf.channel);
+    }
+    
+    // Query and RF as set, with Q following auto mode
+    function renderQueryInfo(data) {
+      const query = data.query, rf = data.rf, reader = data.reader || {};
+      if (!query || !rf) return;
+      loadQueryForm(data);
+      let text = 'Q' + query.q + (query.auto ? ' (auto, ' + query.autoChanges + ' changes)' : '') +
+        ' · S' + query.session + ' · target ' + query.target;
+      if (reader.q !== undefined && reader.q !== query.q) text += ' · reader at Q' + reader.q;
+      text += ' · ' + (rf.hopping ? 'hopping' : 'channel ' + rf.channel);
+      if (reader.channelKHz) text += ' (' + (reader.channelKHz / 1000).toFixed(3) + ' MHz)';
+      if (query.auto) document.getElementById('queryQ').value = query.q;
+      document.getElementById('queryInfo').textContent = text;
+    }
+    
+    function applyQuery() {
+      const params = document.getElementById('queryAuto').checked ? 'auto=1' : 'q=' + document.getElementById('queryQ').value;
+      fetch('/api/query?' + params + '&session=' + document.getElementById('querySession').value +
+            '&target=' + document.getElementById('queryTarget').value)
+        .then(response => { if (!response.ok) return response.text().then(t => alert(t)); })
+        .then(() => updateStatus());
+    }
+    
+    function applyRf() {
+      const channel = document.getElementById('rfChannel').value;
+      fetch('/api/rf?region=' + document.getElementById('rfRegion').value + (channel < 0 ? '&hopping=1' : '&channel=' + channel))
+        .then(response => { if (!response.ok) return response.text().then(t => alert(t)); })
+        .then(() => updateStatus());
+    }
+    
+    // Sweep progress, or the outcome with a button to apply it
+    function renderSweepInfo(data) {
+      const sweep = data.sweep;
+      if (!sweep || sweep.state === 'idle') return;
+      const running = sweep.state === 'setting' || sweep.state === 'dwell';
+      document.getElementById('sweepButton').textContent = running ? 'Stop' : 'Sweep';
+      const info = document.getElementById('sweepInfo');
+      if (running) {
+        info.textContent = 'Sweeping: level ' + (sweep.level + 1) + ' of ' + sweep.levels + ' (' +
+          (sweep.power / 100).toFixed(1) + ' dBm)';
+        return;
+      }
+      info.textContent = (sweep.state === 'failed' ? 'Sweep ended: ' + sweep.failure + '. ' : 'Sweep done. ') +
+        (sweep.recommended ? 'Recommended ' + (sweep.recommended / 100).toFixed(1) + ' dBm ' : 'No recommendation');
+      if (sweep.recommended && sweep.recommended !== data.powerRequested) {
+        const use = document.createElement('button');
+        use.className = 'btn btn-start';
+        use.textContent = 'Use';
+        use.onclick = () => setPower(sweep.recommended);
+        info.appendChild(use);
+      }
+    }
+    
+    function toggleSweep() {
+      if (document.getElementById('sweepButton').textContent === 'Stop') {
+        fetch('/api/sweep?stop=1').then(() => updateStatus());
+        return;
+      }
+      const centi = id => Math.round(parseFloat(document.getElementById(id).value) * 100);
+      const dwell = Math.round(parseFloat(document.getElementById('sweepDwell').value) * 1000);
+      fetch('/api/sweep?start=1&from=' + centi('sweepFrom') + '&to=' + centi('sweepTo') + '&step=' + centi('sweepStep') +
+            '&dwell=' + dwell)
+        .then(response => { if (!response.ok) return response.text().then(t => alert(t)); })
+        .then(() => updateStatus());
+    }
+    
+    // Controller state; its form is filled once, like the inventory one
+    function renderPowerControlInfo(data) {
+      const control = data.powerControl;
+      if (!control) return;
+      if (!powerFormLoaded) {
+        powerFormLoaded = true;
+        document.getElementById('powerAuto').checked = control.enabled;
+        document.getElementById('powerLowRssi').value = control.lowRssi;
+        document.getElementById('powerHighRssi').value = control.highRssi;
+        document.getElementById('powerMinTags').value = control.minTags;
+        document.getElementById('powerMaxTags').value = control.maxTags;
+      }
+      if (!control.enabled) {
+        document.getElementById('powerControlInfo').textContent = 'Auto power off';
+        return;
+      }
+      let text = 'Auto power ' + (control.minPower / 100).toFixed(1) + '-' + (control.maxPower / 100).toFixed(1) +
+        ' dBm · ' + control.stepsUp + ' up, ' + control.stepsDown + ' down';
+      if (control.reason) {
+        text += ' · last window ' + control.ownTags + ' own of ' + control.tags + ' tags, weakest tenth ' +
+          control.weakRssi + ' dBm: ' + control.reason;
+      }
+      document.getElementById('powerControlInfo').textContent = text;
+    }
+    
+    function applyPowerControl() {
+      const value = id => document.getElementById(id).value;
+      fetch('/api/power/control?enable=' + (document.getElementById('powerAuto').checked ? 1 : 0) +
+            '&lowRssi=' + value('powerLowRssi') + '&highRssi=' + value('powerHighRssi') +
+            '&minTags=' + value('powerMinTags') + '&maxTags=' + value('powerMaxTags'))
+        .then(response => { if (!response.ok) return response.text().then(t => alert(t)); })
+        .then(() => updateStatus());
+    }
     
     function setMode(mode) {
-      fetch('/api/mode?mode=' + mode).then(() => {
-        currentMode = mode;
-        document.getElementById('modeSingle').classList.remove('active');
-        document.getElementById('modeMultiple').classList.remove('active');
-        document.getElementById('modeControlled').classList.remove('active');
-        document.getElementById('mode' + mode.charAt(0).toUpperCase() + mode.slice(1)).classList.add('active');
-        updateStatus();
-      });
+      fetch('/api/mode?mode=' + mode).then(() => updateStatus());
     }
     
     function updateStatus() {
-      fetch('/api/status')
+      fetch('/api/status?since=' + statusSeq)
         .then(response => response.json())
-        .then(data => {
-          currentTagData = data.tags || [];
-          document.getElementById('statusText').textContent = data.scanning ? 'Scanning Active' : 'Idle';
-          document.getElementById('statusDot').className = 'status-indicator ' + (data.scanning ? 'active' : 'inactive');
-          document.getElementById('modeBadge').textContent = data.mode || 'Controlled';
-          document.getElementById('historyBadge').textContent = (data.historyCount || 0) + ' reads logged';
-          document.getElementById('tagCount').textContent = data.tagCount;
-          document.getElementById('powerDisplay').textContent = (data.power / 100).toFixed(1);
-          
-          if (data.registrationMode) {
-            const progress = Math.min(data.registrationProgress, 5);
-            document.getElementById('progressBar').style.width = (progress / 5 * 100) + '%';
-            document.getElementById('progressText').textContent = progress + '/5';
-            if (data.registrationEPC) {
-              document.getElementById('detectedEPC').textContent = data.registrationEPC.substring(0, 20) + '...';
-            }
-            if (progress >= 5 && data.registrationEPC) {
-              registrationEPC = data.registrationEPC;
-              document.getElementById('stepDetecting').style.display = 'none';
-              document.getElementById('stepNaming').style.display = 'block';
-              document.getElementById('confirmButton').style.display = 'block';
-              document.getElementById('finalEPC').textContent = data.registrationEPC.substring(0, 20) + '...';
-              document.getElementById('bottleName').focus();
-            }
-          }
-          
-          if (data.programmingMode) {
-            const progress = data.programmingProgress;
-            if (data.programmingComplete) {
-              document.getElementById('programProgressBar').style.width = '100%';
-              document.getElementById('programProgressText').textContent = 'Complete!';
-              document.getElementById('programStatus').textContent = '✓ Tag programmed successfully!';
-              document.getElementById('programStatus').style.color = '#27ae60';
-              setTimeout(() => { document.getElementById('programModal').style.display = 'none'; }, 2000);
-            } else if (progress > 0) {
-              document.getElementById('programProgressBar').style.width = (progress / 3 * 100) + '%';
-              document.getElementById('programProgressText').textContent = progress + '/3';
-              document.getElementById('programStatus').textContent = 'Blank tag detected - confirming...';
-            } else {
-              document.getElementById('programProgressBar').style.width = '0%';
-              document.getElementById('programProgressText').textContent = 'Waiting...';
-              document.getElementById('programStatus').textContent = 'Place blank tag (000000...) near reader';
-            }
-          }
-          
-          const tableBody = document.getElementById('tagTableBody');
-          if (data.tags && data.tags.length > 0) {
-            let html = '';
-            data.tags.forEach(tag => {
-              html += '<tr><td>' + tag.no + '</td>';
-              html += '<td' + (tag.name ? ' class="tag-name-display">' + tag.name : ' style="color: #999; font-style: italic;">Unregistered') + '</td>';
-              html += '<td class="mono" style="font-size: 0.75em;">' + tag.epc + '</td>';
-              html += '<td style="text-align: right;">' + tag.rssi + ' dBm</td>';
-              html += '<td style="text-align: right;">' + tag.cnt + '</td></tr>';
-            });
-            tableBody.innerHTML = html;
-          } else {
-            tableBody.innerHTML = '<tr><td colspan="5" style="text-align: center; padding: 20px; color: #999;">No bottles detected...</td></tr>';
-          }
-        })
+        .then(delta => { mergeStatus(delta); renderStatus(); })
         .catch(err => { console.error('Error:', err); document.getElementById('statusText').textContent = 'Connection Error'; });
     }
     
+    function renderStatus() {
+      const data = statusState;
+      data.tags = Object.keys(statusTags).map(Number).sort((a, b) => a - b).map(no => statusTags[no]);
+      currentTagData = data.tags || [];
+      document.getElementById('statusText').textContent = data.scanning ? 'Scanning Active' : 'Idle';
+      document.getElementById('statusDot').className = 'status-indicator ' + (data.scanning ? 'active' : 'inactive');
+      const mode = data.mode || 'multiple';
+      let badge = mode.charAt(0).toUpperCase() + mode.slice(1);
+      if (data.dutyPhase) badge += ' (' + data.dutyPhase + ')';
+      document.getElementById('modeBadge').textContent = badge;
+      ['single', 'multiple', 'controlled'].forEach(m => {
+        document.getElementById('mode' + m.charAt(0).toUpperCase() + m.slice(1)).classList.toggle('active', m === mode);
+      });
+      document.getElementById('historyBadge').textContent = (data.historyCount || 0) + ' reads logged';
+      document.getElementById('tagCount').textContent = data.tagCount;
+      document.getElementById('presentCount').textContent = data.presentCount || 0;
+      // Power as the reader reports it; an arrow while a new setting is on its way
+      let power = data.power ? (data.power / 100).toFixed(1) : '-';
+      if (data.power && data.powerRequested && data.powerRequested !== data.power) {
+        power += ' → ' + (data.powerRequested / 100).toFixed(1);
+      }
+      document.getElementById('powerDisplay').textContent = power;
+      renderReaderInfo(data.reader);
+      renderSelectInfo(data);
+      renderQueryInfo(data);
+      renderSweepInfo(data);
+      renderPowerControlInfo(data);
+      
+      if (data.registrationMode) {
+        const progress = Math.min(data.registrationProgress, 5);
+        document.getElementById('progressBar').style.width = (progress / 5 * 100) + '%';
+        document.getElementById('progressText').textContent = progress + '/5';
+        if (data.registrationEPC) {
+          document.getElementById('detectedEPC').textContent = data.registrationEPC.substring(0, 20) + '...';
+        }
+        if (progress >= 5 && data.registrationEPC) {
+          registrationEPC = data.registrationEPC;
+          document.getElementById('stepDetecting').style.display = 'none';
+          document.getElementById('stepNaming').style.display = 'block';
+          document.getElementById('confirmButton').style.display = 'block';
+          document.getElementById('finalEPC').textContent = data.registrationEPC.substring(0, 20) + '...';
+          document.getElementById('bottleName').focus();
+        }
+      }
+      
+      if (programWatching && data.programmingState) {
+        const state = data.programmingState;
+        const progress = data.programmingProgress;
+        const timing = data.programmingTiming || {};
+        if (state === 'done') {
+          programWatching = false;
+          document.getElementById('programProgressBar').style.width = '100%';
+          document.getElementById('programProgressText').textContent = 'Complete!';
+          document.getElementById('programStatus').textContent = '✓ Tag programmed in ' + timing.total + ' ms (write ' +
+            timing.write + ' ms, verify ' + timing.verify + ' ms)';
+          document.getElementById('programStatus').style.color = '#27ae60';
+          setTimeout(() => { document.getElementById('programModal').style.display = 'none'; }, 2000);
+        } else if (state === 'failed') {
+          programWatching = false;
+          document.getElementById('programProgressText').textContent = 'Failed';
+          document.getElementById('programStatus').textContent = '✗ ' + data.programmingError +
+            (data.programmingErrorCode ? ' (0x' + data.programmingErrorCode.toString(16).toUpperCase() + ')' : '');
+          document.getElementById('programStatus').style.color = '#e74c3c';
+        } else if (state === 'stopping' || state === 'writing' || state === 'verifying') {
+          document.getElementById('programProgressBar').style.width = '100%';
+          document.getElementById('programProgressText').textContent = state === 'verifying' ? 'Verifying...' : 'Writing...';
+          document.getElementById('programStatus').textContent = state === 'verifying' ? 'Reading new EPC back...' :
+            'Writing EPC' + (data.programmingAttempts > 1 ? ' (attempt ' + data.programmingAttempts + ')' : '') + '...';
+        } else if (progress > 0) {
+          document.getElementById('programProgressBar').style.width = (progress / 3 * 100) + '%';
+          document.getElementById('programProgressText').textContent = progress + '/3';
+          document.getElementById('programStatus').textContent = 'Blank tag detected - confirming...';
+        } else {
+          document.getElementById('programProgressBar').style.width = '0%';
+          document.getElementById('programProgressText').textContent = 'Waiting...';
+          document.getElementById('programStatus').textContent = 'Place blank tag (000000...) near reader';
+        }
+      }
+      
+      const tableBody = document.getElementById('tagTableBody');
+      if (data.tags && data.tags.length > 0) {
+        let html = '';
+        data.tags.forEach(tag => {
+          html += '<tr' + (tag.present ? '' : ' style="opacity: 0.45;"') + '><td>' + tag.no + '</td>';
+          html += '<td' + (tag.name ? ' class="tag-name-display">' + tag.name : ' style="color: #999; font-style: italic;">Unregistered') + '</td>';
+          html += '<td class="mono" style="font-size: 0.75em;">' + tag.epc + '</td>';
+          html += '<td style="text-align: right;">' + tag.rssi + ' dBm</td>';
+          html += '<td style="text-align: right;">' + tag.cnt + '</td></tr>';
+        });
+        tableBody.innerHTML = html;
+      } else {
+        tableBody.innerHTML = '<tr><td colspan="5" style="text-align: center; padding: 20px; color: #999;">No bottles detected...</td></tr>';
+      }
+    }
+    
+    // Events arrive in bursts every ~50 ms; draw at most once per frame
+    let renderPending = false;
+    function scheduleRender() {
+      if (renderPending) return;
+      renderPending = true;
+      requestAnimationFrame(() => { renderPending = false; renderStatus(); });
+    }
+    
+    // Pushed updates from /api/events; polling only while the stream is down
+    let pollTimer = null;
+    function startPolling() { if (!pollTimer) pollTimer = setInterval(updateStatus, 1000); }
+    function stopPolling() { if (pollTimer) { clearInterval(pollTimer); pollTimer = null; } }
+    
+    function connectEvents() {
+      if (!window.EventSource) { startPolling(); return; }
+      const events = new EventSource('/api/events');
+      events.onopen = () => { stopPolling(); updateStatus(); };
+      events.onerror = () => { startPolling(); };
+      events.addEventListener('tag', e => {
+        const tag = JSON.parse(e.data);
+        // Short updates for a row we have not loaded yet come with the pending status fetch
+        if (!statusTags[tag.no] && !tag.epc) return;
+        statusTags[tag.no] = Object.assign(statusTags[tag.no] || {}, tag);
+        scheduleRender();
+      });
+      ['mode', 'programming', 'counts'].forEach(name => {
+        events.addEventListener(name, e => { Object.assign(statusState, JSON.parse(e.data)); scheduleRender(); });
+      });
+      // Presence changes for rows already loaded; new rows carry "present" themselves
+      ['enter', 'leave'].forEach(name => {
+        events.addEventListener(name, e => {
+          const change = JSON.parse(e.data);
+          if (!statusTags[change.no]) return;
+          statusTags[change.no].present = name === 'enter';
+          scheduleRender();
+        });
+      });
+      events.addEventListener('reset', () => { statusSeq = 0; updateStatus(); });
+    }
+    
     function startScan() { fetch('/api/start').then(() => updateStatus()); }
     function stopScan() { fetch('/api/stop').then(() => updateStatus()); }
-    function setPower(powerValue) { fetch('/api/power?value=' + powerValue).then(() => updateStatus()); }
+    // Setting a power by hand turns auto power off on the device
+    function setPower(powerValue) {
+      fetch('/api/power?value=' + powerValue).then(() => {
+        document.getElementById('powerAuto').checked = false;
+        updateStatus();
+      });
+    }
     function clearTags() {
       if (confirm('Clear all detected tags and reading history?\n\n(Registered names will be kept)')) {
         fetch('/api/clear').then(() => updateStatus());
@@ -554,10 +883,10 @@ const char* HTML_PAGE = R"rawliteral(
     }
     
     function showExportDialog() {
-      fetch('/api/history')
+      fetch('/api/history?limit=0')
         .then(response => response.json())
         .then(data => {
-          if (!data.readings || data.readings.length === 0) {
+          if (!data.count) {
             alert('No reading history to export!\n\nStart scanning and detect some tags first.');
             return;
           }
@@ -573,31 +902,20 @@ const char* HTML_PAGE = R"rawliteral(
     function confirmExport() {
       const location = document.getElementById('testLocation').value.trim();
       if (!location) { alert('Please enter a test location/name!'); return; }
-      fetch('/api/history')
-        .then(response => response.json())
-        .then(data => {
-          if (!data.readings || data.readings.length === 0) { alert('No reading history to export!'); return; }
-          const now = new Date();
-          const dateStr = now.toISOString().substring(0, 10);
-          const timeStr = now.toTimeString().substring(0, 8).replace(/:/g, '-');
-          let csv = 'Test Location,Read Number,Timestamp,Bottle Name,EPC,RSSI (dBm)\n';
-          data.readings.forEach((reading, index) => {
-            const name = reading.name || 'Unregistered';
-            csv += `"${location}",${index + 1},"${reading.time}","${name}","${reading.epc}",${reading.rssi}\n`;
-          });
-          const blob = new Blob([csv], { type: 'text/csv;charset=utf-8;' });
-          const link = document.createElement('a');
-          const url = URL.createObjectURL(blob);
-          const filename = `RFID_${location.replace(/\s+/g, '_')}_${dateStr}_${timeStr}.csv`;
-          link.setAttribute('href', url);
-          link.setAttribute('download', filename);
-          link.style.visibility = 'hidden';
-          document.body.appendChild(link);
-          link.click();
-          document.body.removeChild(link);
-          document.getElementById('exportModal').style.display = 'none';
-          alert(`CSV exported successfully!\n\nFile: ${filename}\nTotal reads: ${data.readings.length}`);
-        });
+      // The device streams the CSV; the browser saves it as it arrives
+      const now = new Date();
+      const dateStr = now.toISOString().substring(0, 10);
+      const timeStr = now.toTimeString().substring(0, 8).replace(/:/g, '-');
+      const filename = `RFID_${location.replace(/\s+/g, '_')}_${dateStr}_${timeStr}.csv`;
+      const link = document.createElement('a');
+      link.setAttribute('href', '/api/history.csv?location=' + encodeURIComponent(location));
+      link.setAttribute('download', filename);
+      link.style.visibility = 'hidden';
+      document.body.appendChild(link);
+      link.click();
+      document.body.removeChild(link);
+      document.getElementById('exportModal').style.display = 'none';
+      alert(`CSV export started!\n\nFile: ${filename}\nTotal reads: ${document.getElementById('exportReadCount').textContent}`);
     }
     
     function showProgramDialog() {
@@ -642,17 +960,20 @@ const char* HTML_PAGE = R"rawliteral(
         document.getElementById('targetEPC').textContent = epc;
         document.getElementById('programButton').textContent = 'Write to Tag';
       }
+      document.getElementById('programStatus').style.color = '#667eea';
       fetch('/api/program/start?epc=' + encodeURIComponent(targetProgramEPC))
-        .then(() => { document.getElementById('programButton').style.display = 'none'; });
+        .then(() => { document.getElementById('programButton').style.display = 'none'; programWatching = true; updateStatus(); });
     }
     
     function cancelProgram() {
+      programWatching = false;
       document.getElementById('programModal').style.display = 'none';
       fetch('/api/program/cancel');
     }
     
-    setInterval(updateStatus, 1000);
     updateStatus();
+    startPolling();
+    connectEvents();
   </script>
 </body>
 </html>
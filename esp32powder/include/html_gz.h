@@ -0,0 +1,680 @@
+// Generated by scripts/compress_html.py from include/html.h - do not edit.
+// 10620 bytes gzipped from 46066.
+#ifndef HTML_GZ_H
+#define HTML_GZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HTML_PAGE_ETAG "\"dfe989a263c00bd3\""
+#define HTML_PAGE_ID_ETAG "\"dfe989a263c00bd3-id\""  // the uncompressed page
+
+const size_t HTML_PAGE_GZ_LEN = 10620;
+const uint8_t HTML_PAGE_GZ[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x7d, 0xdb, 0x92, 0x1b, 0xb9,
+  0x92, 0xd8, 0xfb, 0x7c, 0x05, 0xc4, 0x39, 0x23, 0x92, 0x2b, 0x92, 0xcd, 0x4b, 0xb3, 0xd5, 0xea,
+  0x9b, 0x56, 0x6a, 0x49, 0x67, 0xe4, 0x1d, 0x69, 0x34, 0xea, 0x9e, 0x99, 0xd8, 0xd0, 0x19, 0x9f,
+  0x53, 0x2c, 0xa2, 0x9a, 0x75, 0x54, 0xac, 0xa2, 0xaa, 0x8a, 0x6a, 0xf5, 0xd1, 0xb6, 0xc3, 0x4f,
+  0x7e, 0xf4, 0x46, 0xd8, 0x0f, 0x8e, 0x70, 0x6c, 0x84, 0x1d, 0xfe, 0x04, 0xbf, 0xd8, 0xcf, 0xfe,
+  0x94, 0xf9, 0x01, 0xfb, 0x13, 0x9c, 0x99, 0x00, 0xaa, 0x00, 0x14, 0x8a, 0x97, 0xee, 0xd6, 0xec,
+  0x8c, 0x62, 0x24, 0xb2, 0x0a, 0x48, 0x24, 0x12, 0x89, 0xbc, 0x03, 0xfc, 0xea, 0xe8, 0xde, 0xb3,
+  0xef, 0x4f, 0xcf, 0xff, 0xf1, 0xcd, 0x73, 0x36, 0xcb, 0xe7, 0xd1, 0xc9, 0x57, 0x47, 0xea, 0x1f,
+  0xee, 0x4d, 0x4f, 0xbe, 0x62, 0xec, 0x68, 0xce, 0x73, 0x8f, 0xf9, 0x33, 0x2f, 0xcd, 0x78, 0x7e,
+  0xdc, 0xf8, 0xf1, 0xfc, 0x45, 0x77, 0xbf, 0x51, 0xbe, 0x88, 0xbd, 0x39, 0x3f, 0x6e, 0x7c, 0x0c,
+  0xf9, 0xe5, 0x22, 0x49, 0xf3, 0x06, 0xf3, 0x93, 0x38, 0xe7, 0x31, 0x34, 0xbc, 0x0c, 0xa7, 0xf9,
+  0xec, 0x78, 0xca, 0x3f, 0x86, 0x3e, 0xef, 0xd2, 0x97, 0x0e, 0x0b, 0xe3, 0x30, 0x0f, 0xbd, 0xa8,
+  0x9b, 0xf9, 0x5e, 0xc4, 0x8f, 0x07, 0x02, 0x4c, 0x1e, 0xe6, 0x11, 0x3f, 0x79, 0xfb, 0xe2, 0xe5,
+  0x33, 0xf6, 0x26, 0xb9, 0x9c, 0xf2, 0x94, 0x9d, 0xa7, 0x9e, 0xff, 0x3e, 0x8c, 0x2f, 0x8e, 0x76,
+  0xc4, 0x3b, 0x6c, 0x95, 0xe5, 0x57, 0xe2, 0x13, 0x63, 0x7f, 0xc7, 0x3e, 0xb3, 0xb9, 0x97, 0x5e,
+  0x84, 0xf1, 0x01, 0xeb, 0x1f, 0xb2, 0x85, 0x37, 0x9d, 0x42, 0x63, 0xfa, 0x3c, 0x49, 0x3e, 0x75,
+  0xb3, 0xf0, 0x6f, 0xf4, 0x75, 0x92, 0xa4, 0x00, 0xac, 0x0b, 0x8f, 0x0e, 0xd9, 0x35, 0x75, 0x9c,
+  0x24, 0xd3, 0x2b, 0xf6, 0x99, 0x3e, 0x32, 0x16, 0x00, 0xa2, 0xdd, 0xc0, 0x9b, 0x87, 0xd1, 0xd5,
+  0x01, 0xeb, 0x7a, 0x8b, 0x45, 0xc4, 0xbb, 0xd9, 0x55, 0x96, 0xf3, 0x79, 0x87, 0x3d, 0x8d, 0xc2,
+  0xf8, 0xfd, 0x2b, 0xcf, 0x3f, 0xa3, 0xef, 0x2f, 0xa0, 0x65, 0x87, 0x35, 0xcf, 0xf8, 0x45, 0xc2,
+  0xd9, 0x8f, 0x2f, 0x9b, 0x1d, 0xf6, 0x36, 0x99, 0x24, 0x79, 0xd2, 0x61, 0x99, 0x17, 0x67, 0xdd,
+  0x8c, 0xa7, 0x61, 0x70, 0x28, 0xa1, 0x4e, 0x00, 0xf3, 0x8b, 0x34, 0x59, 0xc6, 0xd3, 0x03, 0x06,
+  0x40, 0xb8, 0x97, 0x76, 0x2f, 0x52, 0x6f, 0x1a, 0x02, 0x49, 0x5a, 0x83, 0xd1, 0x78, 0xca, 0x2f,
+  0x3a, 0xec, 0xeb, 0xbd, 0xbd, 0x87, 0x9c, 0x7b, 0xac, 0xff, 0x0d, 0x7c, 0x7e, 0xb8, 0xb7, 0x3b,
+  0xf1, 0x86, 0x6c, 0xd0, 0xef, 0x7f, 0xd3, 0x56, 0x40, 0xe6, 0x61, 0xdc, 0x9d, 0xf1, 0xf0, 0x62,
+  0x96, 0x1f, 0xe0, 0x8b, 0x8f, 0x33, 0xf5, 0xa2, 0x98, 0xea, 0xb0, 0xbf, 0xf8, 0xa4, 0x1e, 0xfa,
+  0x49, 0x94, 0xa4, 0x07, 0xec, 0xeb, 0xd1, 0x68, 0x24, 0x1e, 0x89, 0xc9, 0xf6, 0x70, 0x25, 0x3c,
+  0x40, 0x21, 0x25, 0x72, 0x7d, 0x12, 0x6b, 0x70, 0xc0, 0x1e, 0xf5, 0xb1, 0x6f, 0x49, 0x40, 0xe6,
+  0x2d, 0xf3, 0x44, 0x51, 0xa8, 0x87, 0xab, 0x4e, 0x3d, 0x72, 0xfe, 0x29, 0xef, 0x7a, 0x51, 0x78,
+  0x01, 0x6d, 0x7c, 0xc0, 0x9e, 0xa7, 0x87, 0x6a, 0xa4, 0xcb, 0x59, 0x98, 0x73, 0x05, 0x01, 0xe8,
+  0x9b, 0xe7, 0xc9, 0xfc, 0x80, 0x8d, 0x08, 0xac, 0x09, 0x66, 0x36, 0x00, 0x48, 0x44, 0x68, 0x58,
+  0x14, 0x0e, 0x68, 0xf7, 0xc6, 0x7c, 0x5e, 0xe9, 0x39, 0xa0, 0x9e, 0x34, 0x60, 0x36, 0xf3, 0xa6,
+  0xc9, 0x25, 0x34, 0x5c, 0x7c, 0xa2, 0xff, 0x77, 0xe1, 0xff, 0xf4, 0x62, 0xe2, 0xb5, 0xfa, 0x1d,
+  0xfa, 0xd3, 0x1b, 0xb5, 0xed, 0x31, 0x16, 0xe6, 0x10, 0x83, 0xde, 0x00, 0x87, 0x48, 0x16, 0x9e,
+  0x1f, 0xe6, 0xb0, 0xb2, 0xfd, 0xde, 0xa3, 0xa2, 0x87, 0xef, 0xa5, 0xd3, 0x62, 0xfd, 0xf5, 0x95,
+  0x12, 0x33, 0x52, 0x2f, 0x04, 0xdf, 0xe0, 0xaa, 0x2d, 0x33, 0x93, 0xd4, 0x05, 0xfd, 0x47, 0xda,
+  0x43, 0x6b, 0x36, 0x7a, 0x7b, 0x62, 0x47, 0x39, 0xa5, 0x3e, 0xcd, 0x93, 0xed, 0xf6, 0xed, 0x29,
+  0x0d, 0xdb, 0xc6, 0xb2, 0x65, 0xb9, 0x97, 0x2f, 0xb3, 0x6e, 0x9a, 0x5c, 0x16, 0xa8, 0x4e, 0xc3,
+  0x6c, 0x11, 0x79, 0x30, 0x99, 0x20, 0xe2, 0x05, 0x6c, 0x5a, 0x9b, 0x2e, 0xe0, 0x3d, 0xcf, 0x8a,
+  0x15, 0x92, 0xaf, 0xfe, 0xba, 0xcc, 0xf2, 0x30, 0xb8, 0xea, 0xca, 0xbd, 0x78, 0xc0, 0x32, 0xa0,
+  0x06, 0xef, 0x4e, 0x78, 0x7e, 0xc9, 0x79, 0xbc, 0x16, 0x6f, 0x13, 0x91, 0x88, 0x07, 0x39, 0x90,
+  0xd8, 0xc4, 0xc1, 0x39, 0xba, 0xd5, 0x31, 0x8c, 0xa7, 0xa1, 0xef, 0xe5, 0x49, 0x5a, 0x9d, 0x47,
+  0x18, 0xe3, 0xde, 0xe8, 0x4e, 0xa2, 0xc4, 0x7f, 0xaf, 0xd0, 0x91, 0xec, 0x39, 0xd8, 0x2d, 0xc9,
+  0x57, 0xec, 0x81, 0x5d, 0x9d, 0xa4, 0xc6, 0xea, 0x8c, 0xfb, 0xdf, 0x58, 0xf3, 0x49, 0xd5, 0xbe,
+  0x71, 0x4f, 0xa7, 0xc0, 0xaa, 0xe7, 0xf9, 0x79, 0xf8, 0x91, 0x3b, 0xf9, 0xe1, 0xeb, 0x5d, 0xdf,
+  0x0b, 0xc6, 0x7d, 0xf7, 0x32, 0xc2, 0x42, 0x8e, 0x61, 0x0d, 0xad, 0x36, 0x5e, 0x1c, 0xce, 0xbd,
+  0x3c, 0x4c, 0x60, 0xbb, 0x2c, 0x96, 0x51, 0xc6, 0xd9, 0x30, 0x83, 0x69, 0x06, 0x28, 0xf1, 0xf8,
+  0x6a, 0x3c, 0xc2, 0x58, 0x61, 0x62, 0xe2, 0xe0, 0xfb, 0xbe, 0x22, 0xe9, 0xdf, 0xbf, 0xe7, 0x57,
+  0x41, 0x0a, 0x92, 0x36, 0x93, 0xc0, 0x15, 0xd2, 0x28, 0x42, 0x50, 0x74, 0x40, 0xdf, 0x82, 0xe3,
+  0x07, 0xb0, 0x97, 0x52, 0x10, 0x4c, 0x41, 0x92, 0xc2, 0xb2, 0x92, 0xa8, 0x6d, 0x0d, 0x8a, 0x6d,
+  0xc3, 0x90, 0x64, 0x7a, 0xf3, 0x7e, 0xef, 0xa1, 0xab, 0x43, 0xaf, 0xec, 0x62, 0x22, 0x8e, 0xfb,
+  0xd4, 0xde, 0x72, 0x23, 0xdc, 0x72, 0xf4, 0xe4, 0x52, 0x2e, 0xd9, 0x5e, 0xbf, 0x5f, 0xc8, 0x8b,
+  0xaf, 0xc7, 0xe3, 0x71, 0xc1, 0x1c, 0xf3, 0x64, 0x0a, 0x0b, 0xef, 0x4d, 0x2f, 0xdc, 0x94, 0xaf,
+  0x95, 0x99, 0x41, 0xc0, 0x3d, 0xef, 0xa1, 0x90, 0x99, 0xc1, 0xd4, 0x9f, 0xec, 0x71, 0x53, 0x66,
+  0x16, 0x5b, 0x73, 0x1f, 0xd6, 0x06, 0x17, 0x68, 0x83, 0xed, 0xac, 0xcd, 0xa1, 0xdf, 0xdb, 0x47,
+  0xd1, 0xa4, 0xbf, 0xd0, 0xa7, 0x62, 0x89, 0xda, 0xe1, 0x74, 0xb4, 0x3b, 0xda, 0xb3, 0x18, 0x0f,
+  0x37, 0xca, 0x81, 0x36, 0xb4, 0x12, 0x53, 0x61, 0x06, 0xab, 0x7c, 0x75, 0x93, 0x39, 0xef, 0xef,
+  0x06, 0xde, 0xa4, 0x2f, 0xe6, 0xbc, 0x1f, 0x4c, 0x47, 0xc1, 0xee, 0xbf, 0xe2, 0x9c, 0x5d, 0xea,
+  0x25, 0x4d, 0xa2, 0xac, 0xba, 0xbb, 0x2f, 0xd2, 0x70, 0xaa, 0x7a, 0xe3, 0x67, 0x60, 0x99, 0x39,
+  0xbc, 0xc9, 0x39, 0x08, 0xa4, 0x68, 0x39, 0x8f, 0x01, 0xa3, 0x94, 0x2f, 0xb8, 0x97, 0xb7, 0xf6,
+  0x80, 0x7b, 0x83, 0xb4, 0x98, 0xcf, 0x85, 0xb7, 0x00, 0x02, 0x0e, 0x6d, 0xd1, 0x0a, 0x13, 0xc0,
+  0x0d, 0xd7, 0x37, 0x86, 0x9f, 0xe4, 0x71, 0x31, 0x72, 0x41, 0x87, 0x01, 0x11, 0x62, 0x68, 0x13,
+  0xe2, 0x80, 0xc5, 0x49, 0x5c, 0x27, 0xdf, 0xf5, 0xe6, 0x3a, 0x53, 0x8f, 0xac, 0xc7, 0x2e, 0xd2,
+  0x2c, 0xd3, 0x0c, 0x69, 0xb3, 0x48, 0x42, 0x5d, 0xfc, 0xd2, 0x66, 0x0a, 0x85, 0x2c, 0xf0, 0xa2,
+  0x08, 0xe8, 0x3c, 0xca, 0x18, 0xf7, 0x32, 0xee, 0x96, 0x27, 0xbb, 0x72, 0xf1, 0x4c, 0xad, 0x30,
+  0x68, 0xdb, 0xd3, 0x3d, 0x98, 0x25, 0x1f, 0x85, 0x6a, 0x2e, 0x37, 0x2b, 0x7d, 0x44, 0xd2, 0xfe,
+  0x63, 0xab, 0x0b, 0xf3, 0x68, 0x1f, 0x5a, 0xb0, 0xf7, 0x50, 0x8f, 0xba, 0x34, 0x8e, 0x0e, 0xb7,
+  0x10, 0x3f, 0x6e, 0xc0, 0x7d, 0xa3, 0x75, 0x17, 0xc4, 0x40, 0x9a, 0x5b, 0xb2, 0x6a, 0x7b, 0x4b,
+  0xc7, 0xb2, 0x25, 0x0c, 0xf8, 0xc9, 0x62, 0x53, 0xf0, 0x41, 0xff, 0xd1, 0x28, 0x98, 0x48, 0xa1,
+  0x30, 0x1e, 0x3f, 0xdc, 0xf3, 0xd7, 0x82, 0xf7, 0x23, 0x00, 0xb5, 0x31, 0xfc, 0x80, 0xfb, 0xd3,
+  0xa1, 0x84, 0x0f, 0x32, 0xe7, 0x51, 0x60, 0xc1, 0xa7, 0x5d, 0xa1, 0x83, 0x4f, 0xf9, 0x05, 0xec,
+  0x77, 0xbe, 0xf1, 0x08, 0xde, 0x3e, 0x9f, 0x2a, 0x02, 0x05, 0x7c, 0xba, 0xc7, 0x47, 0xeb, 0x46,
+  0x58, 0xa4, 0x09, 0x80, 0x99, 0x6f, 0x31, 0x05, 0xb7, 0xdc, 0xb4, 0x85, 0x99, 0x3e, 0x06, 0xff,
+  0x84, 0xc6, 0xfc, 0xa6, 0x43, 0xd4, 0x8a, 0x29, 0xe7, 0x1c, 0x32, 0xee, 0xe3, 0xd6, 0xd0, 0x6c,
+  0x78, 0x34, 0xa6, 0x34, 0x43, 0xbe, 0x0b, 0x0c, 0x20, 0x65, 0x96, 0xda, 0xab, 0xe2, 0x09, 0xb4,
+  0xca, 0x92, 0x28, 0x9c, 0xe2, 0xba, 0xe3, 0x9f, 0x0a, 0xc8, 0xd9, 0xa8, 0x80, 0x5a, 0x1a, 0x97,
+  0x28, 0x16, 0x4d, 0x4d, 0x54, 0xb5, 0x16, 0x25, 0x9c, 0x94, 0x2c, 0x4a, 0x50, 0xcd, 0x41, 0x52,
+  0x02, 0xa2, 0xb1, 0x49, 0x48, 0x14, 0x50, 0xf6, 0xf7, 0xf7, 0x0f, 0x1d, 0x82, 0xd4, 0x05, 0xa6,
+  0xc7, 0xd3, 0x14, 0x2d, 0xa0, 0xa2, 0xaf, 0xdf, 0x1f, 0x3d, 0x1a, 0x4e, 0x34, 0xd4, 0x23, 0x40,
+  0x5e, 0x58, 0x7b, 0x96, 0x04, 0xad, 0x93, 0x9d, 0x20, 0x31, 0xc9, 0x66, 0x97, 0x86, 0x7b, 0x29,
+  0x34, 0x4d, 0xa3, 0x8c, 0xc7, 0x53, 0xd7, 0x28, 0x61, 0xbc, 0x58, 0xe6, 0xef, 0xf2, 0xab, 0x05,
+  0x78, 0x6d, 0xa8, 0xca, 0x1b, 0xbf, 0x28, 0x65, 0xae, 0x7c, 0xa1, 0x79, 0x12, 0x27, 0x64, 0x30,
+  0x16, 0xdd, 0x3f, 0x2c, 0x39, 0x28, 0xb0, 0x6d, 0x70, 0x94, 0xf2, 0x7d, 0x57, 0xc8, 0xf7, 0x35,
+  0x98, 0x2a, 0xf3, 0xd1, 0x5e, 0xb9, 0xa1, 0xe6, 0x50, 0x94, 0x28, 0x88, 0xb9, 0x74, 0xf4, 0x47,
+  0xfa, 0x9c, 0xe2, 0xe5, 0x7c, 0xc2, 0x53, 0x9a, 0x55, 0xa9, 0x16, 0x86, 0x25, 0x2f, 0x19, 0x7c,
+  0xc4, 0xfb, 0xf8, 0xe7, 0xb0, 0xa2, 0x12, 0x88, 0xf7, 0x74, 0x36, 0x21, 0x26, 0xaa, 0x7a, 0x0c,
+  0x55, 0xec, 0x22, 0x6f, 0xc2, 0x23, 0x6d, 0xb9, 0x6d, 0x86, 0x03, 0x77, 0x44, 0xe3, 0x14, 0x61,
+  0x0c, 0x2d, 0x61, 0xbe, 0x71, 0xb6, 0x2d, 0x6d, 0x47, 0x52, 0x77, 0xea, 0x64, 0x75, 0x99, 0xf4,
+  0xfa, 0xbe, 0xc6, 0xf1, 0x1c, 0x5a, 0x73, 0xec, 0xd6, 0x80, 0xbb, 0x55, 0x3d, 0xaa, 0xd1, 0x4e,
+  0x88, 0xf6, 0x0d, 0x94, 0x6a, 0x8d, 0x96, 0xac, 0x53, 0xaa, 0x2e, 0xed, 0x79, 0xb8, 0xce, 0x67,
+  0x53, 0xe4, 0xd6, 0x91, 0xb2, 0xe6, 0x5d, 0xa8, 0x4f, 0xc3, 0xc8, 0x0e, 0xc6, 0xc1, 0xc3, 0x20,
+  0x38, 0x5c, 0xad, 0x53, 0x2d, 0x48, 0x3d, 0xa7, 0xbd, 0x7e, 0x6b, 0x1d, 0x28, 0x49, 0x68, 0x4d,
+  0x45, 0x0d, 0xbe, 0x48, 0x2e, 0x31, 0x98, 0x71, 0x77, 0xbc, 0xa2, 0xab, 0x14, 0x84, 0xbd, 0x39,
+  0x5f, 0x8c, 0x6f, 0x6c, 0x5f, 0xdd, 0x19, 0x2b, 0xd8, 0xc8, 0x77, 0x23, 0x12, 0x4e, 0x1b, 0xad,
+  0x07, 0xef, 0xfb, 0xa3, 0xc0, 0x17, 0xeb, 0x31, 0xdd, 0xf5, 0xc6, 0xc1, 0x23, 0x5b, 0x5d, 0x8d,
+  0xbd, 0xe1, 0x74, 0x7f, 0x58, 0x25, 0x51, 0x77, 0xce, 0x61, 0x4e, 0x1b, 0xab, 0xde, 0xc9, 0xc3,
+  0x47, 0xbb, 0xc1, 0x9e, 0x18, 0xe8, 0xd1, 0xe4, 0xe1, 0x30, 0x18, 0xaf, 0xb5, 0x4e, 0xc4, 0x30,
+  0x33, 0xa0, 0xc4, 0x17, 0xb4, 0xb0, 0x68, 0x90, 0x2f, 0x62, 0x4d, 0xa2, 0x8b, 0x78, 0x5b, 0xe6,
+  0x1c, 0x6b, 0x82, 0x4c, 0xe8, 0xfd, 0xb1, 0xc6, 0xae, 0x38, 0x02, 0x86, 0xf4, 0xb6, 0x74, 0x1e,
+  0x71, 0x97, 0x4b, 0x22, 0xf9, 0x23, 0x3f, 0xe0, 0xc3, 0x1a, 0x47, 0xca, 0x0c, 0xde, 0xd4, 0xf2,
+  0xb1, 0x23, 0x38, 0x66, 0x7b, 0xca, 0x5d, 0xa9, 0x09, 0xd6, 0xb9, 0x5d, 0xe5, 0x76, 0xdf, 0xab,
+  0x09, 0xcc, 0xec, 0x5b, 0xe3, 0x6a, 0x0b, 0xb6, 0x5c, 0x2c, 0x78, 0xea, 0x6b, 0x9e, 0x45, 0xc4,
+  0x73, 0x40, 0xa6, 0x8b, 0xea, 0x5b, 0x84, 0x44, 0x7b, 0x63, 0x47, 0x18, 0xa4, 0xfb, 0xd1, 0x8b,
+  0x96, 0xdc, 0x0e, 0xcd, 0x0d, 0x2b, 0x4e, 0xfc, 0x24, 0x89, 0xa6, 0x87, 0xac, 0x46, 0x20, 0xe5,
+  0xde, 0x45, 0x57, 0xae, 0xf3, 0xb6, 0x9e, 0x3c, 0xfe, 0x27, 0x2d, 0x52, 0x32, 0xe4, 0xcc, 0xc5,
+  0xb0, 0xe9, 0x3e, 0x76, 0xc4, 0xdf, 0x86, 0xe3, 0x4a, 0xfc, 0xad, 0xe4, 0x15, 0x7d, 0xba, 0x3a,
+  0x96, 0x64, 0x1e, 0x1a, 0x8a, 0xd9, 0x69, 0x2b, 0x1a, 0xe6, 0xe1, 0xb0, 0xd4, 0xd6, 0xb9, 0x37,
+  0x89, 0x90, 0x68, 0x2a, 0x50, 0x05, 0x38, 0xeb, 0x42, 0x3b, 0xf2, 0x16, 0x19, 0x74, 0x51, 0x9f,
+  0x9c, 0xe6, 0x82, 0x35, 0x35, 0x5c, 0x59, 0x86, 0xdb, 0x30, 0x88, 0x70, 0x83, 0xcd, 0xc2, 0xe9,
+  0x94, 0xc7, 0xc5, 0x70, 0x18, 0xdf, 0xfc, 0x32, 0x52, 0x20, 0x9f, 0x39, 0x84, 0x3d, 0xaa, 0xf6,
+  0x7d, 0x37, 0x8b, 0x63, 0x64, 0x63, 0x9d, 0xac, 0xae, 0xd8, 0x38, 0x77, 0xc6, 0xb2, 0xf9, 0xd4,
+  0xb0, 0xe5, 0xfa, 0x12, 0xcf, 0x32, 0xbe, 0x2f, 0x17, 0xaf, 0xea, 0x1e, 0xd4, 0x9a, 0xe8, 0x39,
+  0x65, 0x02, 0xf2, 0xb4, 0xc6, 0x26, 0x78, 0x84, 0x7f, 0x34, 0x23, 0x2d, 0x4e, 0x6c, 0x1b, 0xb9,
+  0x79, 0x9a, 0x2c, 0xd3, 0x10, 0xba, 0xbe, 0xe6, 0x97, 0xcd, 0x0e, 0x7b, 0x95, 0xc4, 0x9e, 0x9f,
+  0x74, 0x1c, 0xa6, 0x73, 0x90, 0x24, 0xf9, 0x76, 0xf1, 0x74, 0xe2, 0x63, 0x11, 0x4c, 0xd7, 0x62,
+  0x74, 0xfb, 0xab, 0xad, 0x48, 0x2f, 0xaa, 0x86, 0x61, 0x74, 0x9d, 0xbc, 0x48, 0x94, 0x1e, 0x0d,
+  0xc2, 0x4f, 0xbc, 0x88, 0xce, 0xfc, 0x0d, 0xc3, 0x90, 0xfc, 0x13, 0x31, 0x73, 0xbf, 0x5c, 0x10,
+  0x8c, 0x63, 0x95, 0x4a, 0x18, 0xf1, 0xe9, 0xdb, 0x51, 0xda, 0x7e, 0x19, 0x77, 0xd5, 0x32, 0x15,
+  0xdf, 0x54, 0x0d, 0x35, 0x65, 0xcf, 0x18, 0x2a, 0x63, 0xdc, 0x76, 0x84, 0x4d, 0x03, 0xf0, 0x9a,
+  0x5e, 0xc6, 0x15, 0x25, 0xaf, 0xc5, 0x3e, 0x65, 0x0b, 0x58, 0x8b, 0x34, 0x99, 0x1b, 0x31, 0x4c,
+  0xa0, 0x05, 0x20, 0x6a, 0x45, 0x41, 0xaf, 0x0d, 0x02, 0xa9, 0x68, 0xf8, 0xfa, 0x04, 0x80, 0xf2,
+  0x4b, 0x07, 0xfd, 0x6f, 0x84, 0xe7, 0x62, 0xef, 0x95, 0xdd, 0xfe, 0x46, 0xa1, 0x36, 0x2d, 0xe9,
+  0x32, 0xee, 0xd7, 0x66, 0x05, 0x48, 0xa1, 0xee, 0xf5, 0x1d, 0x89, 0x8e, 0x2a, 0x89, 0x32, 0x60,
+  0xef, 0x35, 0x34, 0x52, 0x4d, 0x0a, 0xc5, 0x23, 0x48, 0x55, 0xa3, 0xe5, 0xc7, 0x7d, 0x52, 0xf3,
+  0x06, 0x21, 0x8b, 0x75, 0x5f, 0x19, 0x11, 0x32, 0x08, 0xad, 0x4b, 0x5c, 0x41, 0xec, 0x22, 0x8f,
+  0x64, 0x48, 0xd3, 0x71, 0x8d, 0x8a, 0x71, 0xfa, 0x2d, 0xb6, 0xde, 0x71, 0xed, 0x20, 0x63, 0x4c,
+  0x91, 0xde, 0x2b, 0x83, 0x86, 0x32, 0xac, 0xa0, 0x0c, 0x68, 0x8c, 0x9b, 0xf0, 0x2c, 0xeb, 0x4e,
+  0xbc, 0xd2, 0xd6, 0x5d, 0xc1, 0xce, 0x23, 0xdd, 0xcc, 0x35, 0xc4, 0x83, 0x90, 0x2e, 0x35, 0xda,
+  0xea, 0x61, 0xd9, 0xab, 0x22, 0xd9, 0xed, 0xa8, 0x66, 0xbf, 0x8c, 0x6a, 0x9a, 0x5c, 0x11, 0xc6,
+  0x19, 0xcf, 0x91, 0x37, 0xa0, 0xc1, 0xba, 0xc8, 0x60, 0x31, 0xaf, 0x20, 0x8c, 0x4a, 0x29, 0xb0,
+  0x7a, 0x53, 0xde, 0x22, 0x37, 0xa9, 0xdb, 0xe4, 0x44, 0x3d, 0xc3, 0x41, 0xbb, 0x75, 0xa6, 0xca,
+  0x7c, 0x6d, 0x08, 0x48, 0x97, 0x02, 0x22, 0xf6, 0x71, 0x6a, 0xa0, 0xc2, 0xc4, 0x12, 0x64, 0x72,
+  0x85, 0x3d, 0xea, 0x79, 0xc0, 0xe9, 0x02, 0xd5, 0xc7, 0x0f, 0x6a, 0x58, 0xc1, 0x1d, 0x75, 0x1f,
+  0xec, 0xb9, 0x4d, 0x17, 0xbd, 0xb9, 0x4e, 0x64, 0xdd, 0x2d, 0xac, 0x6c, 0xfc, 0xea, 0xb4, 0x0e,
+  0x82, 0xc4, 0x5f, 0xa2, 0x0d, 0x9e, 0x2c, 0x73, 0x5c, 0x64, 0xa9, 0x07, 0xd6, 0x78, 0x97, 0x72,
+  0x03, 0x55, 0xbd, 0x4b, 0x91, 0xed, 0xdb, 0xc4, 0x32, 0x37, 0x41, 0x88, 0x7f, 0x4b, 0x29, 0x14,
+  0x91, 0x96, 0xd9, 0x88, 0xbe, 0xab, 0x7c, 0xc9, 0xf5, 0x24, 0xbd, 0x83, 0x58, 0xbd, 0x2b, 0x7c,
+  0x20, 0xf4, 0x47, 0x10, 0xa6, 0xf3, 0x2f, 0xe8, 0x98, 0x19, 0xe3, 0xb8, 0x1c, 0x34, 0x95, 0x9b,
+  0xeb, 0x0f, 0xdb, 0xae, 0x8e, 0x5e, 0xec, 0x53, 0xf0, 0xc9, 0x25, 0xae, 0x0c, 0x47, 0xa3, 0xae,
+  0xaf, 0xdb, 0x1e, 0x52, 0x51, 0x32, 0xcd, 0xa4, 0xc6, 0xaa, 0x8f, 0xd2, 0xfa, 0xdf, 0xc2, 0x6b,
+  0x00, 0xc9, 0x96, 0xa7, 0x4b, 0x0a, 0xd7, 0xaa, 0x4c, 0xe2, 0x0a, 0xcb, 0x48, 0x20, 0xeb, 0xb4,
+  0xd2, 0x29, 0x81, 0x5c, 0x48, 0xb9, 0x5e, 0x99, 0x60, 0xe4, 0x0b, 0x5f, 0xc3, 0xcc, 0x05, 0xdc,
+  0xd8, 0x75, 0x04, 0xcc, 0xb0, 0x2e, 0x0f, 0xdd, 0xd6, 0xa0, 0xcb, 0x76, 0xd7, 0x86, 0x54, 0x81,
+  0x3f, 0x87, 0xcd, 0xa9, 0x26, 0xf3, 0xe8, 0xd1, 0xa3, 0xca, 0x64, 0xc6, 0x16, 0x18, 0xc3, 0x33,
+  0xab, 0xb1, 0x36, 0x35, 0x2b, 0xb3, 0x6a, 0x13, 0xda, 0x74, 0x77, 0x2c, 0x4d, 0xb1, 0x14, 0x41,
+  0x22, 0x5c, 0x69, 0x73, 0x53, 0xf7, 0x4d, 0x8a, 0x8c, 0x37, 0xa5, 0xc8, 0x40, 0x8f, 0x36, 0x12,
+  0x70, 0xaa, 0xde, 0xb1, 0x69, 0x62, 0x61, 0xb9, 0x57, 0x53, 0x0e, 0x52, 0xcd, 0x26, 0xeb, 0x90,
+  0x0b, 0x5b, 0x6e, 0x2d, 0xbd, 0x2d, 0x3e, 0xd9, 0x73, 0xc5, 0x5e, 0xab, 0xde, 0x50, 0x35, 0x0e,
+  0xb0, 0x45, 0xec, 0xb3, 0xef, 0x36, 0x1c, 0xcc, 0x80, 0xe5, 0xb6, 0xe2, 0x68, 0x6d, 0xd0, 0x41,
+  0x9b, 0xcf, 0xed, 0x43, 0x9d, 0x04, 0xcc, 0xb1, 0x7c, 0x83, 0x8d, 0xa3, 0x04, 0x2b, 0xf8, 0x9c,
+  0x80, 0x4f, 0x79, 0xe6, 0x6f, 0xb0, 0x7c, 0xd8, 0xe5, 0x68, 0x47, 0x16, 0x7f, 0x1d, 0xed, 0x88,
+  0xa2, 0xb4, 0x23, 0xb4, 0xf4, 0xa8, 0x2a, 0x6c, 0x1a, 0x7e, 0x64, 0x7e, 0xe4, 0x65, 0xd9, 0x71,
+  0xa3, 0x28, 0x77, 0x6a, 0x88, 0x2a, 0x31, 0xfd, 0x9d, 0xb0, 0x46, 0xe5, 0x0b, 0x78, 0x35, 0x1b,
+  0xd4, 0xd4, 0x9b, 0xc1, 0x0b, 0xd5, 0x66, 0x71, 0xf2, 0x8a, 0xe7, 0xe0, 0x57, 0xc9, 0x36, 0x2f,
+  0xe3, 0x8f, 0x40, 0xf3, 0x24, 0xbd, 0x62, 0xaf, 0xbc, 0xd8, 0xbb, 0xe0, 0x73, 0xf8, 0x76, 0xb4,
+  0xb3, 0x90, 0x63, 0xed, 0xc0, 0x60, 0xe2, 0x63, 0x65, 0x6c, 0x2c, 0x3a, 0x2a, 0x47, 0xd6, 0x5e,
+  0x94, 0x85, 0x3e, 0xc5, 0x6b, 0x67, 0x03, 0xf4, 0xc7, 0xb4, 0x16, 0x58, 0x0b, 0xb7, 0xf0, 0x62,
+  0xab, 0x51, 0x51, 0x4e, 0xd2, 0x60, 0xe1, 0x54, 0x3d, 0x7d, 0x96, 0x40, 0x47, 0xa0, 0x1e, 0x34,
+  0x5f, 0xd7, 0x9f, 0x8c, 0x07, 0xad, 0xeb, 0x39, 0x7e, 0x3f, 0x79, 0x29, 0xea, 0xf5, 0xa8, 0xa0,
+  0xae, 0xd7, 0xeb, 0xad, 0x01, 0x55, 0x96, 0x76, 0x08, 0x48, 0xf8, 0xfd, 0x29, 0x7d, 0x3d, 0x79,
+  0xb5, 0x8c, 0xf2, 0x70, 0x11, 0x71, 0x1b, 0x82, 0x46, 0xb8, 0xca, 0x9a, 0xe9, 0x75, 0x13, 0x02,
+  0xa0, 0x7c, 0x24, 0x61, 0xf6, 0x19, 0x26, 0xda, 0x32, 0x16, 0x25, 0x17, 0x17, 0x7c, 0x6a, 0x40,
+  0x32, 0xbe, 0x38, 0x48, 0xaf, 0x6a, 0x17, 0x74, 0xc2, 0x4b, 0x51, 0x20, 0x5b, 0x60, 0x79, 0x41,
+  0x91, 0xed, 0x6e, 0xb0, 0x24, 0xf6, 0xa3, 0xd0, 0x7f, 0x4f, 0xd4, 0x49, 0xf3, 0x33, 0xd0, 0x96,
+  0xad, 0x76, 0xe3, 0xe4, 0x8c, 0x52, 0xe1, 0xf8, 0xed, 0x68, 0x47, 0x74, 0xdf, 0x00, 0x5e, 0xb2,
+  0x30, 0xc0, 0x25, 0x8b, 0x12, 0x5a, 0xb2, 0xd8, 0x0e, 0x18, 0xe5, 0xb2, 0x35, 0x68, 0xf4, 0xfd,
+  0xdc, 0xbb, 0xc8, 0x10, 0xdc, 0x29, 0x7e, 0xd9, 0x18, 0x94, 0xca, 0x5b, 0xdb, 0x53, 0x7d, 0x4b,
+  0xcf, 0x53, 0xf2, 0x3f, 0x11, 0xea, 0x5b, 0xd9, 0x6e, 0x63, 0xc0, 0x32, 0x5d, 0xad, 0xc3, 0x9d,
+  0x25, 0x97, 0x6f, 0xc4, 0xd3, 0x67, 0xc0, 0x5c, 0xc9, 0x05, 0xc2, 0x95, 0x0f, 0x18, 0x60, 0xbf,
+  0x31, 0x68, 0x91, 0xa5, 0xb6, 0x20, 0x3f, 0xa7, 0x87, 0x25, 0x60, 0xf1, 0x9d, 0x9d, 0x9e, 0xfd,
+  0x64, 0xc3, 0x5d, 0xc7, 0x24, 0x32, 0xab, 0xac, 0xf3, 0xc8, 0x6c, 0x04, 0x04, 0x20, 0xc7, 0xf6,
+  0x15, 0xf0, 0x36, 0x88, 0x8b, 0x91, 0x9b, 0x77, 0xf5, 0xbc, 0x9e, 0xb9, 0x75, 0x2b, 0x33, 0xa1,
+  0x8c, 0x52, 0xb9, 0x5f, 0xce, 0x60, 0xa7, 0x45, 0x5c, 0x9f, 0x13, 0xcf, 0x71, 0xac, 0x56, 0x33,
+  0xa3, 0x37, 0x4d, 0x64, 0x14, 0xfa, 0x74, 0x34, 0x49, 0x4f, 0x8e, 0xb2, 0x39, 0x68, 0x89, 0x13,
+  0x30, 0x98, 0x19, 0x49, 0x79, 0xb6, 0x00, 0xd4, 0x88, 0x2b, 0x61, 0xa3, 0xd1, 0xab, 0x2a, 0x31,
+  0x37, 0x40, 0x42, 0xed, 0x56, 0x17, 0x1a, 0x73, 0xf9, 0x0e, 0x11, 0x29, 0x76, 0x75, 0x89, 0x0a,
+  0xee, 0xac, 0x30, 0x5e, 0x26, 0xcb, 0xec, 0x56, 0x18, 0x9c, 0x8a, 0x0d, 0x1a, 0xf1, 0xa9, 0x0b,
+  0x07, 0xbf, 0x78, 0x8b, 0x58, 0x94, 0x6d, 0x0d, 0x92, 0xec, 0x24, 0x41, 0xc0, 0xa6, 0xcb, 0xfc,
+  0x8a, 0xf9, 0x57, 0x3e, 0x49, 0x9e, 0x1a, 0x74, 0xb6, 0x92, 0x1c, 0x6e, 0xa6, 0x78, 0xfe, 0xe6,
+  0x94, 0xbd, 0x08, 0x23, 0xda, 0x17, 0x75, 0x3c, 0x51, 0xe6, 0xe0, 0x4d, 0x8e, 0x20, 0x17, 0x8e,
+  0x69, 0x2e, 0x9c, 0x90, 0xc2, 0xd4, 0xfa, 0x4d, 0xca, 0x83, 0xf0, 0x53, 0x03, 0x23, 0x49, 0x11,
+  0x8f, 0x2f, 0xf2, 0xd9, 0x71, 0x63, 0xb8, 0xdb, 0x60, 0x60, 0xdb, 0xfa, 0x7c, 0x06, 0x6a, 0x97,
+  0xa7, 0xc7, 0x0d, 0x1c, 0x7b, 0x41, 0xed, 0x58, 0x6b, 0xc6, 0x3f, 0xb5, 0x3b, 0x8c, 0xf7, 0x2e,
+  0x7a, 0xec, 0xf9, 0x70, 0xbf, 0xbf, 0xf7, 0x68, 0x30, 0x5e, 0xc3, 0x7e, 0x4e, 0x21, 0x87, 0xc5,
+  0xd0, 0x57, 0x67, 0x84, 0x01, 0x6e, 0xa1, 0x27, 0xf8, 0x75, 0xb3, 0x65, 0xac, 0x17, 0x4b, 0x25,
+  0xb8, 0x3a, 0xc1, 0x54, 0xaf, 0x0a, 0xb4, 0x82, 0x0a, 0x9d, 0x3a, 0x2f, 0xf1, 0xfb, 0xc9, 0x13,
+  0x30, 0x93, 0xc0, 0x25, 0xc9, 0x98, 0x97, 0x72, 0xd2, 0x08, 0x77, 0xb0, 0x9e, 0x85, 0xb2, 0xaf,
+  0x5f, 0xce, 0x22, 0xe5, 0x6f, 0xa9, 0x66, 0xc2, 0x8c, 0x90, 0xa4, 0x16, 0x3f, 0x90, 0x02, 0xa6,
+  0x87, 0x46, 0x3b, 0x72, 0x17, 0x4e, 0x8c, 0xc5, 0xf7, 0x67, 0xdc, 0x7f, 0x0f, 0xf6, 0x78, 0xa3,
+  0xec, 0xfd, 0x64, 0x99, 0xc3, 0x0c, 0x19, 0xfe, 0xc3, 0x7e, 0x38, 0xda, 0x11, 0x9d, 0x56, 0x0d,
+  0x77, 0xc6, 0xb3, 0xcc, 0x9c, 0x0e, 0x35, 0x4b, 0x16, 0x54, 0x1f, 0x43, 0xce, 0xc5, 0x71, 0xa3,
+  0x0f, 0x22, 0xa4, 0x7f, 0xb4, 0x23, 0x1e, 0x9e, 0x58, 0x2f, 0x07, 0xf0, 0x72, 0x50, 0xf7, 0x72,
+  0x08, 0x2f, 0x87, 0x75, 0x2f, 0x47, 0xf0, 0x72, 0x54, 0xbc, 0xd4, 0xb1, 0x74, 0x11, 0xc0, 0xc6,
+  0xfc, 0x1c, 0xec, 0x45, 0x8e, 0xe6, 0x8a, 0x09, 0xf4, 0x49, 0xe3, 0x44, 0xbc, 0x61, 0x4f, 0xea,
+  0xc6, 0x7d, 0x5a, 0x34, 0x79, 0x5a, 0x36, 0x71, 0x0d, 0xb9, 0x05, 0xf3, 0xff, 0x80, 0x28, 0xad,
+  0xe0, 0xfd, 0x15, 0xcc, 0xba, 0x9e, 0x31, 0xd2, 0x00, 0xb5, 0x28, 0xac, 0x12, 0x0e, 0x3a, 0xf3,
+  0xe2, 0x0b, 0x98, 0x04, 0x06, 0xef, 0x4e, 0xe1, 0x73, 0xcc, 0x23, 0xd2, 0xde, 0xeb, 0x68, 0x96,
+  0x06, 0xb2, 0x75, 0x5d, 0x53, 0x34, 0xb3, 0xa4, 0xb5, 0x65, 0x7c, 0xb9, 0x21, 0x41, 0xde, 0x06,
+  0x37, 0xa3, 0x46, 0x65, 0xeb, 0x12, 0x79, 0xc4, 0xce, 0xfd, 0xd9, 0x03, 0xeb, 0x32, 0xbe, 0x00,
+  0x1f, 0x20, 0xc5, 0x6c, 0x17, 0x13, 0x6d, 0xc9, 0xce, 0xbc, 0xf5, 0x0e, 0x7e, 0x43, 0x25, 0x0d,
+  0xdf, 0xf1, 0x8f, 0xe0, 0x94, 0x4b, 0x05, 0x51, 0xbf, 0x97, 0x8d, 0xda, 0x8a, 0x75, 0xfa, 0x5a,
+  0x14, 0x4b, 0x18, 0x95, 0x07, 0xa6, 0x8e, 0xa2, 0xa1, 0x5b, 0xc3, 0x7e, 0xbf, 0x0f, 0x14, 0xfb,
+  0x2e, 0xb9, 0xd4, 0xb4, 0xd2, 0xb0, 0xcf, 0xa6, 0x4f, 0xe7, 0x5b, 0x6a, 0x46, 0x7b, 0x40, 0x51,
+  0x84, 0xe0, 0x1c, 0x73, 0x8f, 0xc6, 0x7c, 0x45, 0x0d, 0xf4, 0x61, 0xf7, 0xee, 0x60, 0x58, 0x2c,
+  0x4a, 0x70, 0x0d, 0x3a, 0x12, 0x13, 0x7d, 0xe5, 0x7d, 0x0a, 0xe7, 0xc6, 0xa8, 0xa3, 0x35, 0x93,
+  0xdd, 0x68, 0x0f, 0x31, 0x72, 0xfd, 0xc0, 0x28, 0xb0, 0x63, 0x36, 0xf5, 0x4a, 0x54, 0x56, 0x80,
+  0x09, 0x45, 0x71, 0xc9, 0xf9, 0xe2, 0x45, 0x9a, 0x00, 0xb9, 0x94, 0x7c, 0x1b, 0x37, 0xf0, 0x7c,
+  0xcd, 0x71, 0x63, 0x4c, 0x6a, 0x15, 0xc4, 0xd6, 0x08, 0x07, 0xe1, 0x0b, 0x90, 0x8b, 0x3d, 0x78,
+  0x46, 0x4e, 0xef, 0x71, 0x03, 0xfb, 0xb0, 0x16, 0xe0, 0xdf, 0xde, 0x62, 0xa0, 0xf3, 0xa4, 0x18,
+  0x66, 0xd4, 0xdf, 0x68, 0x98, 0xf3, 0x64, 0xeb, 0x41, 0xce, 0x00, 0x48, 0x39, 0x1b, 0x39, 0x0a,
+  0xc1, 0xac, 0x82, 0xc7, 0xb6, 0x38, 0xc0, 0x36, 0xf0, 0x9f, 0x5d, 0xf2, 0x28, 0x2a, 0xe7, 0xa1,
+  0x0f, 0x40, 0x13, 0xd9, 0xeb, 0xbb, 0x46, 0xa2, 0x5e, 0x64, 0x7e, 0x46, 0xb4, 0xe7, 0x5a, 0x59,
+  0x7b, 0x0b, 0xcb, 0xa3, 0x18, 0xfc, 0x29, 0xb5, 0xd2, 0xd8, 0x2c, 0x07, 0xe7, 0x2e, 0xe2, 0x67,
+  0xf8, 0x8e, 0x7c, 0x24, 0xfc, 0x70, 0x4b, 0xdb, 0x01, 0x41, 0x08, 0x01, 0x44, 0xd0, 0x0e, 0x28,
+  0x45, 0xd6, 0xc1, 0x7c, 0x97, 0x07, 0x16, 0x34, 0x4e, 0x8d, 0x85, 0x31, 0xb2, 0x6e, 0x87, 0x4d,
+  0x69, 0x56, 0xf0, 0x0d, 0x84, 0x4c, 0x12, 0x4f, 0xb3, 0xad, 0x58, 0xb6, 0xa6, 0xea, 0x85, 0x4a,
+  0x37, 0x5d, 0xf5, 0x91, 0x8d, 0xed, 0x0c, 0x04, 0xda, 0x95, 0xba, 0x81, 0x40, 0x0f, 0x5c, 0x46,
+  0x42, 0xdd, 0x72, 0x53, 0x07, 0x10, 0x50, 0x6f, 0xc1, 0x66, 0x90, 0xcb, 0xdc, 0x1d, 0xf4, 0xfb,
+  0x72, 0x9d, 0xbb, 0xc3, 0x7e, 0xb1, 0xba, 0x3f, 0x73, 0xef, 0x3d, 0xcf, 0x00, 0x06, 0x58, 0x45,
+  0x33, 0x96, 0x04, 0x2c, 0xb9, 0x8c, 0xa5, 0xd1, 0x95, 0xc3, 0x82, 0x7b, 0xf0, 0x6a, 0x0b, 0x36,
+  0xa6, 0x71, 0xbf, 0x05, 0x71, 0x72, 0xcb, 0x81, 0xe7, 0xc9, 0x0d, 0xc6, 0x7d, 0x15, 0xc6, 0xe8,
+  0x21, 0x2b, 0xb6, 0x2e, 0x46, 0xfa, 0xbe, 0x3a, 0xa3, 0x3e, 0x3b, 0x06, 0x96, 0xb8, 0xda, 0x0a,
+  0xba, 0xf7, 0xc9, 0x09, 0xfd, 0x5c, 0x43, 0xb9, 0xc3, 0xfc, 0x34, 0xc9, 0xb2, 0xae, 0x88, 0x5e,
+  0x84, 0xc0, 0xe9, 0xcb, 0x29, 0x9f, 0xd6, 0x0d, 0xb7, 0x85, 0x8e, 0x26, 0x79, 0x2c, 0x95, 0xdd,
+  0x1d, 0x69, 0xeb, 0x85, 0x06, 0x52, 0x9a, 0xdb, 0x05, 0xab, 0x1d, 0xb0, 0xb7, 0x67, 0x67, 0x2f,
+  0xd9, 0x04, 0x77, 0x8d, 0xda, 0x30, 0x40, 0x41, 0xe6, 0x83, 0x27, 0x9a, 0x67, 0xe5, 0x7c, 0xb6,
+  0x19, 0x4f, 0x3c, 0xb8, 0x53, 0xf3, 0x00, 0x4b, 0xd2, 0x56, 0x04, 0xd8, 0x30, 0x02, 0x6e, 0x52,
+  0xdc, 0x6e, 0x40, 0x1b, 0xaa, 0x71, 0xf2, 0x63, 0x1c, 0xc2, 0x1e, 0x67, 0x4f, 0x93, 0x1c, 0x56,
+  0xd4, 0x96, 0x04, 0x8e, 0x6e, 0x24, 0x40, 0xc5, 0xac, 0x80, 0x2a, 0xa7, 0x48, 0x94, 0xc6, 0x49,
+  0xdf, 0x26, 0x46, 0x3d, 0x6d, 0xb6, 0x42, 0x0e, 0x1c, 0xc5, 0x8c, 0x02, 0x92, 0x5b, 0x60, 0xb5,
+  0x10, 0x7d, 0xbe, 0x34, 0x66, 0x64, 0x46, 0xd0, 0x2e, 0xdd, 0x0e, 0x3b, 0xec, 0xf7, 0x4c, 0xe4,
+  0x71, 0x1a, 0x60, 0x4b, 0xf4, 0x56, 0x22, 0xb8, 0x8e, 0x0b, 0xb4, 0x32, 0xb0, 0xaa, 0xa1, 0x68,
+  0x84, 0x77, 0x1d, 0x56, 0xa2, 0x94, 0xe7, 0x2a, 0x9d, 0xdf, 0xfd, 0x74, 0xe0, 0x12, 0xd8, 0x54,
+  0x1e, 0x66, 0xf9, 0x5d, 0xb9, 0x3a, 0x44, 0x6d, 0x3e, 0x4d, 0xed, 0x47, 0xd4, 0x54, 0x8d, 0x23,
+  0xf3, 0xd1, 0x54, 0x64, 0xd2, 0x38, 0x79, 0x9d, 0x00, 0xbf, 0xe7, 0x33, 0x67, 0x8f, 0x13, 0xc1,
+  0x8c, 0xec, 0xb5, 0x37, 0xe7, 0xf5, 0x8d, 0x9e, 0xbf, 0x39, 0xad, 0x7d, 0x69, 0x8d, 0xb9, 0x5f,
+  0x9e, 0xc4, 0x95, 0x89, 0x06, 0x3a, 0x4d, 0x09, 0x68, 0xe0, 0x56, 0xdf, 0x14, 0xca, 0x5e, 0x2d,
+  0x94, 0xd3, 0xd7, 0xe7, 0x2e, 0x20, 0xf0, 0xcc, 0x22, 0x09, 0xb6, 0xaa, 0x90, 0xee, 0x48, 0x94,
+  0x6d, 0xc9, 0x1d, 0x75, 0x8e, 0xf4, 0x7e, 0x0a, 0x0f, 0x1a, 0x2e, 0x02, 0x1f, 0xe5, 0x53, 0x4c,
+  0x24, 0xa0, 0xcb, 0x43, 0x36, 0x98, 0xc4, 0xd0, 0x95, 0x0e, 0x34, 0x93, 0x3e, 0x46, 0xfa, 0x01,
+  0xc9, 0xcf, 0x26, 0x62, 0xc7, 0xb3, 0x29, 0xcf, 0xc1, 0xd5, 0xe0, 0x53, 0x92, 0x40, 0xf9, 0xf4,
+  0xc4, 0x89, 0xb5, 0xca, 0x4c, 0x68, 0x8f, 0x4c, 0xbe, 0xa8, 0x63, 0xdb, 0x55, 0x29, 0x04, 0x51,
+  0x44, 0xd6, 0xd0, 0x52, 0x13, 0xcf, 0xcf, 0xde, 0x8c, 0x86, 0xcc, 0x95, 0xc3, 0x60, 0xe2, 0xcc,
+  0x3a, 0xbb, 0x3f, 0x59, 0x46, 0xd1, 0x21, 0x9b, 0xe5, 0xf9, 0xe2, 0x60, 0x67, 0x67, 0xf0, 0x68,
+  0xd8, 0x1b, 0xec, 0xed, 0xf7, 0x46, 0xbb, 0xbd, 0xc1, 0x68, 0xb7, 0x9a, 0xb7, 0x28, 0x3e, 0xe0,
+  0xe7, 0x7b, 0xdd, 0x2e, 0xd3, 0xe3, 0xbe, 0x18, 0xec, 0xf4, 0x22, 0xd6, 0xed, 0x16, 0x29, 0x17,
+  0x21, 0xaa, 0xcb, 0x16, 0xd4, 0xa0, 0xa1, 0x45, 0x3f, 0xe1, 0x5b, 0x35, 0x0b, 0x63, 0x94, 0x61,
+  0x39, 0x53, 0x22, 0x7a, 0xed, 0x50, 0x19, 0x6b, 0xc6, 0xb4, 0xa7, 0x94, 0xbb, 0x26, 0xf5, 0x2a,
+  0x3d, 0x27, 0x26, 0x3b, 0x14, 0xb8, 0xa2, 0x51, 0xf7, 0x8c, 0x96, 0x0f, 0x28, 0x54, 0x30, 0x83,
+  0x2a, 0x72, 0x10, 0xc7, 0x90, 0xcd, 0xdd, 0xbc, 0x50, 0x80, 0xed, 0x84, 0x35, 0x48, 0x34, 0x8c,
+  0xbe, 0x91, 0x46, 0x22, 0xfa, 0x93, 0xca, 0x8b, 0x92, 0x8c, 0xa3, 0x05, 0x59, 0xea, 0x29, 0x74,
+  0x84, 0x50, 0x33, 0x1e, 0x41, 0xf7, 0x24, 0xbe, 0x38, 0xc1, 0x70, 0x1d, 0x0b, 0x73, 0xb4, 0x2f,
+  0xbd, 0xe9, 0x15, 0xa6, 0xb4, 0xe8, 0x31, 0x03, 0xe1, 0x1b, 0x46, 0x4c, 0xe6, 0xfc, 0x25, 0x73,
+  0x2d, 0xea, 0x84, 0xa4, 0x5e, 0xc3, 0x64, 0xc7, 0x78, 0x5c, 0xcd, 0x30, 0xaa, 0xa0, 0x84, 0xbd,
+  0x78, 0xf4, 0x14, 0x23, 0x73, 0xe6, 0x76, 0xed, 0x7f, 0x03, 0x73, 0x17, 0x89, 0x1c, 0xbd, 0xa5,
+  0xc8, 0x00, 0xf5, 0x77, 0xc6, 0x2a, 0x8a, 0x50, 0x91, 0xde, 0xab, 0xc4, 0xb9, 0x96, 0x85, 0x5f,
+  0x81, 0x68, 0x91, 0x38, 0x6f, 0x9c, 0x3c, 0x93, 0xbb, 0x0b, 0x33, 0x00, 0x07, 0x15, 0xd0, 0xd5,
+  0x6e, 0x9a, 0xaa, 0x50, 0x1b, 0x13, 0x04, 0x5d, 0x61, 0x35, 0xd8, 0x66, 0x82, 0x4b, 0xa5, 0x39,
+  0x34, 0x9c, 0x62, 0x16, 0x90, 0xa8, 0x2e, 0x4e, 0xa1, 0xd2, 0x94, 0x4d, 0x19, 0xc5, 0x72, 0x5d,
+  0x8d, 0xf2, 0x85, 0xc6, 0xc9, 0xaf, 0xff, 0xf2, 0x9f, 0x71, 0xaa, 0x85, 0x54, 0x61, 0xd9, 0xd2,
+  0xf7, 0x81, 0xec, 0x01, 0x6c, 0xdb, 0xab, 0x7b, 0xc8, 0x3d, 0x7f, 0xc4, 0x33, 0x26, 0xc0, 0x31,
+  0xe2, 0x8e, 0x8d, 0x03, 0x9b, 0x2d, 0x16, 0x75, 0xf0, 0x2b, 0x52, 0xcc, 0x95, 0x64, 0x75, 0x08,
+  0x42, 0xcc, 0x95, 0x78, 0xe0, 0xad, 0x70, 0x70, 0x52, 0x1a, 0xe7, 0xe1, 0xde, 0x2e, 0x7b, 0xea,
+  0xe5, 0xfe, 0x8c, 0x7d, 0xbd, 0x3b, 0x6c, 0x74, 0x58, 0xe3, 0x49, 0x74, 0x16, 0x0e, 0xfa, 0xaf,
+  0x2e, 0x40, 0x4c, 0x0e, 0x77, 0xbb, 0xfd, 0x61, 0xc3, 0x46, 0xc8, 0x1d, 0xc8, 0x16, 0xd2, 0x13,
+  0x35, 0x94, 0x1d, 0xb7, 0xc6, 0x41, 0xa5, 0x70, 0xa5, 0x19, 0xc2, 0x92, 0x19, 0x91, 0xee, 0x71,
+  0xbf, 0xb1, 0x09, 0x77, 0x6d, 0x16, 0x21, 0xa8, 0xe5, 0x3b, 0x5c, 0x83, 0x97, 0xcf, 0xb6, 0xe4,
+  0xb8, 0x20, 0x8c, 0xbd, 0x88, 0xd8, 0xad, 0xbb, 0x15, 0x97, 0xad, 0x13, 0x5f, 0x95, 0x08, 0x94,
+  0x3b, 0x51, 0x52, 0xd4, 0xeb, 0xe8, 0x41, 0x76, 0x7a, 0x60, 0xa7, 0xeb, 0x4e, 0xe9, 0xe9, 0x26,
+  0x19, 0x35, 0xb3, 0xf8, 0x48, 0x4c, 0x53, 0x7e, 0xa9, 0x38, 0xe5, 0xf2, 0xb9, 0x35, 0x58, 0xcd,
+  0x66, 0x39, 0xf3, 0x3e, 0xf2, 0x42, 0x7a, 0xd7, 0x66, 0xe0, 0xea, 0x35, 0xd1, 0xe9, 0xd9, 0x4f,
+  0x4c, 0x26, 0xf1, 0x9c, 0x7a, 0x48, 0x64, 0x01, 0xbf, 0x8c, 0x06, 0x92, 0xe3, 0x9e, 0xa3, 0x0b,
+  0xfa, 0xcc, 0xcb, 0xbd, 0x2d, 0xd5, 0xcf, 0x0a, 0x25, 0x82, 0x1b, 0x82, 0x5d, 0x25, 0x4b, 0x70,
+  0x6d, 0x10, 0x78, 0x26, 0xe2, 0xf6, 0xa8, 0x42, 0xc2, 0x29, 0xe0, 0x16, 0x06, 0x57, 0xa0, 0x4b,
+  0x42, 0x30, 0x3a, 0x60, 0x54, 0x26, 0xa6, 0x68, 0xec, 0xb7, 0x2f, 0xbc, 0xfd, 0x29, 0x70, 0xda,
+  0x1d, 0x74, 0x5f, 0x80, 0x92, 0xca, 0x71, 0xf7, 0x8b, 0x07, 0xc3, 0xee, 0x53, 0xb0, 0x32, 0xcc,
+  0x9d, 0x5f, 0xb3, 0xef, 0x71, 0x5a, 0xdf, 0x25, 0x3e, 0x31, 0x87, 0xb5, 0xf3, 0x31, 0x3f, 0xd5,
+  0x61, 0xc6, 0x10, 0xdd, 0xb3, 0x19, 0x8f, 0x82, 0xfa, 0xed, 0xaf, 0xd3, 0x5a, 0xd5, 0x2d, 0xd5,
+  0x4a, 0x87, 0xb2, 0xf6, 0xa8, 0x58, 0xc1, 0xcb, 0x90, 0xe2, 0x38, 0xe4, 0x6a, 0x1f, 0xac, 0x54,
+  0x5c, 0x7a, 0x79, 0x91, 0x25, 0x41, 0x7e, 0xfd, 0xf7, 0xff, 0x83, 0x3d, 0x07, 0x27, 0xe0, 0x8a,
+  0x89, 0x5c, 0x2c, 0xa9, 0x7e, 0xd4, 0xf6, 0x00, 0x1e, 0x8c, 0xe0, 0x3c, 0x9c, 0xc3, 0x9c, 0x81,
+  0x84, 0x28, 0xbc, 0x2b, 0x1d, 0xc9, 0x57, 0x16, 0xd5, 0x5d, 0xe8, 0xd0, 0x72, 0x0f, 0x24, 0x2b,
+  0x65, 0xab, 0x5c, 0x8d, 0xdf, 0x80, 0xa7, 0x81, 0x91, 0x7e, 0x6c, 0xe9, 0x81, 0xa8, 0xb9, 0xc2,
+  0x02, 0x0c, 0x18, 0xf5, 0x02, 0x3e, 0xb3, 0x20, 0x02, 0x4e, 0x5a, 0x12, 0x61, 0x9d, 0x9d, 0x4f,
+  0x97, 0x69, 0x8a, 0xb5, 0x51, 0xa2, 0x2e, 0x42, 0x14, 0x49, 0x1c, 0x28, 0x3b, 0x44, 0xdb, 0x32,
+  0x98, 0xc9, 0x2e, 0x9d, 0x3f, 0x69, 0x8f, 0xfc, 0x5e, 0x04, 0x99, 0x58, 0xb7, 0xdb, 0x89, 0x30,
+  0x5b, 0x5e, 0x95, 0x30, 0x9f, 0x25, 0x97, 0x71, 0x94, 0xc0, 0xc2, 0xad, 0x2e, 0x0b, 0xa8, 0x17,
+  0x4a, 0xb2, 0x5c, 0x01, 0x8d, 0x04, 0xb7, 0x54, 0x92, 0x65, 0x0f, 0x5f, 0x46, 0x2c, 0xa9, 0x62,
+  0x09, 0xb4, 0x8b, 0xa9, 0x60, 0xe2, 0xc6, 0x46, 0xf1, 0xe9, 0x2c, 0x01, 0xcb, 0xf5, 0x15, 0xe5,
+  0xde, 0x6f, 0x67, 0x15, 0x0b, 0x48, 0x6c, 0x96, 0x5c, 0xa2, 0x10, 0x53, 0x97, 0x14, 0x08, 0x09,
+  0x47, 0x16, 0x5d, 0xd5, 0xa8, 0xb5, 0x06, 0x54, 0x87, 0x05, 0x6b, 0x6a, 0x8d, 0xfb, 0xab, 0x55,
+  0xba, 0x56, 0x72, 0x61, 0x64, 0x29, 0x30, 0x33, 0x86, 0x31, 0x2b, 0xaa, 0x1c, 0x68, 0x57, 0x7d,
+  0x45, 0x1b, 0x84, 0x94, 0x1b, 0xff, 0xef, 0xbf, 0xfd, 0xc7, 0xff, 0x29, 0xc2, 0xaa, 0x7f, 0xe4,
+  0x31, 0x07, 0x1d, 0xc7, 0x1d, 0x16, 0x82, 0xa3, 0x3b, 0x96, 0xb5, 0x01, 0x31, 0x60, 0xd3, 0xe5,
+  0xe0, 0x09, 0x80, 0x03, 0x90, 0xcc, 0xc1, 0xc4, 0xa7, 0xc8, 0x11, 0x26, 0xea, 0x31, 0x6e, 0x80,
+  0x87, 0x39, 0x7c, 0x2f, 0xc2, 0xd0, 0x5c, 0xd5, 0xe6, 0x58, 0x6d, 0x86, 0xac, 0x9a, 0xe4, 0x2b,
+  0x2f, 0x5e, 0x7a, 0xd1, 0x96, 0xd3, 0xfc, 0xf5, 0x5f, 0xfe, 0xf9, 0xff, 0xfe, 0xef, 0x7f, 0x66,
+  0xa2, 0x2f, 0x03, 0x93, 0x2c, 0xbd, 0xda, 0x66, 0x9e, 0xc2, 0x86, 0xf3, 0x97, 0x19, 0xcc, 0x8a,
+  0xe6, 0xd7, 0x1a, 0xee, 0xb2, 0x19, 0xff, 0x44, 0xd7, 0xc5, 0x79, 0x60, 0xd6, 0xa6, 0x59, 0x7b,
+  0x93, 0x59, 0x6e, 0x61, 0x99, 0x0b, 0x54, 0x09, 0xd3, 0xdb, 0x99, 0xe7, 0x12, 0x79, 0x8f, 0x81,
+  0x35, 0x5b, 0xa0, 0x4b, 0xc8, 0xc3, 0x44, 0x7e, 0x43, 0x6b, 0xfb, 0xa0, 0x28, 0xd5, 0xe8, 0xc3,
+  0x7f, 0xf0, 0xd7, 0xe0, 0xc9, 0x93, 0xe7, 0x7b, 0xa3, 0x47, 0x7b, 0xa7, 0x9b, 0x19, 0xd8, 0x73,
+  0x41, 0x10, 0x30, 0x46, 0x5d, 0xf6, 0x75, 0x65, 0x3d, 0x6c, 0x2b, 0x1b, 0xeb, 0x49, 0xf4, 0xe0,
+  0x88, 0xf3, 0xa8, 0x5e, 0xdd, 0x05, 0x11, 0x8d, 0xba, 0x3d, 0xbd, 0x65, 0x89, 0x75, 0x10, 0x8c,
+  0xfc, 0xa9, 0xbb, 0xc4, 0x7a, 0x45, 0x81, 0xe8, 0xfe, 0x78, 0x6f, 0xb7, 0xbf, 0x6b, 0x0b, 0x85,
+  0x5f, 0xff, 0xeb, 0x7f, 0x47, 0x96, 0x46, 0x6e, 0x9c, 0x03, 0x63, 0xb2, 0x09, 0x07, 0xfb, 0x09,
+  0xe6, 0x1e, 0x5d, 0x21, 0x31, 0x4a, 0x42, 0xb0, 0x56, 0xbf, 0xfb, 0xa8, 0xc3, 0x9e, 0x74, 0x5f,
+  0xb4, 0x6f, 0xc6, 0x89, 0x9a, 0x0e, 0xb8, 0x25, 0x27, 0x8a, 0x88, 0x82, 0x57, 0xc4, 0x0a, 0x26,
+  0x91, 0x17, 0xbf, 0x47, 0xb1, 0x59, 0x86, 0x09, 0x5a, 0x7d, 0xfa, 0x0f, 0x56, 0xaf, 0xcd, 0xf0,
+  0xc0, 0x81, 0x23, 0xd2, 0x40, 0x11, 0x06, 0x11, 0x5e, 0xf8, 0xa2, 0x51, 0x04, 0x6f, 0xfe, 0x66,
+  0xbb, 0x60, 0x42, 0xd9, 0x41, 0xc4, 0x14, 0x74, 0x17, 0xfd, 0xb7, 0x08, 0x2d, 0xc8, 0xea, 0x10,
+  0xb1, 0xad, 0xb7, 0x71, 0xf3, 0x72, 0xea, 0xb8, 0x99, 0x9f, 0x57, 0xd5, 0xfd, 0x67, 0x54, 0x48,
+  0x5b, 0xef, 0x9f, 0x3a, 0xcf, 0x26, 0xac, 0xaf, 0xac, 0x6e, 0x9c, 0xfc, 0xab, 0x1a, 0x66, 0x92,
+  0xeb, 0x6f, 0xef, 0x5c, 0x4a, 0x2a, 0x55, 0x9c, 0x4b, 0x4a, 0x6d, 0x69, 0x7b, 0xab, 0xde, 0xb3,
+  0x5c, 0x51, 0x33, 0xba, 0xd6, 0x88, 0xcb, 0xfc, 0x34, 0x5c, 0xc8, 0x92, 0x99, 0x08, 0x98, 0x43,
+  0x8f, 0x66, 0xa2, 0xe8, 0x38, 0x66, 0xcd, 0xe6, 0x61, 0xf1, 0xd6, 0x17, 0x26, 0x35, 0x0c, 0x84,
+  0x5e, 0x20, 0xbc, 0x7c, 0xf7, 0x4b, 0xf9, 0x52, 0x70, 0x89, 0x44, 0xa6, 0xda, 0xb7, 0xb4, 0x04,
+  0x39, 0xbe, 0x41, 0x0b, 0xa0, 0xfa, 0xf6, 0x67, 0x8c, 0xb4, 0xa0, 0x31, 0x79, 0xcc, 0x02, 0x2f,
+  0x42, 0x89, 0xcb, 0x76, 0x76, 0x40, 0x22, 0xc8, 0xd7, 0x3b, 0xe2, 0xd2, 0x2d, 0xf0, 0x07, 0xc1,
+  0x9e, 0xca, 0xd0, 0xc0, 0x0a, 0x92, 0x08, 0xaf, 0xbc, 0x10, 0xd1, 0xc3, 0x29, 0x16, 0x80, 0x82,
+  0xab, 0x10, 0x78, 0x61, 0xc4, 0xa7, 0x05, 0x6c, 0x51, 0xc9, 0x7d, 0xc6, 0x3f, 0x00, 0xd4, 0xfe,
+  0xa1, 0xfd, 0x38, 0x47, 0x0b, 0xe5, 0x98, 0x7d, 0xbe, 0xb6, 0xdf, 0x50, 0xae, 0xb2, 0x7c, 0x41,
+  0x7f, 0x01, 0x32, 0x2f, 0x50, 0xbc, 0x78, 0x6c, 0xc7, 0x5b, 0x84, 0x3b, 0xa2, 0xe1, 0x63, 0x70,
+  0x83, 0x7c, 0x7e, 0xcc, 0xa6, 0x3c, 0x02, 0xa2, 0x84, 0xb1, 0x8c, 0x7f, 0x82, 0xdd, 0xe8, 0x61,
+  0x44, 0x73, 0x71, 0xd5, 0x63, 0xe7, 0xaa, 0x30, 0xef, 0x3d, 0xbf, 0x02, 0x5f, 0x64, 0x72, 0xa5,
+  0xa0, 0xe1, 0x5d, 0x39, 0x22, 0x7b, 0xda, 0x61, 0x19, 0x66, 0xde, 0x19, 0x5e, 0x14, 0x4b, 0x71,
+  0xb0, 0x28, 0xa1, 0x99, 0x66, 0x21, 0x68, 0xc7, 0x2b, 0x3a, 0x44, 0x79, 0x99, 0x86, 0x39, 0x98,
+  0xc6, 0x3d, 0xea, 0x1c, 0x2c, 0x63, 0x71, 0xdb, 0xd3, 0x9c, 0x03, 0xdd, 0xc5, 0x26, 0x6b, 0x11,
+  0x0a, 0xed, 0xe2, 0x1c, 0x47, 0x18, 0xb0, 0xd6, 0x3d, 0x7a, 0xd6, 0xc3, 0x78, 0x1a, 0xbb, 0x7f,
+  0x5f, 0x20, 0xd9, 0xcb, 0x80, 0x18, 0x47, 0x25, 0x61, 0xda, 0xb0, 0xee, 0xf9, 0x32, 0x8d, 0x05,
+  0xb9, 0x71, 0xa8, 0xdc, 0x7b, 0xcf, 0x63, 0xc0, 0x13, 0xa3, 0x6e, 0x1c, 0x33, 0x57, 0x29, 0x07,
+  0x2c, 0x34, 0xb0, 0x25, 0x54, 0x18, 0xae, 0x4a, 0xcb, 0x0a, 0x0d, 0x8b, 0xf3, 0xb4, 0xb2, 0x27,
+  0xe5, 0x98, 0xff, 0xe9, 0x9f, 0x80, 0x83, 0xda, 0x3d, 0x50, 0xb3, 0xcf, 0xc1, 0x0f, 0x6c, 0xa1,
+  0x1f, 0x79, 0x7c, 0x52, 0x80, 0xc3, 0xce, 0xef, 0xe0, 0x59, 0x2f, 0x4e, 0x7e, 0x01, 0x20, 0xf0,
+  0x09, 0xa0, 0x14, 0x07, 0x30, 0x01, 0x0c, 0x87, 0xd1, 0x4a, 0x68, 0xea, 0xc5, 0xf7, 0x93, 0xbf,
+  0x82, 0x19, 0xd8, 0x83, 0x3d, 0x07, 0x12, 0xa5, 0xa5, 0x61, 0xd6, 0x11, 0x8d, 0x0b, 0x08, 0x3a,
+  0x5f, 0x14, 0x64, 0xd1, 0xcf, 0x92, 0x7c, 0x25, 0xce, 0x5e, 0x82, 0x9e, 0x62, 0x6f, 0x9f, 0xff,
+  0xf1, 0xe5, 0xf7, 0xaf, 0xcf, 0x70, 0x2e, 0x6c, 0x80, 0x27, 0x91, 0x80, 0x4b, 0x3d, 0xbc, 0x43,
+  0x96, 0xbd, 0xfa, 0xf6, 0x6f, 0xcd, 0x0e, 0x1b, 0xc2, 0xb3, 0x1f, 0xcf, 0xe0, 0xc3, 0x08, 0x3e,
+  0x3c, 0x5f, 0xa6, 0xc9, 0x82, 0xc3, 0x97, 0xdd, 0xa2, 0xe5, 0x7e, 0xd1, 0x72, 0x0f, 0x9e, 0xfd,
+  0x43, 0x02, 0x2a, 0xab, 0xc9, 0x74, 0xce, 0x2a, 0x96, 0x13, 0x36, 0x18, 0x28, 0xb3, 0xb7, 0x45,
+  0x02, 0xb8, 0x25, 0xb4, 0x9b, 0xb5, 0xa8, 0xe2, 0x21, 0x12, 0x50, 0x7e, 0xec, 0x81, 0x42, 0x9f,
+  0x5e, 0x02, 0x8b, 0x15, 0x6b, 0x59, 0x9c, 0x1d, 0x45, 0xfc, 0x17, 0xb0, 0x6f, 0x70, 0x25, 0xde,
+  0x35, 0xdf, 0x0e, 0x01, 0x95, 0x26, 0x7b, 0xc0, 0xac, 0x7e, 0xf0, 0xa4, 0xc9, 0x76, 0xf4, 0x37,
+  0x59, 0x12, 0xe4, 0xf8, 0xe6, 0x97, 0x43, 0x6d, 0x64, 0xf9, 0x2e, 0xa5, 0xca, 0xbd, 0xb6, 0x80,
+  0xdb, 0x5b, 0x2c, 0xb3, 0x59, 0x4b, 0x92, 0xe8, 0x9d, 0xd1, 0xe2, 0x17, 0x44, 0xb1, 0x29, 0x3e,
+  0xeb, 0xb0, 0x65, 0x7f, 0x07, 0x64, 0x5f, 0xd4, 0xf3, 0xb1, 0x13, 0xd8, 0xac, 0x06, 0xfc, 0xa6,
+  0x7a, 0xa3, 0x81, 0x91, 0x8f, 0x5c, 0x70, 0x3e, 0xb0, 0x7b, 0xc7, 0xc7, 0x20, 0x18, 0xa6, 0x3c,
+  0x08, 0x63, 0x3e, 0x35, 0x41, 0xfd, 0xa0, 0xc1, 0xf8, 0x40, 0x33, 0x3f, 0xd3, 0x27, 0x2e, 0xa3,
+  0x50, 0xf8, 0x5c, 0x7b, 0x2c, 0x04, 0x5c, 0xdb, 0x24, 0x2c, 0xdd, 0x6e, 0x06, 0xfc, 0x93, 0xf8,
+  0x4b, 0x3c, 0x0a, 0xd3, 0x43, 0x45, 0x19, 0xd1, 0xa9, 0x98, 0xa7, 0x57, 0x2f, 0xa7, 0xad, 0x66,
+  0x99, 0xc9, 0x6f, 0x96, 0x58, 0xc2, 0xb7, 0x1e, 0x6a, 0xbd, 0x53, 0x79, 0x7c, 0xeb, 0x58, 0x22,
+  0xf7, 0xd7, 0x24, 0x8c, 0x5b, 0x4d, 0xf6, 0x7f, 0xfe, 0x17, 0x6b, 0xba, 0xa6, 0x04, 0x7a, 0x24,
+  0x7f, 0x8e, 0xf7, 0xa8, 0x95, 0xcc, 0xa0, 0xd0, 0x10, 0xd7, 0xab, 0x69, 0x78, 0xf8, 0xe4, 0x7a,
+  0x49, 0x54, 0x5a, 0x4d, 0xb4, 0x2f, 0x4a, 0x98, 0x4c, 0xb4, 0xef, 0x91, 0x66, 0xa2, 0x10, 0x1c,
+  0x48, 0x64, 0x7a, 0xd4, 0xb4, 0x9b, 0x98, 0x68, 0x12, 0x6e, 0x88, 0x86, 0x78, 0x7b, 0xa0, 0x93,
+  0xa7, 0xc0, 0x0e, 0xad, 0x9b, 0x12, 0x0c, 0x4d, 0xd6, 0x03, 0x13, 0x3a, 0x9e, 0xc2, 0x56, 0x88,
+  0xa6, 0x2d, 0xea, 0x59, 0xa0, 0x72, 0x6d, 0xef, 0x37, 0x14, 0xb1, 0x54, 0x42, 0xce, 0x3c, 0x10,
+  0x7e, 0x3c, 0xef, 0xb0, 0xcb, 0x99, 0x97, 0x6b, 0x76, 0x1e, 0x8a, 0xa2, 0x04, 0xb9, 0x19, 0x6d,
+  0xe7, 0x0e, 0x15, 0x2b, 0x89, 0x12, 0x12, 0x6c, 0x32, 0xc3, 0x5a, 0x98, 0x29, 0x6c, 0xbf, 0x85,
+  0x54, 0x00, 0xd6, 0xbe, 0x3a, 0x2b, 0x2a, 0xa6, 0x5b, 0x18, 0x52, 0x2c, 0x09, 0x29, 0xc8, 0x28,
+  0x2b, 0x4b, 0x8f, 0x29, 0xde, 0x28, 0xaf, 0x8b, 0x43, 0x0e, 0x56, 0x4a, 0x40, 0xb5, 0x93, 0x98,
+  0xc8, 0x76, 0xe5, 0x66, 0x2c, 0xdb, 0x91, 0x46, 0xc4, 0x83, 0x9d, 0x40, 0xb4, 0x4a, 0x69, 0x76,
+  0x53, 0x5f, 0x5c, 0x31, 0x8a, 0xbc, 0x4c, 0x4b, 0x5f, 0x59, 0xd9, 0x5d, 0x35, 0x48, 0x82, 0x00,
+  0x4f, 0xc3, 0x3f, 0x66, 0xcd, 0xa7, 0x21, 0xcc, 0x1e, 0x29, 0x6f, 0xbe, 0x01, 0x76, 0xed, 0xe2,
+  0xd3, 0x96, 0xfd, 0x58, 0x7e, 0x9f, 0x60, 0xb7, 0x2e, 0x1b, 0xb4, 0x89, 0xb1, 0x71, 0x31, 0x61,
+  0xfd, 0x44, 0x69, 0x3d, 0xf0, 0x1b, 0x7b, 0xa0, 0xd9, 0x70, 0xb2, 0xc7, 0xdc, 0xcb, 0xde, 0x53,
+  0xe3, 0x56, 0xd3, 0x02, 0x83, 0x0f, 0xf1, 0x43, 0x5b, 0x63, 0x18, 0xc2, 0xf7, 0xc1, 0x71, 0xb9,
+  0x8b, 0xb0, 0x39, 0xe1, 0x7a, 0x0c, 0x3b, 0x51, 0xef, 0xfd, 0x58, 0x30, 0x12, 0x62, 0x47, 0x2b,
+  0x83, 0xed, 0x09, 0x1b, 0x7c, 0x7a, 0xa9, 0xd5, 0xbb, 0xc8, 0x57, 0x26, 0xb3, 0x48, 0x05, 0x54,
+  0xae, 0x90, 0xe0, 0x17, 0xdc, 0xe3, 0x0a, 0x05, 0xb1, 0x87, 0x00, 0x4b, 0x47, 0x2b, 0xc2, 0x5d,
+  0x70, 0x8c, 0x64, 0x14, 0x44, 0x02, 0x99, 0x87, 0xb2, 0xc9, 0xc5, 0x60, 0xb5, 0x5b, 0xba, 0xac,
+  0xba, 0x6f, 0xb6, 0xad, 0xfd, 0x91, 0x17, 0xac, 0x7f, 0xed, 0x10, 0xed, 0xc6, 0x79, 0x02, 0x8b,
+  0xf3, 0xe4, 0xd1, 0x85, 0xe3, 0x75, 0xc3, 0x8a, 0xf5, 0x82, 0x81, 0xc9, 0x3e, 0xef, 0xe5, 0x69,
+  0x08, 0x36, 0x68, 0x2f, 0x4f, 0x7e, 0x44, 0x27, 0xf5, 0x14, 0x9c, 0xd4, 0x96, 0x21, 0x39, 0xee,
+  0xed, 0xfc, 0xdb, 0x77, 0xe0, 0xdf, 0x81, 0x77, 0xf7, 0xcb, 0xe7, 0x41, 0x67, 0xb8, 0x7b, 0xfd,
+  0x87, 0x9d, 0x1e, 0x86, 0xa4, 0x5b, 0x62, 0xbc, 0x36, 0x2a, 0x6f, 0x2f, 0x02, 0x7d, 0xdf, 0x6a,
+  0x0a, 0x47, 0x79, 0x80, 0x56, 0x95, 0xf4, 0x96, 0xa7, 0xe1, 0x05, 0xac, 0x16, 0x88, 0x8d, 0xc2,
+  0x3c, 0x50, 0x0b, 0x10, 0x70, 0xb0, 0xd3, 0x5a, 0x4d, 0x61, 0x04, 0x11, 0x5e, 0x8f, 0x05, 0xc0,
+  0x63, 0x24, 0xba, 0x84, 0x5d, 0x30, 0x46, 0x0f, 0x88, 0x1b, 0x83, 0x10, 0xcb, 0x16, 0x30, 0x55,
+  0x2e, 0x54, 0xbc, 0xd4, 0x62, 0xe2, 0x51, 0x2f, 0x79, 0xaf, 0xd4, 0x16, 0x2b, 0x9e, 0x21, 0x2d,
+  0x71, 0x6a, 0xd8, 0x37, 0xc7, 0x4e, 0x02, 0xcf, 0xbc, 0x8d, 0xc7, 0x33, 0x6d, 0xe0, 0x40, 0x4f,
+  0x68, 0xb1, 0x5c, 0xc0, 0x7a, 0x2b, 0x5b, 0xa8, 0xdd, 0xae, 0x5f, 0x09, 0xe3, 0x28, 0x46, 0x79,
+  0x65, 0xcc, 0x36, 0xa4, 0xd7, 0xcc, 0x5b, 0x27, 0x3d, 0x68, 0x88, 0xe3, 0x41, 0xb3, 0xbd, 0x0d,
+  0x82, 0x20, 0xfc, 0x54, 0xf5, 0x3b, 0x15, 0x91, 0x0a, 0x35, 0xd9, 0x41, 0x51, 0x18, 0x02, 0x69,
+  0x40, 0x75, 0x8b, 0x92, 0x79, 0xf0, 0x94, 0xe3, 0xac, 0x62, 0x9e, 0xfc, 0xf9, 0xf4, 0xdb, 0x27,
+  0xaf, 0x5f, 0x3f, 0xff, 0xae, 0x30, 0x53, 0x86, 0x7d, 0xb2, 0x4c, 0xc6, 0x43, 0xb2, 0x4b, 0x06,
+  0x63, 0xb2, 0x48, 0xf0, 0x21, 0x18, 0x21, 0xa3, 0x21, 0xd3, 0x4c, 0x5e, 0x2a, 0xdb, 0x7c, 0x91,
+  0xa4, 0xf3, 0xef, 0x12, 0x0f, 0xab, 0xf0, 0x94, 0xfd, 0x5d, 0x1a, 0xe8, 0x58, 0x87, 0x54, 0xd7,
+  0xc0, 0x24, 0xae, 0x51, 0xc3, 0x2f, 0xa8, 0x81, 0x7b, 0xd3, 0xe4, 0x77, 0x5f, 0x4d, 0xf3, 0xd8,
+  0x46, 0xfe, 0x5d, 0xbd, 0x2e, 0x95, 0x07, 0x06, 0xd4, 0x12, 0x90, 0x71, 0xd1, 0x3f, 0xac, 0x91,
+  0xe0, 0xf5, 0x50, 0x24, 0x72, 0xa5, 0x3e, 0x94, 0xb2, 0x29, 0x84, 0xa7, 0xe9, 0xb7, 0xe7, 0xaf,
+  0xbe, 0xc3, 0xb5, 0xb5, 0x4e, 0x57, 0x74, 0x07, 0x8d, 0x93, 0x6f, 0x41, 0x5a, 0xd0, 0xf1, 0x58,
+  0x79, 0xba, 0xa2, 0x5c, 0x7e, 0x10, 0x55, 0x2d, 0xa4, 0x52, 0x48, 0x2e, 0x06, 0xfc, 0x73, 0x54,
+  0x4c, 0x10, 0xbe, 0x3d, 0x78, 0xd0, 0x56, 0x43, 0x78, 0xd3, 0x69, 0x0b, 0x0c, 0x6a, 0xf6, 0x3d,
+  0x41, 0x68, 0x35, 0x4f, 0x35, 0x9b, 0x26, 0xec, 0xb0, 0xb0, 0x6d, 0xe3, 0xa4, 0x78, 0x4d, 0xd1,
+  0xd1, 0xb4, 0x6a, 0xd0, 0xa2, 0x2f, 0xde, 0x94, 0x63, 0x82, 0x80, 0x2d, 0x9e, 0x1e, 0xb0, 0xee,
+  0xc0, 0xc5, 0x67, 0xe7, 0x33, 0xca, 0xc0, 0xcc, 0xd1, 0xc7, 0xc0, 0x15, 0x23, 0x31, 0xe8, 0x73,
+  0x71, 0x51, 0x0e, 0x4a, 0x43, 0xf1, 0x93, 0x15, 0x87, 0xcc, 0x0b, 0x50, 0x2e, 0xe4, 0xa8, 0x84,
+  0x43, 0xf2, 0x48, 0xf0, 0xe5, 0x32, 0x03, 0xb1, 0x9c, 0x99, 0xeb, 0x8e, 0x99, 0x84, 0x1f, 0x14,
+  0x1f, 0x39, 0xd5, 0x2b, 0x71, 0x99, 0xd2, 0x9a, 0xf4, 0xa5, 0xc3, 0xd2, 0xa0, 0x50, 0xa3, 0x41,
+  0x67, 0x03, 0xc5, 0x8a, 0x82, 0xc3, 0xe6, 0x56, 0x34, 0x83, 0x05, 0x6c, 0x32, 0x88, 0x03, 0xdb,
+  0x06, 0xae, 0x72, 0x77, 0x9e, 0x2e, 0xb9, 0xc9, 0x38, 0x1f, 0x56, 0xf1, 0x8c, 0x38, 0xc3, 0x54,
+  0x32, 0x8c, 0x63, 0xc1, 0x8f, 0x61, 0x7f, 0xc9, 0xb5, 0xfe, 0x50, 0x59, 0x66, 0xb2, 0x37, 0xc3,
+  0x52, 0x95, 0xb6, 0x06, 0xec, 0xe8, 0x08, 0x56, 0x9b, 0x9e, 0xa0, 0xa7, 0x07, 0x8a, 0xd4, 0x58,
+  0xfd, 0x0f, 0xc5, 0xc2, 0xd3, 0xd0, 0xbd, 0x0f, 0x6b, 0xb5, 0x52, 0x71, 0x50, 0x0a, 0x76, 0x07,
+  0x55, 0x48, 0xd3, 0x3c, 0x45, 0x6f, 0xfd, 0xf6, 0xa6, 0xd5, 0x00, 0xe4, 0xc1, 0x29, 0x4d, 0xc8,
+  0x09, 0x08, 0xd2, 0x24, 0xde, 0x0c, 0x88, 0x08, 0x34, 0x55, 0x60, 0x08, 0xfb, 0xd9, 0x36, 0xa4,
+  0xc8, 0x33, 0x58, 0xb9, 0x5d, 0xd5, 0xa6, 0xb7, 0x1c, 0x3c, 0x70, 0xa5, 0x33, 0xe5, 0x74, 0x94,
+  0x3e, 0x64, 0x8a, 0x62, 0x56, 0x40, 0xb5, 0x57, 0xa1, 0x70, 0x50, 0x7e, 0x01, 0x3e, 0x6b, 0x97,
+  0xb4, 0x96, 0xad, 0x15, 0xb2, 0x69, 0x20, 0xbd, 0x13, 0x64, 0x26, 0xc3, 0x5d, 0xc1, 0x07, 0xc5,
+  0xdd, 0x2d, 0x86, 0x94, 0x83, 0x3e, 0xa6, 0x2b, 0x62, 0xee, 0x35, 0xda, 0x15, 0x64, 0xa9, 0xbe,
+  0x7d, 0x51, 0x9a, 0xb5, 0x98, 0x2c, 0xfd, 0x41, 0x46, 0x30, 0xd0, 0xe0, 0xa1, 0x8a, 0x78, 0xcc,
+  0x2a, 0xb8, 0x0c, 0xd7, 0x1f, 0xd4, 0x79, 0xa1, 0x2f, 0xba, 0xb1, 0x56, 0xee, 0x22, 0xc7, 0xfe,
+  0x76, 0x59, 0xbb, 0xc4, 0xeb, 0x92, 0x6b, 0x91, 0xd5, 0x4b, 0x16, 0x24, 0xbb, 0xaf, 0x85, 0x9f,
+  0x3a, 0xac, 0x6c, 0x84, 0xdf, 0x4f, 0xe9, 0xf8, 0x97, 0x30, 0x2b, 0xc5, 0x51, 0x30, 0xd8, 0x10,
+  0x68, 0x10, 0x1a, 0x76, 0x29, 0x59, 0x75, 0x67, 0x65, 0x4f, 0xdd, 0x4f, 0x83, 0x37, 0x82, 0xbf,
+  0x34, 0xc8, 0x26, 0xc3, 0xd5, 0xfb, 0x86, 0x28, 0x45, 0x8d, 0x37, 0x12, 0x7b, 0xcb, 0x9e, 0x94,
+  0x44, 0x03, 0x39, 0x68, 0xb8, 0x8f, 0xfa, 0xbd, 0x14, 0x86, 0xed, 0x89, 0x5c, 0x31, 0x13, 0x2a,
+  0x03, 0x67, 0x2e, 0x3f, 0xd2, 0xb4, 0x0c, 0x57, 0x36, 0x58, 0xe5, 0xc6, 0xca, 0x57, 0xff, 0xf0,
+  0xed, 0xdf, 0x74, 0x6c, 0x84, 0x10, 0xa9, 0x34, 0x01, 0xff, 0x1d, 0x6f, 0xb0, 0x43, 0x7b, 0xf0,
+  0x05, 0xde, 0x6f, 0xd7, 0x1a, 0x09, 0x09, 0xf3, 0x0a, 0x7a, 0x37, 0x2b, 0x02, 0x94, 0x28, 0xdf,
+  0x5e, 0x2f, 0xf4, 0x6e, 0x26, 0x8a, 0x6e, 0x6a, 0x1f, 0xcb, 0x23, 0x87, 0xb6, 0x79, 0xec, 0xa5,
+  0xde, 0x3c, 0x5b, 0x2b, 0xa2, 0x2d, 0xf9, 0xf7, 0x58, 0xc4, 0x19, 0xc1, 0x0a, 0x43, 0xa2, 0x7f,
+  0x20, 0xe3, 0x74, 0xc3, 0xe9, 0xba, 0x2c, 0x3b, 0x6a, 0xf1, 0x98, 0x2c, 0x5c, 0x81, 0x0e, 0xd0,
+  0xf6, 0xbe, 0x64, 0xc2, 0x0d, 0x60, 0xdb, 0xb2, 0xf5, 0x81, 0x11, 0x7f, 0x6f, 0xde, 0x17, 0xec,
+  0xba, 0x01, 0x20, 0x53, 0xbe, 0xfe, 0x9e, 0xed, 0xec, 0xe2, 0xcc, 0xa4, 0xdb, 0xfa, 0xdb, 0xd0,
+  0x4c, 0xab, 0x5f, 0x91, 0x34, 0x78, 0x2c, 0x44, 0xf3, 0x6a, 0xaa, 0xd9, 0x86, 0x23, 0x6e, 0x1e,
+  0x85, 0xc2, 0x11, 0xeb, 0x23, 0x9f, 0xdc, 0x97, 0xdb, 0x53, 0xf2, 0xca, 0x7d, 0xf9, 0x9a, 0xe0,
+  0xaa, 0xed, 0xf9, 0x3b, 0xa4, 0x34, 0x28, 0x17, 0x3a, 0xbd, 0xc5, 0x54, 0x96, 0xaa, 0xc3, 0xe4,
+  0x31, 0x91, 0x64, 0x99, 0xfb, 0xc9, 0x9c, 0x0b, 0x35, 0xe3, 0xa9, 0x8b, 0xc8, 0xf0, 0x74, 0x17,
+  0xae, 0x09, 0x98, 0x72, 0xce, 0xf0, 0x88, 0x3a, 0x14, 0xe6, 0x8e, 0x8e, 0xd0, 0x48, 0x2a, 0x38,
+  0x82, 0x5f, 0x0c, 0xdd, 0x21, 0x5e, 0x83, 0xee, 0xa0, 0x0f, 0x74, 0xc3, 0x2e, 0x27, 0xd7, 0xbf,
+  0x19, 0x4e, 0xf1, 0xa2, 0x04, 0x67, 0x60, 0x32, 0x5d, 0xc6, 0xb1, 0x08, 0xf8, 0x57, 0x7a, 0x81,
+  0x96, 0xcc, 0x49, 0x60, 0xba, 0x40, 0xd2, 0x91, 0xb4, 0x0d, 0x7c, 0xf5, 0xf2, 0x34, 0x5d, 0x45,
+  0x18, 0xa9, 0xa1, 0x61, 0xf5, 0xf1, 0xce, 0x11, 0x5a, 0x77, 0x22, 0x40, 0x73, 0xbb, 0x10, 0x5f,
+  0x71, 0x92, 0xce, 0x0a, 0xda, 0x09, 0xf0, 0x7a, 0x44, 0xc7, 0x11, 0xf8, 0x13, 0x23, 0x52, 0x46,
+  0x58, 0x9c, 0x18, 0x14, 0x11, 0x1c, 0x9a, 0xae, 0x78, 0xf0, 0x40, 0x45, 0x6c, 0x92, 0x40, 0x04,
+  0x7d, 0xca, 0x77, 0x59, 0x61, 0x51, 0x6a, 0xa2, 0x44, 0x76, 0x16, 0xe7, 0x56, 0x49, 0x21, 0x94,
+  0xfa, 0x40, 0x42, 0xc2, 0x53, 0x28, 0x5a, 0xe0, 0xc6, 0x5c, 0x97, 0xeb, 0xfa, 0x28, 0x65, 0xab,
+  0xb2, 0x0c, 0x22, 0xd5, 0xd2, 0x24, 0x1a, 0xd2, 0xf2, 0x23, 0x1b, 0x4d, 0x0f, 0x34, 0x44, 0xb1,
+  0xc5, 0x52, 0x84, 0x97, 0x7b, 0xac, 0xa4, 0x31, 0x25, 0x6b, 0x7a, 0x66, 0xdc, 0x49, 0x82, 0x4f,
+  0x39, 0x30, 0xee, 0x9c, 0x00, 0x21, 0xdc, 0xb7, 0xda, 0x57, 0x8d, 0x38, 0x7a, 0xab, 0xda, 0x59,
+  0x8a, 0x01, 0x5f, 0xe3, 0x41, 0x43, 0xd9, 0x9a, 0x32, 0x5b, 0xe6, 0x42, 0x55, 0xe1, 0xa1, 0x57,
+  0x55, 0x79, 0x88, 0x86, 0x01, 0x71, 0x3e, 0x51, 0xf6, 0x2d, 0x07, 0x51, 0x9c, 0x19, 0x8e, 0xad,
+  0xe2, 0x97, 0x25, 0x4a, 0x84, 0xda, 0x48, 0xec, 0x44, 0x32, 0x63, 0x49, 0x7e, 0x68, 0x6f, 0x46,
+  0x62, 0x8d, 0xd3, 0x6d, 0x4d, 0xb3, 0xa1, 0xc5, 0x3d, 0x3f, 0x66, 0xdc, 0x6a, 0x20, 0x13, 0x88,
+  0xb8, 0x5a, 0x24, 0x41, 0x8a, 0x03, 0xca, 0x95, 0x19, 0xb5, 0x57, 0x04, 0x69, 0x01, 0x52, 0x7d,
+  0x88, 0xb6, 0x10, 0x1a, 0xc6, 0xa9, 0x54, 0x23, 0x41, 0x71, 0x93, 0x0d, 0x89, 0xfc, 0x44, 0x1b,
+  0x51, 0x27, 0xa9, 0x11, 0x59, 0xc1, 0xbe, 0x8f, 0xf1, 0xae, 0xa0, 0x8d, 0xe2, 0x2a, 0xf5, 0xac,
+  0x2d, 0x95, 0x10, 0x16, 0x98, 0x02, 0x9d, 0xc2, 0x29, 0x82, 0x78, 0xe5, 0xe5, 0xb3, 0x1e, 0x55,
+  0x62, 0xb4, 0x16, 0xf8, 0x1b, 0x8f, 0x2f, 0xc0, 0xdc, 0xcd, 0x6b, 0xe7, 0x11, 0x4e, 0x95, 0xf6,
+  0x65, 0x7f, 0x47, 0xcc, 0x67, 0x8a, 0x0c, 0x71, 0x60, 0xf6, 0x78, 0x4b, 0xa0, 0xcd, 0xf2, 0xe0,
+  0x71, 0xd3, 0x04, 0x5f, 0xc2, 0x77, 0xd1, 0x03, 0xb8, 0xe4, 0x78, 0x70, 0x1f, 0x1d, 0x77, 0xa1,
+  0xae, 0x70, 0x5e, 0x12, 0x18, 0x9e, 0xdf, 0x6e, 0xd2, 0x76, 0xb8, 0x0f, 0x76, 0x90, 0xfd, 0xf6,
+  0x3c, 0x91, 0xef, 0xe8, 0x20, 0xb3, 0xfd, 0x16, 0x4f, 0x4d, 0x5b, 0x71, 0x61, 0x34, 0x53, 0x68,
+  0x6e, 0x42, 0xdf, 0xe2, 0xa7, 0xdf, 0xa7, 0x52, 0x2c, 0x2e, 0xc3, 0x49, 0x29, 0xcd, 0xc7, 0xc1,
+  0x33, 0xcf, 0x33, 0x57, 0xbc, 0xa3, 0xc3, 0xa2, 0xf0, 0xbd, 0x38, 0xc6, 0x12, 0x16, 0x57, 0x9b,
+  0x81, 0x68, 0x72, 0x69, 0xc7, 0x37, 0xd6, 0x29, 0x50, 0xa7, 0x92, 0x94, 0x97, 0xf2, 0x30, 0x5d,
+  0x58, 0xc8, 0x3e, 0x86, 0xb6, 0x94, 0xed, 0x6c, 0xad, 0x48, 0xef, 0xac, 0x60, 0x9b, 0xbe, 0x1f,
+  0xaa, 0x71, 0x38, 0x3d, 0x94, 0xb1, 0x42, 0x13, 0x16, 0xe7, 0xa4, 0x8d, 0xf8, 0x80, 0xc4, 0xa2,
+  0xc7, 0x63, 0x3c, 0x9e, 0x35, 0xdd, 0x14, 0x8e, 0x3c, 0x2d, 0xad, 0xf9, 0x06, 0x0a, 0x50, 0x24,
+  0xde, 0x6c, 0x0a, 0x48, 0x1d, 0x7f, 0x76, 0x40, 0x9a, 0xc9, 0x57, 0x9b, 0x82, 0x92, 0x27, 0x9a,
+  0x1d, 0x90, 0xe6, 0xe2, 0xcd, 0xc6, 0x80, 0xc4, 0xe1, 0x65, 0x17, 0x20, 0xf1, 0xc6, 0x95, 0x8e,
+  0xb8, 0x67, 0x51, 0x52, 0x5f, 0xb3, 0xd5, 0xc3, 0x69, 0x0c, 0x55, 0x31, 0x51, 0x9a, 0xe5, 0x31,
+  0x63, 0x50, 0xff, 0xc1, 0x5a, 0x9d, 0x6d, 0x64, 0x9d, 0xca, 0xae, 0xa4, 0x36, 0x35, 0x6a, 0xbc,
+  0xa9, 0xb7, 0x0d, 0xba, 0x66, 0x5b, 0xef, 0x53, 0x6d, 0x5b, 0xcd, 0x2d, 0x47, 0x4d, 0x2b, 0x9d,
+  0x5e, 0xd5, 0x13, 0x25, 0x4a, 0xf6, 0xe3, 0x82, 0x14, 0xf1, 0x72, 0xd1, 0xa9, 0xbe, 0xc3, 0xda,
+  0x63, 0xa1, 0xa6, 0xe1, 0x83, 0xe1, 0x9c, 0xaa, 0x66, 0xa0, 0x37, 0x33, 0xcc, 0x31, 0x7f, 0xae,
+  0x64, 0x98, 0xca, 0x34, 0xe4, 0x65, 0x18, 0x43, 0x7f, 0x03, 0x3a, 0x80, 0xa3, 0xb2, 0x03, 0x32,
+  0x99, 0x60, 0x0c, 0x69, 0x36, 0xa9, 0xd7, 0xb9, 0x7a, 0x87, 0x1f, 0x3a, 0xec, 0xd2, 0x38, 0x59,
+  0x6f, 0x5a, 0x52, 0xaa, 0x0b, 0xb6, 0x41, 0x4e, 0x54, 0x56, 0xc5, 0x81, 0x01, 0x50, 0xa0, 0x69,
+  0xaf, 0xc4, 0xcd, 0xd7, 0x7c, 0x03, 0x1f, 0xd9, 0x3c, 0xe1, 0x6e, 0x09, 0x20, 0xc5, 0xb4, 0x42,
+  0xad, 0xad, 0x55, 0x60, 0x2e, 0xc5, 0x42, 0x38, 0xee, 0xc8, 0x09, 0x3e, 0x16, 0x1c, 0x4d, 0x12,
+  0xbf, 0xb5, 0x95, 0x78, 0x79, 0xcc, 0x06, 0x60, 0x7e, 0xf5, 0xab, 0x2a, 0x44, 0x0a, 0x09, 0x02,
+  0x49, 0x48, 0xd8, 0x62, 0x85, 0x94, 0x92, 0x12, 0x00, 0x95, 0x66, 0xa5, 0xd0, 0xa8, 0x40, 0x96,
+  0x5b, 0xbd, 0xd2, 0xa5, 0x10, 0x0e, 0x04, 0x59, 0xee, 0xe3, 0x6a, 0x2b, 0xb5, 0xf3, 0x7f, 0xcf,
+  0x3e, 0xb5, 0xba, 0xfe, 0x0d, 0x23, 0x85, 0xe5, 0xda, 0xeb, 0xcb, 0x87, 0x6f, 0x1e, 0xe3, 0x5f,
+  0x34, 0x41, 0x6a, 0x77, 0xa3, 0x91, 0xcc, 0x86, 0xce, 0xa1, 0x8c, 0x0a, 0x28, 0x32, 0xfa, 0x8b,
+  0x9a, 0xa2, 0x15, 0x24, 0x2c, 0xe8, 0xf4, 0xd7, 0x0c, 0x8f, 0x4c, 0xd9, 0x4d, 0x45, 0x21, 0x15,
+  0x91, 0xba, 0x5a, 0xdc, 0x74, 0xa8, 0x5c, 0x55, 0x89, 0x96, 0x49, 0x50, 0x1f, 0x0b, 0xc8, 0xb0,
+  0xc4, 0x40, 0x74, 0xc7, 0x1d, 0x91, 0x44, 0x5c, 0xfc, 0xfa, 0x5c, 0xab, 0x49, 0xe5, 0x09, 0x07,
+  0xcd, 0x0e, 0x56, 0x2f, 0x40, 0xc7, 0x7a, 0x3b, 0xac, 0xb8, 0xfb, 0xb3, 0x2a, 0x91, 0xe1, 0x63,
+  0x2c, 0x7f, 0x67, 0xef, 0xb9, 0xa8, 0x98, 0x28, 0x8a, 0x92, 0xae, 0x6b, 0xcb, 0x79, 0x2a, 0x34,
+  0x94, 0x66, 0xa2, 0xa8, 0xa2, 0xd3, 0x6a, 0x94, 0x0a, 0x87, 0xd6, 0x53, 0x35, 0x52, 0xc7, 0x46,
+  0xbc, 0xbb, 0xac, 0x8c, 0x6a, 0x83, 0x70, 0x5e, 0xb4, 0x5e, 0x53, 0xed, 0x58, 0xbb, 0x97, 0xe1,
+  0x89, 0x8e, 0x96, 0xd7, 0x61, 0x13, 0x5a, 0x62, 0x8f, 0x75, 0xe1, 0x13, 0xb5, 0x88, 0x13, 0xf2,
+  0x02, 0xca, 0x8a, 0xaa, 0x38, 0xf9, 0xa5, 0xad, 0x5d, 0xbf, 0x6b, 0x16, 0xf4, 0x95, 0xe3, 0x52,
+  0x6d, 0xd6, 0x7a, 0xff, 0xba, 0x9e, 0x52, 0x22, 0x4a, 0xe0, 0x7b, 0xa5, 0x93, 0xad, 0x3e, 0x3f,
+  0xa1, 0x52, 0x07, 0x72, 0xcd, 0x5e, 0x62, 0x64, 0x60, 0xc3, 0x51, 0x9e, 0x25, 0x38, 0x88, 0xe1,
+  0x29, 0x55, 0x7e, 0x62, 0x59, 0x08, 0x29, 0x7b, 0x64, 0xaf, 0x1c, 0x50, 0xfd, 0xca, 0x70, 0xd3,
+  0xb2, 0xd8, 0xe7, 0xa2, 0x2e, 0x91, 0xba, 0xd2, 0x67, 0xac, 0x5b, 0x2a, 0x2e, 0x79, 0xd4, 0xe3,
+  0xdc, 0xe2, 0x07, 0x6c, 0x8f, 0xa9, 0x07, 0xc6, 0x5e, 0xd3, 0x27, 0x79, 0xab, 0x6f, 0xa5, 0xe0,
+  0xe5, 0xb6, 0xeb, 0x65, 0xe0, 0x8a, 0xd1, 0xaf, 0x0e, 0xdb, 0x85, 0x0b, 0x78, 0x21, 0xe3, 0x9b,
+  0x19, 0xb4, 0x6d, 0x4b, 0x78, 0x65, 0x58, 0xd7, 0x7c, 0x8f, 0xf2, 0xaa, 0xbd, 0x9e, 0x42, 0xc5,
+  0x1d, 0xb3, 0x95, 0x65, 0x20, 0xf0, 0xaa, 0xff, 0x3b, 0x75, 0x7d, 0x66, 0x47, 0x9b, 0x1c, 0x7c,
+  0xd6, 0x6e, 0x92, 0xfc, 0xa5, 0x48, 0xa5, 0xcc, 0x69, 0x0f, 0xad, 0xb7, 0x62, 0x70, 0x6c, 0x12,
+  0x34, 0xab, 0xa8, 0x51, 0x90, 0x42, 0xae, 0xe0, 0x77, 0x61, 0x96, 0xf7, 0x84, 0xff, 0xd8, 0x52,
+  0xeb, 0xd3, 0x61, 0x73, 0xf2, 0x02, 0x49, 0x62, 0x15, 0x0a, 0xb5, 0xbd, 0x76, 0xf2, 0xfa, 0x7d,
+  0xb8, 0x95, 0xf9, 0x0b, 0x7a, 0xcb, 0x26, 0x74, 0xce, 0x8b, 0xb2, 0xc6, 0x6d, 0xad, 0x0c, 0x44,
+  0x9c, 0x10, 0x5b, 0x4f, 0x64, 0x75, 0x7f, 0x89, 0x9b, 0xd5, 0xd5, 0xdb, 0xb5, 0x60, 0xf4, 0x0b,
+  0x47, 0xdc, 0xa0, 0xf4, 0x16, 0x46, 0x8e, 0x1b, 0x3c, 0x1b, 0x61, 0x8f, 0x79, 0x99, 0xab, 0x22,
+  0x2a, 0xcc, 0x0f, 0xb1, 0x84, 0xd4, 0x4b, 0xb1, 0xac, 0xf4, 0x12, 0x1c, 0x79, 0x2e, 0xea, 0x37,
+  0x99, 0x0c, 0xa5, 0x51, 0xe5, 0x6c, 0x4c, 0xae, 0xd0, 0xa5, 0x77, 0xa5, 0xf1, 0xb4, 0x30, 0x13,
+  0x75, 0x97, 0x05, 0xb6, 0x4d, 0x4b, 0xfb, 0x56, 0xb5, 0xff, 0x0e, 0xd0, 0x56, 0xac, 0xf0, 0xb5,
+  0x68, 0x8d, 0x75, 0xa6, 0xd5, 0x48, 0x49, 0xdd, 0x63, 0x33, 0xb0, 0x52, 0x71, 0x76, 0xc4, 0xd6,
+  0xf8, 0xf5, 0x3f, 0xfc, 0x27, 0x6d, 0x73, 0x5b, 0x10, 0x2a, 0xd8, 0x6d, 0x67, 0x8d, 0xc9, 0xeb,
+  0x55, 0x2a, 0x6b, 0x41, 0x2f, 0xcb, 0x2c, 0xa1, 0x55, 0x97, 0xa9, 0x25, 0xd2, 0xda, 0x66, 0x23,
+  0xbb, 0xc8, 0xcc, 0x7c, 0x6b, 0x65, 0xf2, 0xac, 0xae, 0x66, 0x00, 0xd6, 0x7c, 0xe9, 0xf6, 0x3f,
+  0x0f, 0xcd, 0xeb, 0x5e, 0x8a, 0xa5, 0xb0, 0x2e, 0xa6, 0xe0, 0xd5, 0x40, 0x95, 0x8a, 0x19, 0xab,
+  0x40, 0x05, 0x18, 0x4f, 0xd5, 0xae, 0x6f, 0x8a, 0xc0, 0xf2, 0xb8, 0xbd, 0x89, 0x07, 0x55, 0x9e,
+  0x89, 0x00, 0x7a, 0x52, 0xc1, 0x7a, 0x4f, 0xfc, 0x3e, 0x0a, 0x6c, 0xc5, 0x62, 0xc0, 0x1d, 0x36,
+  0x96, 0x71, 0x13, 0xdc, 0x86, 0xdf, 0x34, 0xb7, 0x00, 0xec, 0xd4, 0x35, 0x05, 0x60, 0x80, 0xb6,
+  0x33, 0xd6, 0xc0, 0x39, 0xa9, 0xf1, 0xfc, 0xcd, 0xa9, 0x4e, 0x8c, 0x15, 0x83, 0x6a, 0x57, 0x2a,
+  0xb8, 0x77, 0xaa, 0x05, 0xb6, 0x97, 0x2d, 0x27, 0xf0, 0x15, 0xcb, 0xf5, 0xb1, 0xf4, 0x46, 0x4c,
+  0xaf, 0xd7, 0xeb, 0x69, 0x18, 0x5d, 0x1b, 0xb8, 0x15, 0x88, 0x9f, 0x1c, 0x03, 0x49, 0xd4, 0x06,
+  0x59, 0x89, 0x6c, 0xb5, 0x44, 0xdf, 0xd5, 0xe7, 0x70, 0x93, 0xe9, 0x19, 0xf7, 0x81, 0x14, 0xcb,
+  0xa5, 0x7e, 0x35, 0x02, 0xb6, 0x1d, 0x9e, 0x30, 0x68, 0x6e, 0x0c, 0x4a, 0xdc, 0x16, 0xe1, 0x82,
+  0x43, 0x87, 0x28, 0x37, 0x03, 0x64, 0x1c, 0xb6, 0xbf, 0x25, 0x2c, 0x75, 0x3f, 0xc1, 0x5d, 0xad,
+  0xdd, 0x8a, 0xa1, 0xca, 0xfb, 0x1d, 0x9a, 0x58, 0x8c, 0xe0, 0x93, 0x69, 0x5a, 0x59, 0xf4, 0xeb,
+  0xea, 0x5e, 0xb5, 0x4f, 0x3e, 0x14, 0x42, 0xb2, 0x3c, 0xfa, 0x41, 0x96, 0x61, 0x75, 0xfb, 0xca,
+  0x30, 0xbc, 0xbb, 0xf9, 0x61, 0xfd, 0x5e, 0xb7, 0xdb, 0xab, 0x1d, 0x6e, 0x77, 0xc9, 0xc3, 0xb9,
+  0xc8, 0xcc, 0xd8, 0x1d, 0xce, 0xc5, 0x0b, 0xa3, 0x7a, 0x40, 0x86, 0xd2, 0xb5, 0x04, 0x0d, 0xb2,
+  0x8e, 0xc9, 0xb9, 0x75, 0x87, 0x3c, 0x36, 0xa1, 0x6f, 0xf5, 0xc8, 0x55, 0x45, 0xbc, 0x34, 0xf1,
+  0x77, 0x65, 0x9a, 0x37, 0x81, 0x56, 0x67, 0xe9, 0xe3, 0xb9, 0xc4, 0x9c, 0xdf, 0xdb, 0x0a, 0xa6,
+  0x30, 0xf5, 0xab, 0xd0, 0xd4, 0x45, 0x27, 0x8a, 0x8e, 0x9c, 0x6e, 0x8b, 0x43, 0x95, 0x26, 0xe8,
+  0x0c, 0xda, 0x0b, 0x7f, 0x66, 0x01, 0xad, 0x92, 0x79, 0xc6, 0x5a, 0x78, 0xd6, 0x83, 0x5b, 0xf1,
+  0x08, 0xa6, 0x9a, 0x8a, 0x97, 0xa2, 0x69, 0x87, 0x7d, 0xe4, 0x29, 0xde, 0x93, 0xa0, 0x81, 0x92,
+  0x4f, 0x44, 0x83, 0xf6, 0xcd, 0xd0, 0x17, 0xb4, 0x15, 0x3f, 0xb7, 0x04, 0xe8, 0x7f, 0x3d, 0x7c,
+  0xe8, 0xf1, 0xbd, 0xbe, 0x01, 0x0b, 0xac, 0x0a, 0x60, 0x05, 0x9e, 0x2c, 0x73, 0xe9, 0x59, 0x7e,
+  0x5e, 0x0b, 0x9e, 0x0e, 0x82, 0xd7, 0x4b, 0x1a, 0x76, 0x8d, 0x3b, 0x4f, 0x0b, 0x77, 0xc3, 0x96,
+  0x61, 0x1c, 0x78, 0xc4, 0xe6, 0x2e, 0x99, 0x77, 0xfa, 0x62, 0xfc, 0xe5, 0xe6, 0x88, 0x17, 0x62,
+  0xd4, 0xbb, 0x61, 0x87, 0xff, 0x52, 0x16, 0x28, 0x6b, 0x7b, 0x8b, 0x7c, 0x4a, 0x6b, 0xd5, 0x5b,
+  0xce, 0x46, 0xa7, 0xe8, 0xa5, 0x50, 0x45, 0x4d, 0xff, 0x53, 0x2d, 0x24, 0x6c, 0x04, 0x9c, 0x75,
+  0x26, 0xe4, 0xda, 0x60, 0xaf, 0x6a, 0x99, 0x37, 0x55, 0xa1, 0xcd, 0x9d, 0x70, 0x09, 0x7f, 0xb8,
+  0xeb, 0x8f, 0xfc, 0xe6, 0xba, 0xe5, 0xc3, 0x1c, 0xce, 0xa2, 0xc8, 0xed, 0x96, 0xcf, 0x91, 0xb1,
+  0x1d, 0x8f, 0x05, 0x3f, 0x93, 0x6e, 0xd9, 0x4c, 0x6f, 0xff, 0xf6, 0xd2, 0xc2, 0x89, 0x2d, 0x2e,
+  0xcf, 0x4f, 0xea, 0x1b, 0xaa, 0x12, 0xa4, 0xf4, 0xcf, 0xa9, 0x3a, 0xf6, 0x79, 0x17, 0x8c, 0x54,
+  0x3b, 0x2e, 0x5a, 0xaa, 0xb8, 0x09, 0xd0, 0xfc, 0x47, 0x33, 0x01, 0x4f, 0x4b, 0x08, 0x14, 0xcc,
+  0x90, 0x99, 0x44, 0x07, 0xdb, 0x68, 0xf6, 0x75, 0xc9, 0x46, 0x4f, 0x72, 0xbc, 0xbb, 0x15, 0x3c,
+  0x86, 0x13, 0x36, 0x90, 0x05, 0x5c, 0xe2, 0x89, 0x93, 0x7d, 0x8b, 0xd6, 0x1a, 0x63, 0x39, 0x6c,
+  0xa0, 0x92, 0x29, 0x4a, 0x03, 0x08, 0x7d, 0xb2, 0xbb, 0x5a, 0x5c, 0xdd, 0xd2, 0x1c, 0xd5, 0x58,
+  0x9a, 0xb7, 0x5c, 0x70, 0xc3, 0xe4, 0x1c, 0xdd, 0x89, 0x4c, 0x78, 0xaa, 0xce, 0x3b, 0x97, 0xb7,
+  0x61, 0x75, 0xd5, 0x95, 0x68, 0x15, 0x8e, 0x91, 0x34, 0xbc, 0xb3, 0xed, 0x70, 0xa7, 0xaa, 0xb3,
+  0x3c, 0xda, 0x7c, 0x27, 0x84, 0x11, 0x07, 0xc3, 0x8b, 0xe3, 0xe0, 0xd5, 0x53, 0xe0, 0xd6, 0x39,
+  0x91, 0x5a, 0x83, 0x4b, 0x1a, 0x36, 0xea, 0xca, 0xc4, 0x55, 0x55, 0x1d, 0xfa, 0xd5, 0x8a, 0xcd,
+  0x6a, 0x00, 0x87, 0x62, 0x64, 0xca, 0x56, 0xc3, 0x2f, 0x3d, 0x71, 0x93, 0x80, 0xcd, 0xc7, 0xe8,
+  0x5d, 0xcf, 0xf2, 0x79, 0x64, 0x1c, 0x17, 0xd0, 0xe2, 0x7b, 0x95, 0xc3, 0x8f, 0x1a, 0xb9, 0xa8,
+  0x1f, 0x7a, 0xbf, 0x47, 0x79, 0x4a, 0x7b, 0x13, 0x0f, 0x43, 0xca, 0xd8, 0x00, 0x6e, 0x45, 0x71,
+  0x64, 0x46, 0x5d, 0xcb, 0x59, 0xfe, 0x48, 0xee, 0xee, 0xf8, 0xb0, 0x21, 0xb6, 0x1d, 0xde, 0xff,
+  0x78, 0x42, 0x86, 0x01, 0x1d, 0xa3, 0xc4, 0x47, 0x74, 0x67, 0xa3, 0xb1, 0x2a, 0xda, 0x30, 0xd3,
+  0x62, 0x18, 0xbc, 0x89, 0x8c, 0xb6, 0xbb, 0x76, 0x73, 0xa8, 0xfe, 0x6b, 0x77, 0x8d, 0x12, 0x2c,
+  0xb6, 0xd4, 0x10, 0x71, 0x5c, 0x02, 0x81, 0x2f, 0x0e, 0x58, 0x08, 0xf6, 0x4d, 0xe8, 0x1f, 0xe2,
+  0x15, 0xb2, 0xea, 0x67, 0x76, 0x48, 0x85, 0xaf, 0x45, 0xaa, 0x3c, 0xbb, 0x1d, 0x27, 0xc5, 0x21,
+  0x68, 0xe3, 0x42, 0x84, 0x87, 0x78, 0x21, 0x42, 0x89, 0x12, 0x5f, 0xf8, 0x1b, 0x40, 0x75, 0xdc,
+  0x85, 0xa9, 0x2e, 0xe8, 0x54, 0x80, 0x52, 0x2d, 0xeb, 0x73, 0x7b, 0x68, 0x7e, 0x9c, 0x17, 0x68,
+  0xd1, 0xad, 0x99, 0x3a, 0xc3, 0x6a, 0xfa, 0xb7, 0xe0, 0x4f, 0xe3, 0x44, 0x02, 0x8e, 0x56, 0xc4,
+  0x35, 0xec, 0xcd, 0xef, 0xee, 0xd2, 0xfc, 0x2d, 0xaf, 0x00, 0x6d, 0xae, 0x3a, 0xd2, 0xf7, 0x1c,
+  0x53, 0xeb, 0x78, 0x00, 0x2e, 0xa5, 0xdb, 0xfc, 0x62, 0x36, 0x59, 0xa6, 0x19, 0x3c, 0xe0, 0x74,
+  0x8f, 0xd4, 0xbf, 0x1b, 0xf7, 0xc1, 0x50, 0x3d, 0x64, 0xd3, 0xd4, 0xbb, 0x2c, 0x6e, 0xb4, 0xa6,
+  0xd3, 0x08, 0x78, 0x08, 0x86, 0x7e, 0xd1, 0x57, 0x3b, 0xa1, 0x4e, 0xa1, 0x10, 0xf8, 0xbb, 0x62,
+  0xe2, 0x95, 0x29, 0x12, 0x7f, 0xc6, 0xa7, 0xcb, 0x88, 0xbf, 0xa5, 0xb6, 0x56, 0x69, 0x8a, 0x01,
+  0xc0, 0x4e, 0xbf, 0xdb, 0xd0, 0xf5, 0xe4, 0x7a, 0x2a, 0xe2, 0x4d, 0x4f, 0xd4, 0xef, 0x10, 0xbf,
+  0x40, 0xbc, 0x0a, 0xcb, 0xd7, 0x8d, 0x97, 0x23, 0x59, 0xe1, 0x2a, 0x57, 0x78, 0xb3, 0xcc, 0x00,
+  0x63, 0x99, 0x70, 0xc9, 0xc4, 0x19, 0x0c, 0xca, 0xaf, 0x70, 0xa2, 0x1b, 0xac, 0x4c, 0x12, 0x45,
+  0x08, 0x37, 0x89, 0xa3, 0x2b, 0x19, 0xd9, 0xc3, 0xf8, 0x1f, 0xf8, 0xab, 0xdc, 0xa3, 0x92, 0x06,
+  0xcc, 0xa2, 0x6a, 0x87, 0x75, 0xa2, 0x08, 0x2d, 0x73, 0xb4, 0xc9, 0x62, 0xbc, 0xff, 0xd4, 0x22,
+  0x0f, 0x5d, 0x2d, 0x20, 0x20, 0x22, 0x71, 0x54, 0xd1, 0x81, 0xec, 0xd4, 0x36, 0xfa, 0x83, 0x91,
+  0xff, 0x12, 0xb9, 0xe3, 0xa3, 0x17, 0xb5, 0xf4, 0x84, 0x50, 0x47, 0xd6, 0xa5, 0xc8, 0x99, 0x68,
+  0xc0, 0x93, 0x85, 0x0d, 0x5b, 0x03, 0xfd, 0x59, 0x9c, 0xbd, 0x2a, 0x40, 0x96, 0xaf, 0x0e, 0xab,
+  0x68, 0x17, 0x3f, 0x5d, 0x6d, 0x9d, 0xde, 0x12, 0x29, 0x18, 0xc1, 0x53, 0xd6, 0xea, 0xde, 0x13,
+  0x19, 0xe1, 0x1e, 0xbd, 0x3c, 0x4b, 0x96, 0xa9, 0xcf, 0xe5, 0x01, 0x75, 0x6d, 0xca, 0xd5, 0x03,
+  0x6d, 0xf2, 0x14, 0xad, 0xe0, 0xd2, 0x63, 0x61, 0x34, 0x95, 0x10, 0x64, 0xb2, 0x4b, 0xbc, 0x2e,
+  0x95, 0x81, 0xf8, 0xde, 0x03, 0xa9, 0xb4, 0xe0, 0x71, 0x51, 0x70, 0xf5, 0xd9, 0x24, 0xc1, 0xa1,
+  0x95, 0x46, 0x3b, 0x64, 0xd7, 0x95, 0xfe, 0xea, 0xf4, 0x6e, 0x09, 0xc0, 0xc4, 0xd6, 0xee, 0x01,
+  0xdb, 0x94, 0xb0, 0xc3, 0x20, 0x3a, 0x5e, 0xcb, 0x44, 0xda, 0x0a, 0xd3, 0x5a, 0xa6, 0x06, 0x51,
+  0xda, 0x0e, 0xd9, 0xf1, 0xdf, 0x9c, 0x7d, 0xff, 0xba, 0x47, 0x35, 0x48, 0x2d, 0xf0, 0xbb, 0xf4,
+  0xb8, 0xa1, 0x28, 0x22, 0x9d, 0xe1, 0xf5, 0x70, 0x05, 0xff, 0xe1, 0x7d, 0x6b, 0x74, 0x37, 0xc1,
+  0x25, 0x67, 0x33, 0xbc, 0xb8, 0x30, 0x4e, 0x72, 0xaa, 0xff, 0x07, 0x26, 0xbd, 0xc2, 0x8b, 0x20,
+  0x8a, 0xca, 0x52, 0xe4, 0xc2, 0x85, 0x64, 0x7a, 0x91, 0x8d, 0x11, 0xf9, 0x41, 0x23, 0x2c, 0x70,
+  0xcf, 0x71, 0xa0, 0x1f, 0x74, 0xe7, 0x3d, 0x29, 0xab, 0xed, 0x4d, 0xc8, 0xdc, 0x17, 0x00, 0xb8,
+  0x0e, 0xf6, 0x1b, 0x4d, 0x28, 0x20, 0x41, 0x97, 0xaf, 0x6b, 0x93, 0xb3, 0x65, 0x41, 0x35, 0xaf,
+  0xf0, 0x4e, 0x64, 0x30, 0x3a, 0xac, 0xa9, 0x19, 0xb2, 0x22, 0x2b, 0x82, 0x37, 0xb8, 0x6b, 0x19,
+  0x11, 0x52, 0x75, 0x06, 0x89, 0xeb, 0x16, 0x04, 0x5b, 0xaa, 0xf5, 0x58, 0x75, 0x23, 0x41, 0x75,
+  0x59, 0x60, 0xb9, 0x2b, 0x28, 0x6b, 0xc8, 0x96, 0x9f, 0x50, 0x6c, 0x90, 0x2d, 0x00, 0x62, 0x52,
+  0x9e, 0x99, 0x10, 0x67, 0x66, 0x93, 0x4b, 0x10, 0xb4, 0x11, 0x9a, 0x44, 0x57, 0x72, 0xcd, 0x0e,
+  0x89, 0xa1, 0xe9, 0x85, 0x0f, 0x22, 0xf8, 0x8a, 0xa9, 0x4b, 0xcf, 0x1b, 0xb8, 0x7e, 0xf3, 0x8c,
+  0x47, 0x1f, 0x79, 0x56, 0x50, 0x83, 0x94, 0x01, 0xce, 0x1f, 0x36, 0xea, 0x47, 0x7e, 0xeb, 0xe9,
+  0x9b, 0x05, 0x15, 0xb2, 0xf8, 0x9b, 0x32, 0x68, 0xab, 0x78, 0xb2, 0xca, 0x38, 0xa2, 0x1b, 0x2e,
+  0x74, 0x95, 0x5f, 0x0c, 0x8e, 0x29, 0x1b, 0x16, 0xc6, 0xd2, 0x31, 0x13, 0xb8, 0xa3, 0x9b, 0x24,
+  0xa6, 0x67, 0xf4, 0xad, 0x61, 0x11, 0xe6, 0xa4, 0x7b, 0xed, 0x1e, 0xc4, 0xb1, 0x72, 0xa0, 0x9b,
+  0xb6, 0x8b, 0xb5, 0x7b, 0x47, 0xaa, 0x62, 0x60, 0x55, 0x8e, 0xbf, 0xfc, 0x79, 0x45, 0xfc, 0x71,
+  0x50, 0x33, 0xe1, 0x9e, 0xe6, 0xab, 0x8b, 0x1f, 0x5d, 0x12, 0xb9, 0x06, 0x16, 0x16, 0x5b, 0x6e,
+  0x00, 0x0a, 0x05, 0x84, 0xcc, 0x20, 0x79, 0x32, 0x29, 0x33, 0xb9, 0x02, 0xc1, 0x10, 0x4f, 0x19,
+  0xae, 0x43, 0x26, 0x8e, 0x2e, 0x15, 0x65, 0x4a, 0xea, 0x3c, 0xb5, 0x38, 0x41, 0x58, 0xa9, 0x5e,
+  0x10, 0xe5, 0xa8, 0xd4, 0xfa, 0x27, 0x51, 0xe3, 0xf8, 0xb9, 0xae, 0x06, 0xe5, 0xb1, 0x38, 0x7d,
+  0x49, 0x47, 0x2e, 0xca, 0xf6, 0x3a, 0xc6, 0x9f, 0x6f, 0x5a, 0xf9, 0x66, 0x85, 0x86, 0xac, 0xd5,
+  0xb1, 0x56, 0xfd, 0xda, 0x71, 0x7c, 0x58, 0xfc, 0xc0, 0xa4, 0xa1, 0x7c, 0xa4, 0xaf, 0xd6, 0x6a,
+  0xd2, 0x6f, 0xbb, 0xd1, 0x2f, 0xd7, 0x16, 0x9e, 0x9c, 0xb8, 0x00, 0x40, 0x5e, 0x56, 0x80, 0x94,
+  0x94, 0x29, 0xc9, 0xc7, 0x7f, 0x8a, 0xff, 0x14, 0xb7, 0xde, 0x16, 0x06, 0x31, 0x71, 0x6a, 0x26,
+  0x6e, 0xea, 0x9c, 0xe0, 0x85, 0x31, 0x8b, 0xbc, 0xdd, 0x6c, 0xd7, 0x95, 0xc4, 0x12, 0x26, 0x1b,
+  0xd5, 0xc2, 0x5e, 0xaf, 0x66, 0x36, 0xf3, 0x12, 0xdb, 0x0d, 0x8e, 0x44, 0xaf, 0x4b, 0x1d, 0x98,
+  0x61, 0xfa, 0x1b, 0xe6, 0x0d, 0x8c, 0xfc, 0xc3, 0xcd, 0x53, 0x06, 0x9b, 0x81, 0x31, 0x42, 0xf8,
+  0xd5, 0x33, 0xde, 0x37, 0x4a, 0x79, 0xe9, 0x6e, 0xf5, 0xcd, 0x52, 0x5b, 0xcd, 0xbe, 0x96, 0xd0,
+  0xba, 0x51, 0xa2, 0xca, 0xe5, 0x8d, 0xd7, 0xdf, 0xf3, 0xc4, 0x56, 0xdd, 0x65, 0x62, 0x5d, 0x75,
+  0xbf, 0x7e, 0xdd, 0x8d, 0xc3, 0x3a, 0x92, 0xc7, 0x95, 0x0c, 0x5b, 0x71, 0x3c, 0xdf, 0x71, 0x89,
+  0xf3, 0x7a, 0x96, 0xdc, 0x08, 0x3d, 0x83, 0x15, 0x9c, 0xd8, 0x89, 0xc1, 0x57, 0xa2, 0xe7, 0xba,
+  0xf7, 0xd9, 0x2a, 0xed, 0x11, 0xfa, 0x66, 0x1b, 0x66, 0x93, 0x77, 0x39, 0x18, 0x85, 0xc0, 0x08,
+  0x45, 0xbb, 0xa2, 0xe1, 0x0d, 0xfe, 0x22, 0x0f, 0x67, 0x5c, 0xde, 0xd8, 0xa8, 0x5d, 0x1a, 0x7e,
+  0xcf, 0x75, 0x4b, 0x83, 0xac, 0x53, 0xb3, 0x73, 0x89, 0x0a, 0x1a, 0x38, 0x74, 0x7a, 0xac, 0xe9,
+  0xde, 0xba, 0x8b, 0x1e, 0x4a, 0x0a, 0x89, 0xf9, 0x3f, 0xc6, 0x81, 0x49, 0x36, 0x83, 0x0d, 0x02,
+  0x16, 0xd4, 0x8f, 0x6f, 0x5f, 0x62, 0xca, 0x04, 0x08, 0x1c, 0xe7, 0x2d, 0x81, 0x39, 0x16, 0xdb,
+  0x81, 0x81, 0x57, 0xd7, 0xc8, 0xc6, 0xcd, 0x5d, 0x19, 0xb7, 0x51, 0x88, 0x6b, 0xfb, 0xc5, 0xc7,
+  0xff, 0x24, 0x25, 0xe4, 0xef, 0x87, 0x34, 0x10, 0x4d, 0x5a, 0x38, 0xc0, 0xbb, 0xc1, 0xca, 0x20,
+  0x85, 0x79, 0x29, 0xbd, 0x19, 0x2a, 0x77, 0x2b, 0x0e, 0xb6, 0x5a, 0xbd, 0x57, 0x7e, 0xa0, 0xd7,
+  0xa9, 0x02, 0x95, 0x86, 0x88, 0xc2, 0x79, 0x98, 0x1f, 0xf7, 0x9b, 0xb7, 0x29, 0xa9, 0xf3, 0x64,
+  0x45, 0x9d, 0x6d, 0x60, 0x51, 0x20, 0x8a, 0x0c, 0x5d, 0x33, 0xfa, 0xca, 0x34, 0x2e, 0xb1, 0x34,
+  0x16, 0x1e, 0x22, 0x13, 0x57, 0x27, 0xdf, 0x43, 0xdd, 0x25, 0x7e, 0xfd, 0xb9, 0x28, 0xb7, 0x42,
+  0x15, 0x27, 0x58, 0x8a, 0x65, 0xe8, 0x25, 0x90, 0xde, 0x03, 0x76, 0xc9, 0xf2, 0x9e, 0x49, 0x38,
+  0xe6, 0xb0, 0xe2, 0xae, 0x37, 0x59, 0x6a, 0xfd, 0x4a, 0x6d, 0xa7, 0xa4, 0x5e, 0xd9, 0xdb, 0xba,
+  0xf4, 0xd9, 0x9d, 0x1a, 0xf6, 0xf5, 0x42, 0x9e, 0x0d, 0xc0, 0x6d, 0x28, 0x0d, 0xb7, 0x99, 0x56,
+  0x35, 0x87, 0xbc, 0x56, 0x60, 0xaa, 0x8b, 0x9d, 0x57, 0xe5, 0xe1, 0xd6, 0xe0, 0xab, 0xd2, 0x70,
+  0xf5, 0x52, 0xaf, 0x1c, 0xc4, 0x90, 0x77, 0x91, 0xc4, 0x7c, 0x65, 0x48, 0xd5, 0xb1, 0x70, 0x2e,
+  0xa9, 0xa7, 0x60, 0xd5, 0x4b, 0x3e, 0xba, 0x2c, 0x5e, 0x35, 0xdb, 0xa9, 0x15, 0x80, 0xf2, 0x9a,
+  0x0b, 0x61, 0x87, 0xca, 0x60, 0x89, 0x28, 0x9c, 0x3a, 0x3d, 0xfb, 0xe9, 0x90, 0x3e, 0x4c, 0xd0,
+  0x2b, 0xc2, 0x53, 0x22, 0xe0, 0xea, 0x64, 0xf4, 0x33, 0x13, 0xe2, 0x6f, 0x0a, 0x54, 0x65, 0xa6,
+  0x48, 0x07, 0x7f, 0x58, 0x84, 0x06, 0x9e, 0xc1, 0x8e, 0x6f, 0xd9, 0x47, 0x7e, 0x48, 0x0a, 0x50,
+  0xe8, 0x22, 0xb9, 0xec, 0xe5, 0xc9, 0xcb, 0xb3, 0xef, 0x65, 0xd6, 0xad, 0x6d, 0x56, 0x16, 0x0c,
+  0xec, 0xc3, 0x42, 0x78, 0x61, 0xba, 0xde, 0xf3, 0x5c, 0x7c, 0x77, 0x74, 0xdd, 0x6f, 0xf7, 0xf0,
+  0x1e, 0x3e, 0xcf, 0xe7, 0xad, 0x9d, 0x83, 0x9d, 0x8b, 0x0e, 0x96, 0x60, 0x59, 0xc0, 0x82, 0x30,
+  0xe2, 0x52, 0xf7, 0xfc, 0x05, 0x7f, 0x97, 0xe5, 0xcf, 0x7f, 0xf8, 0xac, 0xe8, 0x54, 0xf6, 0xfd,
+  0x53, 0xf6, 0x80, 0x7a, 0xff, 0xb9, 0xd9, 0xbe, 0x86, 0x06, 0x12, 0x75, 0xfc, 0x28, 0x71, 0xb9,
+  0xee, 0xf9, 0xd9, 0xc7, 0xbf, 0x98, 0x90, 0xa3, 0x30, 0x7e, 0xbf, 0xe2, 0x5c, 0x9b, 0x57, 0x62,
+  0x82, 0x2d, 0x7b, 0x60, 0xe8, 0x3f, 0xc9, 0x01, 0xf3, 0xc9, 0x12, 0x68, 0xd5, 0x9c, 0xa5, 0x3c,
+  0x40, 0x97, 0x52, 0x97, 0x6b, 0x38, 0xc6, 0x63, 0x85, 0x5c, 0x9d, 0x8a, 0x28, 0x78, 0x61, 0x15,
+  0xf4, 0xa9, 0xbc, 0xc7, 0x1c, 0x46, 0x50, 0xf3, 0xb7, 0x9a, 0x13, 0x9f, 0x7f, 0x0c, 0xb3, 0x70,
+  0x12, 0x46, 0x61, 0x4e, 0xac, 0x3e, 0x0b, 0xa7, 0x53, 0x1e, 0x57, 0xad, 0x1e, 0xbc, 0x27, 0xdc,
+  0x38, 0x0b, 0x87, 0x10, 0x4c, 0x70, 0x74, 0xc2, 0xae, 0xd5, 0x76, 0x77, 0x4d, 0xf9, 0x3c, 0xf9,
+  0xc8, 0x1d, 0x5d, 0x6f, 0xb7, 0x27, 0xbf, 0xd2, 0xa5, 0xf2, 0x5f, 0xf0, 0xd7, 0x20, 0x44, 0x37,
+  0x61, 0xbe, 0x83, 0xfa, 0x46, 0x59, 0xfc, 0x22, 0xc4, 0x40, 0xfb, 0x1f, 0x3e, 0x2b, 0x2a, 0x5c,
+  0xff, 0x29, 0x3e, 0xa7, 0xb2, 0x02, 0x79, 0xfb, 0x3d, 0xac, 0xf5, 0x8d, 0xe4, 0xe2, 0xf5, 0x5f,
+  0xd6, 0x68, 0x33, 0xeb, 0x87, 0xec, 0x37, 0xf3, 0x1f, 0xca, 0x5b, 0xd7, 0x6f, 0xe9, 0x40, 0x68,
+  0x97, 0x61, 0xdf, 0xdc, 0xfc, 0xb7, 0xee, 0x32, 0xbe, 0x39, 0x20, 0xe3, 0x46, 0xd7, 0x9b, 0x83,
+  0x29, 0x2e, 0xb4, 0x76, 0xea, 0xb8, 0x15, 0xb7, 0xad, 0xb2, 0x9b, 0x57, 0x61, 0xe8, 0x34, 0x77,
+  0x9f, 0x3d, 0x30, 0xef, 0x91, 0x2f, 0xd6, 0xb9, 0xfe, 0x76, 0x57, 0x11, 0x91, 0xc6, 0x8c, 0x0c,
+  0x3c, 0x57, 0x57, 0x7c, 0xaf, 0xbc, 0x39, 0x69, 0xb0, 0x27, 0xef, 0xd1, 0xf9, 0x4c, 0xdd, 0x1e,
+  0xc8, 0xea, 0xc4, 0x20, 0x4a, 0x92, 0xb4, 0x25, 0x4e, 0x54, 0xd2, 0x85, 0xf2, 0x2d, 0x3a, 0x1c,
+  0x49, 0x25, 0x0d, 0x75, 0xf5, 0x0d, 0xa5, 0x2a, 0x70, 0xd0, 0x0b, 0x80, 0x1f, 0xde, 0x9e, 0x4d,
+  0xef, 0x8c, 0xb9, 0x36, 0xe4, 0xf7, 0xe2, 0x32, 0xe6, 0x8a, 0xe5, 0xb2, 0xc9, 0x7c, 0xd6, 0xf2,
+  0xe6, 0x86, 0x58, 0xd8, 0x70, 0xec, 0x43, 0xed, 0x64, 0x13, 0xea, 0x13, 0x5e, 0xc7, 0x53, 0xfa,
+  0xb5, 0xfd, 0x75, 0x5c, 0x25, 0x76, 0x44, 0xf3, 0x37, 0x5d, 0xb4, 0x35, 0xa2, 0xe5, 0x86, 0xe4,
+  0xfa, 0x42, 0x64, 0x7f, 0x8d, 0x01, 0x84, 0xad, 0x04, 0x8b, 0x61, 0x65, 0xd6, 0x06, 0x87, 0x8c,
+  0x6b, 0xa8, 0x8d, 0x88, 0x97, 0xb1, 0x42, 0xc7, 0xe5, 0x1a, 0x39, 0x6e, 0x28, 0x25, 0x09, 0xb0,
+  0xb9, 0xb4, 0x33, 0x37, 0xb2, 0x65, 0x26, 0x8a, 0xc1, 0x01, 0xa4, 0xca, 0xba, 0x63, 0x0d, 0xf9,
+  0x70, 0x57, 0xbf, 0xcd, 0xd0, 0x7d, 0xef, 0xbd, 0xf9, 0x23, 0x00, 0x4e, 0xa3, 0xb1, 0x7a, 0x71,
+  0xa2, 0x76, 0x6d, 0x22, 0x66, 0x2b, 0x5c, 0xa3, 0x50, 0x5e, 0x0e, 0x4f, 0x51, 0x78, 0x61, 0x6c,
+  0x0d, 0xa2, 0x5d, 0xb0, 0x5f, 0x33, 0xde, 0x6a, 0xd9, 0x74, 0x87, 0xba, 0xef, 0x2e, 0x05, 0xd4,
+  0x6d, 0x45, 0xd4, 0xcd, 0xb9, 0xfc, 0x67, 0xaa, 0x7e, 0x04, 0x27, 0xf4, 0xdc, 0xbb, 0x68, 0x6e,
+  0x5e, 0xe9, 0xbf, 0xa6, 0x72, 0x4d, 0x5c, 0x2b, 0xef, 0x0c, 0x0d, 0x19, 0xb7, 0x8f, 0x3f, 0x5e,
+  0x11, 0xcf, 0xb0, 0x17, 0xb2, 0x2e, 0xa0, 0x71, 0x6b, 0xdb, 0xc1, 0x51, 0xea, 0x48, 0x99, 0xea,
+  0xad, 0x92, 0x0c, 0xd6, 0x45, 0xf6, 0xb6, 0xd4, 0xad, 0x2b, 0xa3, 0xbc, 0x65, 0x89, 0xe7, 0x0a,
+  0xfa, 0xd6, 0x46, 0xde, 0x5c, 0x31, 0x16, 0x2b, 0x47, 0xaa, 0x2e, 0xc3, 0xd4, 0x13, 0xc3, 0x87,
+  0x74, 0xdb, 0xbd, 0xba, 0xe2, 0xfe, 0x68, 0x47, 0xfc, 0x28, 0xe9, 0xd1, 0x0e, 0x56, 0x52, 0x9c,
+  0x7c, 0xf5, 0xff, 0x01, 0xc8, 0x0f, 0x51, 0xc7, 0xf2, 0xb3, 0x00, 0x00,
+};
+
+#endif
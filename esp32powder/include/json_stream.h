@@ -0,0 +1,169 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+// Minimal JSON writer that streams through a small reusable buffer and
+// hands it to the HTTP layer as chunked transfer-encoding, so response size
+// no longer costs heap. It can also write into any JsonSink (the event
+// stream). Commas between members/elements are inserted automatically.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform.h"
+#include "tag_store.h"
+
+#define JSON_CHUNK_SIZE 1024
+
+// Shared by all HTTP responses (JSON, CSV, metrics) - the web server runs
+// handlers one at a time. Events get their own: enter and leave events are
+// written from trackerPoll(), which a long export calls mid-stream.
+extern char jsonChunkBuffer[JSON_CHUNK_SIZE];
+extern char jsonEventBuffer[JSON_CHUNK_SIZE];
+
+class JsonSink {
+public:
+  virtual ~JsonSink() {}
+  virtual void write(const char* data, size_t len) = 0;
+};
+
+class JsonStream {
+public:
+  explicit JsonStream(HttpRequest& request)
+      : req(&request), sink(nullptr), buffer(jsonChunkBuffer), len(0), needComma(false) {}
+  explicit JsonStream(JsonSink& target)
+      : req(nullptr), sink(&target), buffer(jsonEventBuffer), len(0), needComma(false) {}
+
+  void begin(int code = 200, const char* contentType = "application/json") {
+    req->beginChunked(code, contentType);
+  }
+
+  void end() {
+    flush();
+    req->endChunked();
+  }
+
+  // Hand over what is buffered; call before the sink is used directly
+  void flush() {
+    if (len == 0) return;
+    if (req) req->sendChunk(buffer, len); else sink->write(buffer, len);
+    len = 0;
+  }
+
+  JsonStream& beginObject() { return open('{'); }
+  JsonStream& endObject() { return close('}'); }
+  JsonStream& beginArray() { return open('['); }
+  JsonStream& endArray() { return close(']'); }
+
+  JsonStream& key(const char* name) {
+    separate();
+    put('"');
+    raw(name);
+    raw("\":");
+    needComma = false;
+    return *this;
+  }
+
+  JsonStream& str(const char* s) {
+    separate();
+    put('"');
+    for (; *s; s++) {
+      char c = *s;
+      if (c == '"' || c == '\\') {
+        put('\\');
+        put(c);
+      } else if ((unsigned char)c < 0x20) {
+        char esc[7];
+        snprintf(esc, sizeof(esc), "\\u%04x", c);
+        raw(esc);
+      } else {
+        put(c);
+      }
+    }
+    put('"');
+    needComma = true;
+    return *this;
+  }
+
+  // Quoted upper-case hex, e.g. an EPC
+  JsonStream& hex(const uint8_t* data, int n) {
+    separate();
+    put('"');
+    char out[3];
+    for (int i = 0; i < n; i++) {
+      bytesToHex(data + i, 1, out);
+      put(out[0]);
+      put(out[1]);
+    }
+    put('"');
+    needComma = true;
+    return *this;
+  }
+
+  JsonStream& num(long value) {
+    char out[24];
+    snprintf(out, sizeof(out), "%ld", value);
+    return literal(out);
+  }
+
+  JsonStream& num(unsigned long value) {
+    char out[24];
+    snprintf(out, sizeof(out), "%lu", value);
+    return literal(out);
+  }
+
+  JsonStream& num(int value) { return num((long)value); }
+  JsonStream& num(unsigned int value) { return num((unsigned long)value); }
+
+  JsonStream& num(float value, int decimals) {
+    char out[24];
+    snprintf(out, sizeof(out), "%.*f", decimals, (double)value);
+    return literal(out);
+  }
+
+  JsonStream& boolean(bool value) { return literal(value ? "true" : "false"); }
+
+  // Pre-formatted value (number, literal or already-quoted string)
+  JsonStream& literal(const char* text) {
+    separate();
+    raw(text);
+    needComma = true;
+    return *this;
+  }
+
+  JsonStream& raw(const char* s) {
+    for (; *s; s++) put(*s);
+    return *this;
+  }
+
+private:
+  HttpRequest* req;
+  JsonSink* sink;
+  char* buffer;  // jsonChunkBuffer or jsonEventBuffer
+  size_t len;
+  bool needComma;
+
+  void put(char c) {
+    if (len == JSON_CHUNK_SIZE) flush();
+    buffer[len++] = c;
+  }
+
+  void separate() {
+    if (needComma) put(',');
+  }
+
+  JsonStream& open(char c) {
+    separate();
+    put(c);
+    needComma = false;
+    return *this;
+  }
+
+  JsonStream& close(char c) {
+    put(c);
+    needComma = true;
+    return *this;
+  }
+};
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+// Always-on counters for /api/metrics. Recording a sample is a few integer
+// adds and at most a dozen compares, with no allocation and no locking (the
+// histograms and rate meters here are only touched on the loop task; the
+// ingest counters from the UART task are atomics, see IngestStats), so
+// nothing here needs to be compiled out for production. Rendering to
+// Prometheus text happens only when scraped.
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform.h"
+#include "json_stream.h"
+
+#define METRICS_MAX_ENDPOINTS 24
+#define METRICS_RATE_MS 1000  // rate gauges are averaged over this window
+
+// Latency bucket bounds in microseconds, with the same bounds in seconds for
+// the le labels. Bucket LATENCY_BUCKETS is +Inf.
+#define LATENCY_BUCKETS 11
+static const uint32_t latencyBoundsUs[LATENCY_BUCKETS] = {
+  50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000, 500000
+};
+static const char* const latencyBoundLabels[LATENCY_BUCKETS] = {
+  "0.00005", "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.1", "0.5"
+};
+
+struct LatencyHistogram {
+  uint32_t buckets[LATENCY_BUCKETS + 1];  // per bucket, summed when written
+  uint64_t sumUs;
+  uint32_t count;
+  uint32_t maxUs;
+
+  void observe(uint32_t us) {
+    int i = 0;
+    while (i < LATENCY_BUCKETS && us > latencyBoundsUs[i]) i++;
+    buckets[i]++;
+    sumUs += us;
+    count++;
+    if (us > maxUs) maxUs = us;
+  }
+};
+
+// Per-second rate of a free-running counter, refreshed once per window
+struct RateMeter {
+  uint32_t lastCount;
+  uint32_t lastAt;
+  float perSecond;
+
+  void sample(uint32_t count, uint32_t now) {
+    uint32_t elapsed = now - lastAt;
+    if (elapsed < METRICS_RATE_MS) return;
+    perSecond = (count - lastCount) * 1000.0f / elapsed;
+    lastCount = count;
+    lastAt = now;
+  }
+};
+
+struct EndpointMetrics {
+  const char* path;
+  uint32_t requests;
+  LatencyHistogram latency;
+};
+
+extern EndpointMetrics endpointMetrics[METRICS_MAX_ENDPOINTS];
+extern int endpointMetricsCount;
+extern LatencyHistogram loopLatency;
+
+int metricsEndpoint(const char* path);
+void metricsRequestDone(int endpoint, uint32_t us);
+
+// Prometheus text exposition (format 0.0.4), streamed through the shared
+// chunk buffer like JsonStream and CsvStream
+class MetricsStream {
+public:
+  explicit MetricsStream(HttpRequest& request) : req(request), len(0) {}
+
+  void begin() {
+    req.beginChunked(200, "text/plain; version=0.0.4; charset=utf-8");
+  }
+
+  void end() {
+    flush();
+    req.endChunked();
+  }
+
+  // HELP and TYPE lines, once per metric family
+  MetricsStream& family(const char* name, const char* type, const char* help) {
+    line("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    return *this;
+  }
+
+  // labels is the text inside the braces, e.g. path="/api/status", or nullptr
+  MetricsStream& value(const char* name, const char* labels, unsigned long v) {
+    return line("%s%s%s%s %lu\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", v);
+  }
+
+  MetricsStream& value(const char* name, const char* labels, double v) {
+    return line("%s%s%s%s %.6g\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", v);
+  }
+
+  // name_bucket/_sum/_count lines in seconds
+  MetricsStream& histogram(const char* name, const char* labels, const LatencyHistogram& h) {
+    const char* sep = labels ? "," : "";
+    if (!labels) labels = "";
+    unsigned long cumulative = 0;
+    for (int i = 0; i <= LATENCY_BUCKETS; i++) {
+      cumulative += h.buckets[i];
+      line("%s_bucket{%s%sle=\"%s\"} %lu\n", name, labels, sep,
+           i < LATENCY_BUCKETS ? latencyBoundLabels[i] : "+Inf", cumulative);
+    }
+    const char* open = *labels ? "{" : "";
+    const char* close = *labels ? "}" : "";
+    line("%s_sum%s%s%s %.6f\n", name, open, labels, close, h.sumUs / 1e6);
+    return line("%s_count%s%s%s %lu\n", name, open, labels, close, (unsigned long)h.count);
+  }
+
+private:
+  HttpRequest& req;
+  size_t len;
+
+  void flush() {
+    if (len == 0) return;
+    req.sendChunk(jsonChunkBuffer, len);
+    len = 0;
+  }
+
+  // One line at a time; a line never exceeds 160 characters
+  __attribute__((format(printf, 2, 3))) MetricsStream& line(const char* fmt, ...) {
+    if (JSON_CHUNK_SIZE - len < 160) flush();
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(jsonChunkBuffer + len, JSON_CHUNK_SIZE - len, fmt, args);
+    va_end(args);
+    if (n > 0) len += (size_t)n < JSON_CHUNK_SIZE - len ? n : JSON_CHUNK_SIZE - len - 1;
+    return *this;
+  }
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+// Thin seams between the tracker core and the board. The ESP32 build wires
+// these to Serial2, WebServer and Preferences (src/main.cpp); the native build
+// wires them to the R200 simulator and in-memory fakes (src/native/).
+
+// Serial link to the R200 module
+class ReaderPort {
+public:
+  virtual ~ReaderPort() {}
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual size_t write(const uint8_t* data, size_t len) = 0;
+};
+
+// Persistent key/value storage (NVS on the board)
+class KeyValueStore {
+public:
+  virtual ~KeyValueStore() {}
+  virtual std::string getString(const char* key) = 0;  // "" when missing
+  virtual void putString(const char* key, const std::string& value) = 0;
+  virtual void remove(const char* key) = 0;
+  // Every string entry whose key starts with prefix
+  virtual void forEachString(const char* prefix, void (*visit)(const char* key, const std::string& value)) = 0;
+  // Writes between these share one open/commit of the store
+  virtual void beginBatch() {}
+  virtual void endBatch() {}
+};
+
+// Append-only files for the reading log (LittleFS on the board)
+class FileStore {
+public:
+  virtual ~FileStore() {}
+  virtual bool append(const char* path, const uint8_t* data, size_t len) = 0;  // creates the file
+  virtual size_t read(const char* path, uint32_t offset, uint8_t* data, size_t len) = 0;
+  virtual bool remove(const char* path) = 0;
+  // Every file in dir, by name without the directory
+  virtual void list(const char* dir, void (*visit)(void* context, const char* name, uint32_t size),
+                    void* context) = 0;
+};
+
+// Server-sent events connection, kept open after its request returns
+class EventChannel {
+public:
+  virtual ~EventChannel() {}
+  virtual bool connected() = 0;
+  virtual size_t write(const char* data, size_t len) = 0;
+  virtual void close() = 0;
+};
+
+// One HTTP request/response exchange
+class HttpRequest {
+public:
+  virtual ~HttpRequest() {}
+  virtual bool hasArg(const char* name) = 0;
+  virtual std::string arg(const char* name) = 0;
+  virtual void send(int code, const char* contentType, const std::string& body) = 0;
+  // Streamed response of unknown length (chunked transfer-encoding)
+  virtual void beginChunked(int code, const char* contentType) = 0;
+  virtual void sendChunk(const char* data, size_t len) = 0;
+  virtual void endChunked() = 0;
+  // Answer with text/event-stream and hand the connection over; nullptr when
+  // no channel is free
+  virtual EventChannel* openEventStream() = 0;
+};
+
+// Heap figures for /api/metrics, in bytes (PSRAM fields 0 without PSRAM)
+struct PlatformMemory {
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;       // low-water mark since boot
+  uint32_t largestFreeBlock;
+  uint32_t psramSize;
+  uint32_t psramFree;
+};
+
+// Provided by each environment
+uint32_t platformMillis();
+uint32_t platformMicros();
+void platformMemory(PlatformMemory& out);
+void platformLog(const char* fmt, ...);
+void* platformAllocLarge(size_t bytes);  // PSRAM when the board has it
+
+#endif
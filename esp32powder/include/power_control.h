@@ -0,0 +1,148 @@
+#ifndef POWER_CONTROL_H
+#define POWER_CONTROL_H
+
+// Closed-loop TX power. Once per window the caller hands over what the tag
+// table shows for the tags read in it - how many, how many of them are the
+// station's own, and the average RSSI the weakest tenth of the own ones
+// sits at - and gets back the power to use next:
+//  - fewer own tags than minTags, or the weak tenth below lowRssi: up by
+//    POWER_CONTROL_UP_STEP at once, since stock is being lost;
+//  - more tags than maxTags (cross-reads), or the weak tenth above
+//    highRssi: down by POWER_CONTROL_DOWN_STEP, once POWER_CONTROL_DOWN_VOTES
+//    windows in a row ask for it;
+//  - in between, the hysteresis band, power stays.
+// The window after a change is not judged while the averages catch up. A
+// step up straight after a step down means the two rules are fighting; steps
+// down are then held off for POWER_CONTROL_HOLD windows. Read rate enters
+// only through the counts: a tag whose reads dry up drops out of the window.
+
+#include <stdint.h>
+#include <string.h>
+
+#define POWER_CONTROL_WINDOW_MS 2000
+#define POWER_CONTROL_UP_STEP 200    // centi-dBm
+#define POWER_CONTROL_DOWN_STEP 100
+#define POWER_CONTROL_DOWN_VOTES 3
+#define POWER_CONTROL_HOLD 30        // windows
+// The band has to be wider than a step up moves the weak tenth, or the two
+// rules take turns
+#define POWER_CONTROL_MIN_BAND 4       // dB
+#define POWER_CONTROL_RSSI_FLOOR -100  // RSSI histogram range, dBm
+#define POWER_CONTROL_RSSI_CEIL -20
+
+struct PowerControlConfig {
+  bool enabled;
+  int16_t minPower;   // centi-dBm
+  int16_t maxPower;
+  int8_t lowRssi;     // band for the weak tenth, dBm
+  int8_t highRssi;
+  uint16_t minTags;   // own tags, 0 = no lower bound
+  uint16_t maxTags;   // all tags, 0 = no upper bound
+};
+
+struct PowerControl {
+  PowerControlConfig config;
+  uint32_t windowStart;
+  uint8_t downVotes;
+  bool settling;        // first window after a change
+  bool lastStepDown;    // direction of the last change
+  uint8_t holdWindows;  // no steps down for this many more windows
+  uint32_t stepsUp;
+  uint32_t stepsDown;
+  uint32_t holds;       // times the hold-off kicked in
+  uint32_t lastTags;    // the last finished window, for status
+  uint32_t lastOwnTags;
+  int8_t lastWeakRssi;
+  const char* reason;   // why power did or did not move after it
+
+  void begin(uint32_t now) {
+    PowerControlConfig keep = config;
+    memset(this, 0, sizeof(*this));
+    config = keep;
+    reason = "";
+    restart(now);
+  }
+
+  bool windowDone(uint32_t now) const { return now - windowStart >= POWER_CONTROL_WINDOW_MS; }
+
+  // Drop the window without a decision (off, not scanning, power set by
+  // hand, ...)
+  void restart(uint32_t now) {
+    windowStart = now;
+    downVotes = 0;
+    settling = false;
+  }
+
+  // Close the window and return the power to use from now on
+  int decide(int power, uint32_t tags, uint32_t ownTags, int weakRssi, uint32_t now) {
+    windowStart = now;
+    lastTags = tags;
+    lastOwnTags = ownTags;
+    lastWeakRssi = (int8_t)weakRssi;
+    if (holdWindows > 0) holdWindows--;
+    // An empty field is only a reason to hold when no tags are expected
+    if (tags == 0 && !config.minTags) return hold(power, "no tags");
+    if (settling) {
+      settling = false;
+      reason = "settling";
+      return power;
+    }
+
+    bool up = (config.minTags && ownTags < config.minTags) || (ownTags > 0 && weakRssi < config.lowRssi);
+    bool down = (config.maxTags && tags > config.maxTags) || (ownTags > 0 && weakRssi > config.highRssi);
+    if (up) {
+      downVotes = 0;
+      reason = config.minTags && ownTags < config.minTags ? "tags missing" : "weak tags";
+      if (power >= config.maxPower) return hold(power, "at maximum");
+      if (lastStepDown) {
+        holdWindows = POWER_CONTROL_HOLD;
+        holds++;
+      }
+      stepsUp++;
+      return step(power + POWER_CONTROL_UP_STEP > config.maxPower ? config.maxPower : power + POWER_CONTROL_UP_STEP,
+                  false);
+    }
+    if (!down) return hold(power, "in band");
+    reason = config.maxTags && tags > config.maxTags ? "too many tags" : "strong tags";
+    if (power <= config.minPower) return hold(power, "at minimum");
+    if (holdWindows > 0) return hold(power, "held after oscillating");
+    if (++downVotes < POWER_CONTROL_DOWN_VOTES) return power;
+    stepsDown++;
+    return step(power - POWER_CONTROL_DOWN_STEP < config.minPower ? config.minPower : power - POWER_CONTROL_DOWN_STEP,
+                true);
+  }
+
+private:
+  int hold(int power, const char* why) {
+    downVotes = 0;
+    reason = why;
+    return power;
+  }
+
+  int step(int next, bool down) {
+    downVotes = 0;
+    settling = true;
+    lastStepDown = down;
+    return next;
+  }
+};
+
+// Average RSSI the weakest tenth of a set of tags sits at, from a histogram
+// of whole dBm (bin 0 = POWER_CONTROL_RSSI_FLOOR)
+#define POWER_CONTROL_BINS (POWER_CONTROL_RSSI_CEIL - POWER_CONTROL_RSSI_FLOOR + 1)
+
+inline int powerControlBin(float rssi) {
+  int bin = (int)(rssi - POWER_CONTROL_RSSI_FLOOR + 0.5f);
+  return bin < 0 ? 0 : bin >= POWER_CONTROL_BINS ? POWER_CONTROL_BINS - 1 : bin;
+}
+
+inline int powerControlWeakRssi(const uint16_t* bins, uint32_t count) {
+  uint32_t seen = 0;
+  for (int i = 0; i < POWER_CONTROL_BINS; i++) {
+    seen += bins[i];
+    if (seen * 10 >= count) return POWER_CONTROL_RSSI_FLOOR + i;
+  }
+  return POWER_CONTROL_RSSI_CEIL;
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef POWER_SWEEP_H
+#define POWER_SWEEP_H
+
+// TX power sweep for commissioning a station: step the power from one level
+// to another, dwell at each and count what the ingest path sees there -
+// distinct tags, reads and RSSI. A tag counts once per level, as the
+// station's own stock or as another (a cross-read from next door), which
+// the caller decides from its first read there. The recommendation is the
+// lowest level that still reads SWEEP_COVERAGE_PERCENT of the most own tags
+// any level read: more power than that only adds cross-reads.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "r200_frames.h"
+
+#define SWEEP_MAX_LEVELS 32
+#define SWEEP_MIN_DWELL_MS 500
+#define SWEEP_MAX_DWELL_MS 60000
+#define SWEEP_CONFIRM_MS 2000   // for the reader to report a level as set
+#define SWEEP_COVERAGE_PERCENT 95
+
+enum SweepState { SWEEP_IDLE, SWEEP_SETTING, SWEEP_DWELL, SWEEP_DONE, SWEEP_FAILED };
+
+struct SweepLevel {
+  int16_t power;        // centi-dBm
+  uint32_t tags;        // distinct tags read at this level
+  uint32_t ownTags;     // of those, the station's own
+  uint32_t reads;
+  int32_t rssiSum;      // over all reads
+  uint32_t ms;          // time spent counting
+
+  uint32_t otherTags() const { return tags - ownTags; }
+  float readsPerSecond() const { return ms ? reads * 1000.0f / ms : 0.0f; }
+  float rssiMean() const { return reads ? (float)rssiSum / reads : 0.0f; }
+};
+
+struct PowerSweep {
+  SweepState state;
+  int16_t from, to, step;  // centi-dBm
+  uint32_t dwellMs;
+  uint8_t levelCount;
+  uint8_t level;           // the level being set or counted
+  uint32_t stateAt;        // when state was entered
+  uint32_t levelStart;     // counting at this level started
+  SweepLevel levels[SWEEP_MAX_LEVELS];
+  const char* failure;
+  int restorePower;        // power and scanning to go back to afterwards
+  bool restoreScanning;
+  bool restorePending;     // not yet back to them
+
+  bool running() const { return state == SWEEP_SETTING || state == SWEEP_DWELL; }
+
+  // false when the range does not fit; the previous report is then kept
+  bool begin(int first, int last, int stepBy, uint32_t dwell, uint32_t now) {
+    if (first < R200_MIN_POWER || last > R200_MAX_POWER || first > last || stepBy <= 0) return false;
+    if (dwell < SWEEP_MIN_DWELL_MS || dwell > SWEEP_MAX_DWELL_MS) return false;
+    int count = (last - first) / stepBy + 1;
+    if (count > SWEEP_MAX_LEVELS) return false;
+    memset(levels, 0, sizeof(levels));
+    from = (int16_t)first;
+    to = (int16_t)last;
+    step = (int16_t)stepBy;
+    dwellMs = dwell;
+    levelCount = (uint8_t)count;
+    for (int i = 0; i < count; i++) levels[i].power = (int16_t)(first + i * stepBy);
+    level = 0;
+    failure = "";
+    enter(SWEEP_SETTING, now);
+    return true;
+  }
+
+  // firstAtLevel: the tag was not read since levelStart
+  void onRead(bool firstAtLevel, int8_t rssi, bool own) {
+    if (state != SWEEP_DWELL) return;
+    SweepLevel& current = levels[level];
+    current.reads++;
+    current.rssiSum += rssi;
+    if (!firstAtLevel) return;
+    current.tags++;
+    if (own) current.ownTags++;
+  }
+
+  // The reader reported the level's power: start counting
+  void confirmed(uint32_t now) {
+    levelStart = now;
+    enter(SWEEP_DWELL, now);
+  }
+
+  bool dwellDone(uint32_t now) const { return state == SWEEP_DWELL && now - levelStart >= dwellMs; }
+
+  // Close the current level; true while there is another one to set
+  bool nextLevel(uint32_t now) {
+    levels[level].ms = now - levelStart;
+    if (level + 1 >= levelCount) {
+      enter(SWEEP_DONE, now);
+      return false;
+    }
+    level++;
+    enter(SWEEP_SETTING, now);
+    return true;
+  }
+
+  void fail(const char* reason, uint32_t now) {
+    failure = reason;
+    enter(SWEEP_FAILED, now);
+  }
+
+  // Levels with a full dwell behind them
+  uint8_t levelsDone() const {
+    return state == SWEEP_DONE ? levelCount : level;
+  }
+
+  // Index of the recommended level, -1 when no level read an own tag
+  int recommended() const {
+    uint8_t done = levelsDone();
+    uint32_t best = 0;
+    for (uint8_t i = 0; i < done; i++) {
+      if (levels[i].ownTags > best) best = levels[i].ownTags;
+    }
+    if (best == 0) return -1;
+    for (uint8_t i = 0; i < done; i++) {
+      if (levels[i].ownTags * 100 >= best * SWEEP_COVERAGE_PERCENT) return i;
+    }
+    return -1;
+  }
+
+private:
+  void enter(SweepState next, uint32_t now) {
+    state = next;
+    stateAt = now;
+  }
+};
+
+inline const char* sweepStateName(SweepState state) {
+  switch (state) {
+    case SWEEP_SETTING: return "setting";
+    case SWEEP_DWELL: return "dwell";
+    case SWEEP_DONE: return "done";
+    case SWEEP_FAILED: return "failed";
+    default: return "idle";
+  }
+}
+
+#endif
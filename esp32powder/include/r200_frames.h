@@ -0,0 +1,317 @@
+#ifndef R200_FRAMES_H
+#define R200_FRAMES_H
+
+// R200 command frames (user manual, section 6.4 command list).
+//
+// Frames without parameters are R200FixedFrame<command, payload...>: the
+// bytes, length and checksum are all worked out by the compiler and the
+// frame sits in flash. Frames with parameters are built in an
+// R200FrameBuilder on the stack. Its buffer size is a template argument and
+// the header is part of the running sum, so the frame is complete after every
+// byte added - there is no checksum pass and no heap.
+//
+// Written for C++11 (the board toolchain), so the constexpr helpers are
+// single-expression recursions.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "r200_parser.h"
+#include "command_queue.h"
+
+// Command codes (R200_CMD_SINGLE_POLL and R200_CMD_ERROR are in r200_parser.h)
+#define R200_CMD_MODULE_INFO 0x03      // 0x00 hardware, 0x01 software, 0x02 manufacturer
+#define R200_CMD_IDLE 0x04
+#define R200_CMD_SET_REGION 0x07
+#define R200_CMD_GET_REGION 0x08
+#define R200_CMD_GET_SELECT 0x0B
+#define R200_CMD_SET_SELECT 0x0C
+#define R200_CMD_GET_QUERY 0x0D
+#define R200_CMD_SET_QUERY 0x0E
+#define R200_CMD_SET_BAUD 0x11
+#define R200_CMD_SET_SELECT_MODE 0x12
+#define R200_CMD_SLEEP 0x17
+#define R200_CMD_IO_CONTROL 0x1A
+#define R200_CMD_SET_SLEEP_TIME 0x1D
+#define R200_CMD_MULTIPLE_POLL 0x27
+#define R200_CMD_STOP_POLL 0x28
+#define R200_CMD_READ 0x39
+#define R200_CMD_WRITE 0x49
+#define R200_CMD_KILL 0x65
+#define R200_CMD_LOCK 0x82
+#define R200_CMD_INSERT_CHANNELS 0xA9
+#define R200_CMD_GET_CHANNEL 0xAA
+#define R200_CMD_SET_CHANNEL 0xAB
+#define R200_CMD_SET_HOPPING 0xAD
+#define R200_CMD_SET_CARRIER 0xB0
+#define R200_CMD_SET_POWER 0xB6
+#define R200_CMD_GET_POWER 0xB7
+#define R200_CMD_SET_DEMOD 0xF0
+#define R200_CMD_GET_DEMOD 0xF1
+#define R200_CMD_TEST_BLOCKING 0xF2
+#define R200_CMD_TEST_RSSI 0xF3
+
+// Memory banks for read, write and select
+#define R200_BANK_RESERVED 0x00
+#define R200_BANK_EPC 0x01
+#define R200_BANK_TID 0x02
+#define R200_BANK_USER 0x03
+
+// ========================================
+// Compile-time frames
+// ========================================
+constexpr uint8_t r200Sum() { return 0; }
+
+template <typename... Rest>
+constexpr uint8_t r200Sum(uint8_t first, Rest... rest) {
+  return (uint8_t)(first + r200Sum(rest...));
+}
+
+template <uint8_t Command, uint8_t... Payload>
+struct R200FixedFrame {
+  static constexpr uint16_t length = sizeof...(Payload);
+  static constexpr uint8_t checksum =
+      r200Sum(R200_TYPE_COMMAND, Command, (uint8_t)(length >> 8), (uint8_t)length, Payload...);
+  static constexpr uint8_t bytes[] = {R200_FRAME_HEADER, R200_TYPE_COMMAND, Command,
+                                      (uint8_t)(length >> 8), (uint8_t)length,
+                                      Payload..., checksum, R200_FRAME_END};
+};
+
+template <uint8_t Command, uint8_t... Payload>
+constexpr uint8_t R200FixedFrame<Command, Payload...>::bytes[];
+
+typedef R200FixedFrame<R200_CMD_MODULE_INFO, 0x00> R200HardwareVersionFrame;
+typedef R200FixedFrame<R200_CMD_MODULE_INFO, 0x01> R200SoftwareVersionFrame;
+typedef R200FixedFrame<R200_CMD_MODULE_INFO, 0x02> R200ManufacturerFrame;
+typedef R200FixedFrame<R200_CMD_SINGLE_POLL> R200SinglePollFrame;
+typedef R200FixedFrame<R200_CMD_MULTIPLE_POLL, 0x22, 0x27, 0x10> R200MultiplePollFrame;  // 10000 rounds
+typedef R200FixedFrame<R200_CMD_STOP_POLL> R200StopPollFrame;
+typedef R200FixedFrame<R200_CMD_GET_SELECT> R200GetSelectFrame;
+typedef R200FixedFrame<R200_CMD_GET_QUERY> R200GetQueryFrame;
+typedef R200FixedFrame<R200_CMD_GET_REGION> R200GetRegionFrame;
+typedef R200FixedFrame<R200_CMD_GET_CHANNEL> R200GetChannelFrame;
+typedef R200FixedFrame<R200_CMD_GET_POWER> R200GetPowerFrame;
+typedef R200FixedFrame<R200_CMD_GET_DEMOD> R200GetDemodFrame;
+typedef R200FixedFrame<R200_CMD_TEST_BLOCKING> R200TestBlockingFrame;
+typedef R200FixedFrame<R200_CMD_TEST_RSSI> R200TestRssiFrame;
+typedef R200FixedFrame<R200_CMD_SLEEP> R200SleepFrame;
+
+// Against the manual's example frames
+static_assert(R200HardwareVersionFrame::checksum == 0x04, "R200 hardware version checksum");
+static_assert(R200SoftwareVersionFrame::checksum == 0x05, "R200 software version checksum");
+static_assert(R200MultiplePollFrame::checksum == 0x83, "R200 multiple poll checksum");
+static_assert(R200GetPowerFrame::checksum == 0xB7, "R200 get power checksum");
+static_assert(sizeof(R200SinglePollFrame::bytes) == R200_FRAME_OVERHEAD, "R200 empty frame size");
+
+// Query parameters (0x0E), packed as the module expects:
+//   DR(15) | M(14-13) | TRext(12) | Sel(11-10) | Session(9-8) | Target(7) | Q(6-3)
+#define R200_SESSION_S0 0
+#define R200_SESSION_S1 1
+#define R200_SESSION_S2 2
+#define R200_SESSION_S3 3
+#define R200_TARGET_A 0
+#define R200_TARGET_B 1
+#define R200_SEL_ALL 0  // Sel field: 0/1 all tags, 2 ~SL, 3 SL
+#define R200_SEL_NOT_SL 2
+#define R200_SEL_SL 3
+
+// DR 8, M 1 (FM0) and TRext on, as the module ships
+constexpr uint16_t r200QueryParam(uint8_t sel, uint8_t session, uint8_t target, uint8_t q) {
+  return (uint16_t)(0x1000 | (sel & 3) << 10 | (session & 3) << 8 | (target & 1) << 7 | (q & 15) << 3);
+}
+
+static_assert(r200QueryParam(R200_SEL_ALL, R200_SESSION_S0, R200_TARGET_A, 4) == 0x1020,
+              "R200 default query parameters");
+
+// ========================================
+// Frames with parameters
+// ========================================
+template <size_t MaxPayload>
+class R200FrameBuilder {
+  static_assert(MaxPayload + R200_FRAME_OVERHEAD <= R200_COMMAND_MAX_LEN,
+                "R200 frame longer than the command queue holds");
+
+public:
+  explicit R200FrameBuilder(uint8_t command) : len(0), sum((uint8_t)(R200_TYPE_COMMAND + command)) {
+    bytes[0] = R200_FRAME_HEADER;
+    bytes[1] = R200_TYPE_COMMAND;
+    bytes[2] = command;
+    close();
+  }
+
+  // Bytes past MaxPayload are ignored
+  R200FrameBuilder& u8(uint8_t value) {
+    if (len == MaxPayload) return *this;
+    bytes[5 + len++] = value;
+    sum += value;
+    close();
+    return *this;
+  }
+
+  R200FrameBuilder& u16(uint16_t value) { return u8(value >> 8).u8(value & 0xFF); }
+  R200FrameBuilder& u32(uint32_t value) { return u16(value >> 16).u16(value & 0xFFFF); }
+
+  R200FrameBuilder& data(const uint8_t* values, size_t n) {
+    for (size_t i = 0; i < n; i++) u8(values[i]);
+    return *this;
+  }
+
+  const uint8_t* frame() const { return bytes; }
+  size_t size() const { return len + R200_FRAME_OVERHEAD; }
+
+private:
+  uint8_t bytes[MaxPayload + R200_FRAME_OVERHEAD];
+  size_t len;
+  uint8_t sum;  // type, command and payload so far
+
+  // Length, checksum and end byte for what is there now
+  void close() {
+    bytes[3] = (uint8_t)(len >> 8);
+    bytes[4] = (uint8_t)len;
+    bytes[5 + len] = (uint8_t)(sum + bytes[3] + bytes[4]);
+    bytes[6 + len] = R200_FRAME_END;
+  }
+};
+
+#define R200_MASK_MAX_BYTES 32
+#define R200_WRITE_MAX_WORDS 16
+
+// 0x27: poll rounds, 1..65535
+inline R200FrameBuilder<3> r200MultiplePollFrame(uint16_t rounds) {
+  return R200FrameBuilder<3>(R200_CMD_MULTIPLE_POLL).u8(0x22).u16(rounds);
+}
+
+// Transmit power range the module takes, centi-dBm
+#define R200_MIN_POWER 500
+#define R200_MAX_POWER 3300
+
+// 0xB6: transmit power in centi-dBm
+inline R200FrameBuilder<2> r200SetPowerFrame(uint16_t centiDbm) {
+  return R200FrameBuilder<2>(R200_CMD_SET_POWER).u16(centiDbm);
+}
+
+// 0x0C: select the tags whose bank bits from pointer (a bit address) match
+// maskBits bits of mask. selParam is Target(7-5) | Action(4-2) | MemBank(1-0).
+inline R200FrameBuilder<7 + R200_MASK_MAX_BYTES> r200SetSelectFrame(uint8_t selParam, uint32_t pointer,
+                                                                     const uint8_t* mask, uint8_t maskBits,
+                                                                     bool truncate = false) {
+  R200FrameBuilder<7 + R200_MASK_MAX_BYTES> frame(R200_CMD_SET_SELECT);
+  frame.u8(selParam).u32(pointer).u8(maskBits).u8(truncate ? 0x80 : 0x00);
+  return frame.data(mask, (maskBits + 7) / 8);
+}
+
+// 0x12: 0x00 send Select before every inventory, 0x01 never, 0x02 only
+// before reads, writes, locks and kills
+inline R200FrameBuilder<1> r200SetSelectModeFrame(uint8_t mode) {
+  return R200FrameBuilder<1>(R200_CMD_SET_SELECT_MODE).u8(mode);
+}
+
+// 0x0E: parameters from r200QueryParam()
+inline R200FrameBuilder<2> r200SetQueryFrame(uint16_t param) {
+  return R200FrameBuilder<2>(R200_CMD_SET_QUERY).u16(param);
+}
+
+// 0x39: read words from a tag memory bank
+inline R200FrameBuilder<9> r200ReadFrame(uint32_t password, uint8_t bank, uint16_t wordAddress,
+                                         uint16_t wordCount) {
+  return R200FrameBuilder<9>(R200_CMD_READ).u32(password).u8(bank).u16(wordAddress).u16(wordCount);
+}
+
+// 0x49: write words (2 bytes each) to a tag memory bank
+inline R200FrameBuilder<9 + 2 * R200_WRITE_MAX_WORDS> r200WriteFrame(uint32_t password, uint8_t bank,
+                                                                      uint16_t wordAddress, const uint8_t* words,
+                                                                      uint16_t wordCount) {
+  R200FrameBuilder<9 + 2 * R200_WRITE_MAX_WORDS> frame(R200_CMD_WRITE);
+  frame.u32(password).u8(bank).u16(wordAddress).u16(wordCount);
+  return frame.data(words, 2 * wordCount);
+}
+
+// 0x82: lock payload is the 20-bit mask/action field in the low 3 bytes
+inline R200FrameBuilder<7> r200LockFrame(uint32_t password, uint32_t lockPayload) {
+  return R200FrameBuilder<7>(R200_CMD_LOCK).u32(password).u8(lockPayload >> 16).u16(lockPayload & 0xFFFF);
+}
+
+inline R200FrameBuilder<4> r200KillFrame(uint32_t killPassword) {
+  return R200FrameBuilder<4>(R200_CMD_KILL).u32(killPassword);
+}
+
+// 0x07: 0x01 China 900 MHz, 0x02 US, 0x03 Europe, 0x04 China 800 MHz, 0x06 Korea
+#define R200_REGION_CHINA_900 0x01
+#define R200_REGION_US 0x02
+#define R200_REGION_EUROPE 0x03
+#define R200_REGION_CHINA_800 0x04
+#define R200_REGION_KOREA 0x06
+
+// Channel plan per region: channel n is at baseKHz + n * stepKHz
+struct R200RegionPlan {
+  uint8_t region;
+  uint8_t channels;
+  uint32_t baseKHz;
+  uint16_t stepKHz;
+};
+
+static const R200RegionPlan r200RegionPlans[] = {
+  {R200_REGION_CHINA_900, 20, 920125, 250},
+  {R200_REGION_US, 52, 902250, 500},
+  {R200_REGION_EUROPE, 15, 865100, 200},
+  {R200_REGION_CHINA_800, 20, 840125, 250},
+  {R200_REGION_KOREA, 32, 917100, 200},
+};
+
+// nullptr for a region the module does not know
+inline const R200RegionPlan* r200RegionPlan(uint8_t region) {
+  for (size_t i = 0; i < sizeof(r200RegionPlans) / sizeof(r200RegionPlans[0]); i++) {
+    if (r200RegionPlans[i].region == region) return &r200RegionPlans[i];
+  }
+  return nullptr;
+}
+
+inline R200FrameBuilder<1> r200SetRegionFrame(uint8_t region) {
+  return R200FrameBuilder<1>(R200_CMD_SET_REGION).u8(region);
+}
+
+inline R200FrameBuilder<1> r200SetChannelFrame(uint8_t channel) {
+  return R200FrameBuilder<1>(R200_CMD_SET_CHANNEL).u8(channel);
+}
+
+inline R200FrameBuilder<1> r200SetHoppingFrame(bool on) {
+  return R200FrameBuilder<1>(R200_CMD_SET_HOPPING).u8(on ? 0xFF : 0x00);
+}
+
+// 0xA9: the channels to hop over
+#define R200_HOP_CHANNELS_MAX 50
+inline R200FrameBuilder<1 + R200_HOP_CHANNELS_MAX> r200InsertChannelsFrame(const uint8_t* channels, uint8_t count) {
+  R200FrameBuilder<1 + R200_HOP_CHANNELS_MAX> frame(R200_CMD_INSERT_CHANNELS);
+  frame.u8(count);
+  return frame.data(channels, count);
+}
+
+inline R200FrameBuilder<1> r200SetCarrierFrame(bool on) {
+  return R200FrameBuilder<1>(R200_CMD_SET_CARRIER).u8(on ? 0xFF : 0x00);
+}
+
+// 0xF0: mixer gain, IF amplifier gain, signal threshold
+inline R200FrameBuilder<4> r200SetDemodFrame(uint8_t mixerGain, uint8_t ifGain, uint16_t threshold) {
+  return R200FrameBuilder<4>(R200_CMD_SET_DEMOD).u8(mixerGain).u8(ifGain).u16(threshold);
+}
+
+// 0x1A: pin, operation, value
+inline R200FrameBuilder<3> r200IoControlFrame(uint8_t param0, uint8_t param1, uint8_t param2) {
+  return R200FrameBuilder<3>(R200_CMD_IO_CONTROL).u8(param0).u8(param1).u8(param2);
+}
+
+inline R200FrameBuilder<1> r200SetSleepTimeFrame(uint8_t minutes) {
+  return R200FrameBuilder<1>(R200_CMD_SET_SLEEP_TIME).u8(minutes);
+}
+
+// 0x04: enter (true) or leave idle, going idle after minutes without commands
+inline R200FrameBuilder<3> r200IdleFrame(bool enter, uint8_t minutes) {
+  return R200FrameBuilder<3>(R200_CMD_IDLE).u8(enter ? 0x01 : 0x00).u8(0x01).u8(minutes);
+}
+
+// 0x11: the new rate takes effect after the reply
+inline R200FrameBuilder<2> r200SetBaudFrame(uint32_t baud) {
+  return R200FrameBuilder<2>(R200_CMD_SET_BAUD).u16(baud / 100);
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef R200_PARSER_H
+#define R200_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// R200 frame layout (see R200 user manual, section 6):
+//   AA | type | command | lenH | lenL | payload[len] | checksum | DD
+// checksum = 8-bit SUM of type..last payload byte (not XOR!)
+#define R200_FRAME_HEADER 0xAA
+#define R200_FRAME_END 0xDD
+#define R200_FRAME_OVERHEAD 7     // header, type, cmd, len x2, checksum, end
+#define R200_MAX_PAYLOAD 255      // longest reply we ever expect from the module
+
+// Frame types
+#define R200_TYPE_COMMAND 0x00
+#define R200_TYPE_RESPONSE 0x01
+#define R200_TYPE_NOTICE 0x02
+
+// Command codes we care about on the receive side
+#define R200_CMD_SINGLE_POLL 0x22
+#define R200_CMD_ERROR 0xFF
+
+// View onto a validated frame. payload points into the parser's buffer and is
+// only valid inside the frame callback - copy anything you need to keep.
+struct R200Frame {
+  uint8_t type;
+  uint8_t command;
+  uint16_t length;
+  const uint8_t* payload;
+};
+
+struct R200ParserStats {
+  uint32_t frames;          // valid frames delivered
+  uint32_t checksumErrors;  // checksum byte did not match
+  uint32_t framingErrors;   // bad type, oversized length or missing 0xDD
+  uint32_t bytesDiscarded;  // bytes skipped while hunting for 0xAA
+};
+
+// Incremental, length-driven parser. Feed it bytes as they come off the UART;
+// on any error it rescans the bytes it already holds for the next 0xAA, so a
+// real frame hiding behind a corrupt one is not lost.
+class R200FrameParser {
+public:
+  R200FrameParser() { reset(); memset(&stats, 0, sizeof(stats)); }
+
+  void reset() {
+    state = WAIT_HEADER;
+    count = 0;
+    expected = 0;
+    sum = 0;
+  }
+
+  template <typename Handler>
+  void push(uint8_t b, Handler&& onFrame) {
+    Result r = step(b);
+    if (r == FRAME) {
+      deliver(onFrame);
+    } else if (r == ERROR) {
+      resync(onFrame);
+    }
+  }
+
+  template <typename Handler>
+  void push(const uint8_t* data, size_t len, Handler&& onFrame) {
+    for (size_t i = 0; i < len; i++) push(data[i], onFrame);
+  }
+
+  const R200ParserStats& getStats() const { return stats; }
+  void clearStats() { memset(&stats, 0, sizeof(stats)); }
+
+private:
+  enum State { WAIT_HEADER, TYPE, COMMAND, LEN_HI, LEN_LO, PAYLOAD, CHECKSUM, END };
+  enum Result { NONE, FRAME, ERROR };
+
+  uint8_t buf[R200_MAX_PAYLOAD + R200_FRAME_OVERHEAD];
+  State state;
+  uint16_t count;     // bytes of the current candidate frame held in buf
+  uint16_t expected;  // payload length from the length field
+  uint8_t sum;        // running checksum
+  R200ParserStats stats;
+
+  Result step(uint8_t b) {
+    if (state == WAIT_HEADER) {
+      if (b != R200_FRAME_HEADER) {
+        stats.bytesDiscarded++;
+        return NONE;
+      }
+      buf[0] = b;
+      count = 1;
+      sum = 0;
+      state = TYPE;
+      return NONE;
+    }
+
+    buf[count++] = b;
+
+    switch (state) {
+      case TYPE:
+        if (b > R200_TYPE_NOTICE) {
+          stats.framingErrors++;
+          return ERROR;
+        }
+        sum += b;
+        state = COMMAND;
+        break;
+      case COMMAND:
+        sum += b;
+        state = LEN_HI;
+        break;
+      case LEN_HI:
+        sum += b;
+        state = LEN_LO;
+        break;
+      case LEN_LO:
+        sum += b;
+        expected = ((uint16_t)buf[3] << 8) | b;
+        if (expected > R200_MAX_PAYLOAD) {
+          stats.framingErrors++;
+          return ERROR;
+        }
+        state = expected > 0 ? PAYLOAD : CHECKSUM;
+        break;
+      case PAYLOAD:
+        sum += b;
+        if (count == 5 + expected) state = CHECKSUM;
+        break;
+      case CHECKSUM:
+        if (b != sum) {
+          stats.checksumErrors++;
+          return ERROR;
+        }
+        state = END;
+        break;
+      case END:
+        if (b != R200_FRAME_END) {
+          stats.framingErrors++;
+          return ERROR;
+        }
+        stats.frames++;
+        return FRAME;
+      default:
+        break;
+    }
+    return NONE;
+  }
+
+  template <typename Handler>
+  void deliver(Handler& onFrame) {
+    R200Frame frame;
+    frame.type = buf[1];
+    frame.command = buf[2];
+    frame.length = expected;
+    frame.payload = buf + 5;
+    reset();
+    onFrame(frame);
+  }
+
+  // Drop the bad header byte and replay what is left of the candidate through
+  // the state machine, starting at the next 0xAA. Replay writes at or behind
+  // the read position, so it runs in place without a second buffer.
+  template <typename Handler>
+  void resync(Handler& onFrame) {
+    while (true) {
+      uint16_t start = 1;
+      while (start < count && buf[start] != R200_FRAME_HEADER) start++;
+      stats.bytesDiscarded += start;
+
+      uint16_t tail = count - start;
+      memmove(buf, buf + start, tail);
+      reset();
+
+      bool failed = false;
+      for (uint16_t i = 0; i < tail; i++) {
+        Result r = step(buf[i]);
+        if (r == FRAME) {
+          // The frame sits in buf[0..i], behind the bytes still to replay,
+          // so it stays intact until the callback returns.
+          deliver(onFrame);
+        } else if (r == ERROR) {
+          // Rejoin the failed candidate with the bytes not yet replayed
+          uint16_t rest = tail - (i + 1);
+          memmove(buf + count, buf + i + 1, rest);
+          count += rest;
+          failed = true;
+          break;
+        }
+      }
+      if (!failed) return;
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef R200_REPLIES_H
+#define R200_REPLIES_H
+
+// Decoder for R200 response frames. One table row per command code gives the
+// reply layout and the shortest payload it can have; r200DecodeReply() checks
+// the length once and fills a typed R200Reply. Pointers in the reply point
+// into the frame payload and are only valid as long as the frame is; text is
+// copied into the reply, so nothing is allocated.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "r200_parser.h"
+#include "r200_frames.h"
+
+enum R200ReplyKind {
+  R200_REPLY_ACK,          // set commands: one status byte, 0x00 = done
+  R200_REPLY_MODULE_INFO,  // 0x03
+  R200_REPLY_POWER,        // 0xB7
+  R200_REPLY_MEMORY,       // 0x39 read, 0x49 write
+  R200_REPLY_SELECT,       // 0x0B
+  R200_REPLY_QUERY,        // 0x0D
+  R200_REPLY_REGION,       // 0x08
+  R200_REPLY_CHANNEL,      // 0xAA
+  R200_REPLY_DEMOD,        // 0xF1
+  R200_REPLY_ERROR         // 0xFF
+};
+
+// Error codes in 0xFF frames. For tag operations the high nibble forms
+// (0xA0 | x ...) carry the tag's own Gen2 error code in the low nibble.
+#define R200_ERROR_COMMAND 0x17
+#define R200_ERROR_FHSS_FAIL 0x20
+#define R200_ERROR_ACCESS_FAIL 0x16  // wrong access password
+#define R200_ERROR_READ_FAIL 0x09
+#define R200_ERROR_WRITE_FAIL 0x10   // no tag answered the write - worth another try
+#define R200_ERROR_LOCK_FAIL 0x13
+#define R200_ERROR_KILL_FAIL 0x12
+#define R200_ERROR_READ_TAG 0xA0
+#define R200_ERROR_WRITE_TAG 0xB0
+#define R200_ERROR_LOCK_TAG 0xC0
+#define R200_ERROR_KILL_TAG 0xD0
+
+#define R200_INFO_MAX 32
+
+// Tag identity (UL | PC | EPC) in memory and error replies
+struct R200TagId {
+  const uint8_t* pc;   // nullptr when the reply names no tag
+  const uint8_t* epc;
+  uint8_t epcLen;
+};
+
+struct R200Reply {
+  uint8_t command;  // the command answered, or R200_CMD_ERROR
+  R200ReplyKind kind;
+  union {
+    uint8_t status;  // ACK
+    struct {
+      uint8_t type;  // 0x00 hardware, 0x01 software, 0x02 manufacturer
+      char text[R200_INFO_MAX + 1];
+    } info;
+    uint16_t power;  // centi-dBm
+    struct {
+      R200TagId tag;
+      const uint8_t* data;  // read: the words read; write: nullptr
+      uint8_t dataLen;
+      uint8_t status;       // write: 0x00 = written
+    } memory;
+    struct {
+      uint8_t selParam;
+      uint32_t pointer;  // bit address
+      uint8_t maskBits;
+      bool truncate;
+      const uint8_t* mask;
+    } select;
+    struct {
+      uint16_t param;
+      uint8_t sel;
+      uint8_t session;
+      uint8_t target;
+      uint8_t q;
+    } query;
+    uint8_t region;
+    uint8_t channel;
+    struct {
+      uint8_t mixerGain;
+      uint8_t ifGain;
+      uint16_t threshold;
+    } demod;
+    struct {
+      uint8_t code;
+      R200TagId tag;
+    } error;
+  };
+};
+
+typedef void (*R200ReplyDecode)(const R200Frame& frame, R200Reply& out);
+
+struct R200ReplyLayout {
+  uint8_t command;
+  R200ReplyKind kind;
+  uint8_t minLength;
+  R200ReplyDecode decode;
+};
+
+// UL | PC | EPC at p, when there is room for it
+inline int r200TagId(const uint8_t* p, int n, R200TagId& out) {
+  out.pc = nullptr;
+  out.epc = nullptr;
+  out.epcLen = 0;
+  if (n < 3 || p[0] < 2 || p[0] > n - 1) return 0;
+  out.pc = p + 1;
+  out.epc = p + 3;
+  out.epcLen = p[0] - 2;
+  return p[0] + 1;
+}
+
+inline void r200DecodeAck(const R200Frame& frame, R200Reply& out) {
+  out.status = frame.payload[0];
+}
+
+inline void r200DecodeInfo(const R200Frame& frame, R200Reply& out) {
+  out.info.type = frame.payload[0];
+  int n = frame.length - 1 < R200_INFO_MAX ? frame.length - 1 : R200_INFO_MAX;
+  memcpy(out.info.text, frame.payload + 1, n);
+  out.info.text[n] = '\0';
+}
+
+inline void r200DecodePower(const R200Frame& frame, R200Reply& out) {
+  out.power = (uint16_t)(frame.payload[0] << 8 | frame.payload[1]);
+}
+
+// Read: UL | PC | EPC | data. Write: UL | PC | EPC | status.
+inline void r200DecodeMemory(const R200Frame& frame, R200Reply& out) {
+  int used = r200TagId(frame.payload, frame.length, out.memory.tag);
+  const uint8_t* rest = frame.payload + used;
+  int n = frame.length - used;
+  out.memory.data = nullptr;
+  out.memory.dataLen = 0;
+  out.memory.status = 0x00;
+  if (frame.command == R200_CMD_WRITE) {
+    out.memory.status = n > 0 ? rest[n - 1] : 0xFF;
+  } else {
+    out.memory.data = rest;
+    out.memory.dataLen = (uint8_t)n;
+  }
+}
+
+inline void r200DecodeSelect(const R200Frame& frame, R200Reply& out) {
+  const uint8_t* p = frame.payload;
+  out.select.selParam = p[0];
+  out.select.pointer = (uint32_t)p[1] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 8 | p[4];
+  out.select.maskBits = p[5];
+  out.select.truncate = p[6] == 0x80;
+  out.select.mask = p + 7;
+  if ((frame.length - 7) * 8 < out.select.maskBits) out.select.maskBits = (uint8_t)((frame.length - 7) * 8);
+}
+
+inline void r200DecodeQuery(const R200Frame& frame, R200Reply& out) {
+  uint16_t param = (uint16_t)(frame.payload[0] << 8 | frame.payload[1]);
+  out.query.param = param;
+  out.query.sel = (param >> 10) & 3;
+  out.query.session = (param >> 8) & 3;
+  out.query.target = (param >> 7) & 1;
+  out.query.q = (param >> 3) & 15;
+}
+
+inline void r200DecodeRegion(const R200Frame& frame, R200Reply& out) {
+  out.region = frame.payload[0];
+}
+
+inline void r200DecodeChannel(const R200Frame& frame, R200Reply& out) {
+  out.channel = frame.payload[0];
+}
+
+inline void r200DecodeDemod(const R200Frame& frame, R200Reply& out) {
+  out.demod.mixerGain = frame.payload[0];
+  out.demod.ifGain = frame.payload[1];
+  out.demod.threshold = (uint16_t)(frame.payload[2] << 8 | frame.payload[3]);
+}
+
+// code | UL | PC | EPC, or just the code when no tag answered
+inline void r200DecodeError(const R200Frame& frame, R200Reply& out) {
+  out.error.code = frame.payload[0];
+  r200TagId(frame.payload + 1, frame.length - 1, out.error.tag);
+}
+
+static const R200ReplyLayout r200ReplyLayouts[] = {
+  {R200_CMD_MODULE_INFO, R200_REPLY_MODULE_INFO, 1, r200DecodeInfo},
+  {R200_CMD_GET_POWER, R200_REPLY_POWER, 2, r200DecodePower},
+  {R200_CMD_READ, R200_REPLY_MEMORY, 1, r200DecodeMemory},
+  {R200_CMD_WRITE, R200_REPLY_MEMORY, 1, r200DecodeMemory},
+  {R200_CMD_GET_SELECT, R200_REPLY_SELECT, 7, r200DecodeSelect},
+  {R200_CMD_GET_QUERY, R200_REPLY_QUERY, 2, r200DecodeQuery},
+  {R200_CMD_GET_REGION, R200_REPLY_REGION, 1, r200DecodeRegion},
+  {R200_CMD_GET_CHANNEL, R200_REPLY_CHANNEL, 1, r200DecodeChannel},
+  {R200_CMD_GET_DEMOD, R200_REPLY_DEMOD, 4, r200DecodeDemod},
+  {R200_CMD_ERROR, R200_REPLY_ERROR, 1, r200DecodeError},
+  {R200_CMD_SET_POWER, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_STOP_POLL, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_SELECT, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_SELECT_MODE, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_QUERY, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_REGION, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_CHANNEL, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_HOPPING, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_INSERT_CHANNELS, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_CARRIER, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_DEMOD, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_LOCK, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_KILL, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_IO_CONTROL, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_SLEEP_TIME, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_IDLE, R200_REPLY_ACK, 1, r200DecodeAck},
+  {R200_CMD_SET_BAUD, R200_REPLY_ACK, 1, r200DecodeAck},
+};
+
+// false for notices, unknown commands and replies too short for their layout
+inline bool r200DecodeReply(const R200Frame& frame, R200Reply& out) {
+  if (frame.type != R200_TYPE_RESPONSE) return false;
+  for (size_t i = 0; i < sizeof(r200ReplyLayouts) / sizeof(r200ReplyLayouts[0]); i++) {
+    const R200ReplyLayout& layout = r200ReplyLayouts[i];
+    if (layout.command != frame.command) continue;
+    if (frame.length < layout.minLength) return false;
+    out.command = frame.command;
+    out.kind = layout.kind;
+    layout.decode(frame, out);
+    return true;
+  }
+  return false;
+}
+
+inline const char* r200ErrorName(uint8_t code) {
+  switch (code) {
+    case R200_ERROR_COMMAND: return "command error";
+    case R200_ERROR_FHSS_FAIL: return "frequency hopping failed";
+    case R200_ERROR_INVENTORY_FAIL: return "no tag";
+    case R200_ERROR_ACCESS_FAIL: return "wrong access password";
+    case R200_ERROR_READ_FAIL: return "read failed";
+    case R200_ERROR_WRITE_FAIL: return "write failed";
+    case R200_ERROR_LOCK_FAIL: return "lock failed";
+    case R200_ERROR_KILL_FAIL: return "kill failed";
+    default: break;
+  }
+  switch (code & 0xF0) {
+    case R200_ERROR_READ_TAG: return "tag refused read";
+    case R200_ERROR_WRITE_TAG: return "tag refused write";
+    case R200_ERROR_LOCK_TAG: return "tag refused lock";
+    case R200_ERROR_KILL_TAG: return "tag refused kill";
+    default: return "unknown error";
+  }
+}
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef READING_LOG_H
+#define READING_LOG_H
+
+// Persistent reading log. Fixed-size records are appended to segment files
+// (one file per LOG_SEGMENT_RECORDS reads, named after the first sequence
+// number it holds) and the oldest segment is deleted once the limit is
+// reached. Reads are buffered in RAM and written as one group, so flash sees
+// a few large appends instead of one write per tag read. Losing power
+// without a commit() loses that group: at most LOG_COMMIT_RECORDS reads, or
+// LOG_COMMIT_MS of them.
+//
+// Sequence numbers keep counting across reboots. Record times come from the
+// log clock: milliseconds of logged uptime, resumed from the last record at
+// boot, so they only ever increase.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+#include "tag_store.h"
+
+#define LOG_DIR "/log"
+#define LOG_SEGMENT_RECORDS 2048  // 44 KB per segment file
+#define LOG_SEGMENTS_MAX 64
+#define LOG_COMMIT_RECORDS 128    // group commit size
+#define LOG_COMMIT_MS 1000        // or the age of the oldest buffered read
+
+struct __attribute__((packed)) LogRecord {
+  uint32_t seq;
+  uint32_t time;  // log clock, ms
+  uint8_t epc[EPC_LEN];
+  int8_t rssi;
+  uint8_t check;  // catches torn or stale bytes at a segment tail
+};
+
+struct LogStats {
+  uint32_t appended;
+  uint32_t commits;
+  uint32_t bytesWritten;
+  uint32_t writeErrors;
+  uint32_t lost;              // reads that never reached flash
+  uint32_t segmentsDropped;   // rotated out or unreadable at boot
+  uint32_t recovered;         // records found at boot
+  uint32_t recoveryReads;     // file reads the boot scan needed
+};
+
+class ReadingLog {
+public:
+  ReadingLog() : files(nullptr), maxSegments(0), segmentCount(0), pending(0), pendingSince(0),
+                 nextSeq(1), clockOffset(0), newSegment(true) {
+    memset(&stats, 0, sizeof(stats));
+  }
+
+  // Find the segments on flash and resume numbering after the last valid
+  // record. Every segment costs two reads (head and tail group), so the scan
+  // time is bounded by maxSegments, not by how much was logged.
+  void begin(FileStore* store, int segments) {
+    files = store;
+    maxSegments = segments < LOG_SEGMENTS_MAX ? segments : LOG_SEGMENTS_MAX;
+    segmentCount = 0;
+    pending = 0;
+    files->list(LOG_DIR, addSegment, this);
+
+    for (int i = 0; i < segmentCount;) {
+      if (recoverSegment(segmentList[i])) {
+        stats.recovered += segmentList[i].count;
+        i++;
+      } else {
+        removeSegment(i);
+      }
+    }
+    while (segmentCount > maxSegments) removeSegment(0);
+
+    uint32_t lastTime = 0;
+    if (segmentCount > 0) {
+      Segment& last = segmentList[segmentCount - 1];
+      nextSeq = last.firstSeq + last.count;
+      LogRecord record;
+      if (readRecord(last, last.count - 1, record)) lastTime = record.time + 1;
+    }
+    clockOffset = lastTime - platformMillis();
+    // Never append behind a tail that may have been cut short
+    newSegment = true;
+  }
+
+  bool ready() const { return files != nullptr; }
+  uint32_t now() const { return platformMillis() + clockOffset; }
+
+  void append(const uint8_t* epc, int8_t rssi, uint32_t ms) {
+    if (pending == 0) pendingSince = ms;
+    LogRecord& record = buffer[pending++];
+    record.seq = nextSeq++;
+    record.time = ms + clockOffset;
+    memcpy(record.epc, epc, EPC_LEN);
+    record.rssi = rssi;
+    record.check = checkByte(record);
+    stats.appended++;
+    if (pending == LOG_COMMIT_RECORDS) commit();
+  }
+
+  // Group commit once the oldest buffered read has waited long enough
+  void poll(uint32_t ms) {
+    if (pending > 0 && ms - pendingSince >= LOG_COMMIT_MS) commit();
+  }
+
+  // Write everything buffered now, e.g. before the reader stops
+  void commit() {
+    int done = 0;
+    while (done < pending) {
+      if (newSegment || segmentCount == 0 || segmentList[segmentCount - 1].count == LOG_SEGMENT_RECORDS) {
+        startSegment(buffer[done]);
+      }
+      Segment& segment = segmentList[segmentCount - 1];
+      int room = LOG_SEGMENT_RECORDS - segment.count;
+      int n = pending - done < room ? pending - done : room;
+      char path[24];
+      segmentPath(segment.firstSeq, path, sizeof(path));
+      size_t bytes = n * sizeof(LogRecord);
+      if (files->append(path, (const uint8_t*)&buffer[done], bytes)) {
+        segment.count += n;
+        stats.bytesWritten += bytes;
+      } else {
+        // Whatever part made it is unknown; later records go to a new file
+        stats.writeErrors++;
+        stats.lost += n;
+        newSegment = true;
+      }
+      done += n;
+    }
+    if (pending > 0) stats.commits++;
+    pending = 0;
+  }
+
+  uint32_t firstSeq() const {
+    if (segmentCount > 0) return segmentList[0].firstSeq;
+    return pending > 0 ? buffer[0].seq : nextSeq;
+  }
+  uint32_t lastSeq() const { return nextSeq - 1; }  // 0 if nothing logged yet
+  int segments() const { return segmentCount; }
+  int buffered() const { return pending; }
+  const LogStats& getStats() const { return stats; }
+
+  // Up to max records starting at the first sequence number >= seq, from one
+  // segment (or the unwritten buffer). 0 when nothing is left.
+  uint32_t read(uint32_t seq, LogRecord* out, uint32_t max) {
+    for (int i = 0; i < segmentCount; i++) {
+      const Segment& segment = segmentList[i];
+      if (seq >= segment.firstSeq + segment.count) continue;
+      uint32_t index = seq > segment.firstSeq ? seq - segment.firstSeq : 0;
+      uint32_t n = segment.count - index;
+      if (n > max) n = max;
+      char path[24];
+      segmentPath(segment.firstSeq, path, sizeof(path));
+      size_t got = files->read(path, index * sizeof(LogRecord), (uint8_t*)out, n * sizeof(LogRecord));
+      return got / sizeof(LogRecord);
+    }
+    uint32_t n = 0;
+    for (int i = 0; i < pending && n < max; i++) {
+      if (buffer[i].seq >= seq) out[n++] = buffer[i];
+    }
+    return n;
+  }
+
+  // First sequence number logged at or after time (log clock), lastSeq() + 1
+  // when there is none. Binary search over segments, then within one.
+  uint32_t seqAtTime(uint32_t time) {
+    int lo = 0;
+    int hi = segmentCount;
+    while (lo < hi) {  // first segment starting after time
+      int mid = (lo + hi) / 2;
+      if (segmentList[mid].firstTime > time) hi = mid; else lo = mid + 1;
+    }
+    if (lo > 0) {
+      const Segment& segment = segmentList[lo - 1];
+      uint32_t a = 0;
+      uint32_t b = segment.count;
+      LogRecord record;
+      while (a < b) {
+        uint32_t mid = (a + b) / 2;
+        if (!readRecord(segment, mid, record)) break;
+        if (record.time < time) a = mid + 1; else b = mid;
+      }
+      if (a < segment.count) return segment.firstSeq + a;
+    }
+    if (lo < segmentCount) return segmentList[lo].firstSeq;
+    for (int i = 0; i < pending; i++) {
+      if (buffer[i].time >= time) return buffer[i].seq;
+    }
+    return nextSeq;
+  }
+
+  static bool valid(const LogRecord& record) { return record.check == checkByte(record); }
+
+private:
+  struct Segment {
+    uint32_t firstSeq;
+    uint32_t count;
+    uint32_t firstTime;
+  };
+
+  FileStore* files;
+  int maxSegments;
+  Segment segmentList[LOG_SEGMENTS_MAX + 1];
+  int segmentCount;
+  LogRecord buffer[LOG_COMMIT_RECORDS];
+  int pending;
+  uint32_t pendingSince;
+  uint32_t nextSeq;
+  uint32_t clockOffset;
+  bool newSegment;
+  LogStats stats;
+
+  static uint8_t checkByte(const LogRecord& record) {
+    const uint8_t* p = (const uint8_t*)&record;
+    uint8_t sum = 0x5A;
+    for (size_t i = 0; i < offsetof(LogRecord, check); i++) sum = (uint8_t)((sum << 1 | sum >> 7) ^ p[i]);
+    return sum;
+  }
+
+  static void segmentPath(uint32_t firstSeq, char* out, size_t size) {
+    snprintf(out, size, LOG_DIR "/%08X", (unsigned)firstSeq);
+  }
+
+  // Directory listing callback: keep segments sorted by first sequence
+  static void addSegment(void* context, const char* name, uint32_t size) {
+    ReadingLog* log = (ReadingLog*)context;
+    char* end;
+    uint32_t firstSeq = strtoul(name, &end, 16);
+    if (*end != '\0' || strlen(name) != 8) return;
+    if (log->segmentCount == LOG_SEGMENTS_MAX + 1) {
+      // More files than we track: the oldest go first
+      if (firstSeq < log->segmentList[0].firstSeq) {
+        log->dropFile(firstSeq);
+        return;
+      }
+      log->removeSegment(0);
+    }
+    int i = log->segmentCount++;
+    while (i > 0 && log->segmentList[i - 1].firstSeq > firstSeq) {
+      log->segmentList[i] = log->segmentList[i - 1];
+      i--;
+    }
+    log->segmentList[i].firstSeq = firstSeq;
+    log->segmentList[i].count = size / sizeof(LogRecord);
+    log->segmentList[i].firstTime = 0;
+  }
+
+  bool readRecord(const Segment& segment, uint32_t index, LogRecord& record) {
+    char path[24];
+    segmentPath(segment.firstSeq, path, sizeof(path));
+    size_t got = files->read(path, index * sizeof(LogRecord), (uint8_t*)&record, sizeof(record));
+    return got == sizeof(record) && valid(record) && record.seq == segment.firstSeq + index;
+  }
+
+  // Check the head, then trim the count back to the last intact record of
+  // the final group - only the last commit before a reset can be damaged
+  bool recoverSegment(Segment& segment) {
+    if (segment.count == 0) return false;
+    if (segment.count > LOG_SEGMENT_RECORDS) segment.count = LOG_SEGMENT_RECORDS;
+    LogRecord head;
+    stats.recoveryReads++;
+    if (!readRecord(segment, 0, head)) return false;
+    segment.firstTime = head.time;
+
+    uint32_t tail = segment.count < LOG_COMMIT_RECORDS ? segment.count : LOG_COMMIT_RECORDS;
+    uint32_t start = segment.count - tail;
+    char path[24];
+    segmentPath(segment.firstSeq, path, sizeof(path));
+    stats.recoveryReads++;
+    size_t got = files->read(path, start * sizeof(LogRecord), (uint8_t*)buffer, tail * sizeof(LogRecord));
+    uint32_t intact = got / sizeof(LogRecord);
+    uint32_t n = 0;
+    while (n < intact && valid(buffer[n]) && buffer[n].seq == segment.firstSeq + start + n) n++;
+    segment.count = start + n;
+    return segment.count > 0;
+  }
+
+  void startSegment(const LogRecord& first) {
+    if (segmentCount == maxSegments) removeSegment(0);
+    Segment& segment = segmentList[segmentCount++];
+    segment.firstSeq = first.seq;
+    segment.count = 0;
+    segment.firstTime = first.time;
+    newSegment = false;
+  }
+
+  void dropFile(uint32_t firstSeq) {
+    char path[24];
+    segmentPath(firstSeq, path, sizeof(path));
+    files->remove(path);
+    stats.segmentsDropped++;
+  }
+
+  void removeSegment(int i) {
+    dropFile(segmentList[i].firstSeq);
+    memmove(&segmentList[i], &segmentList[i + 1], (segmentCount - i - 1) * sizeof(Segment));
+    segmentCount--;
+  }
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+// Single-producer/single-consumer ring, lock-free. The producer fills a slot
+// in place (reserve + commit) and the consumer reads it in place (front +
+// pop), so nothing is copied twice and neither side ever blocks the other.
+// Indices run freely and are masked, so N must be a power of two.
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint32_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+  SpscQueue() : head(0), tail(0), highWater(0) {}
+
+  // Producer side
+  T* reserve() {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == N) return nullptr;
+    return &slots[h & (N - 1)];
+  }
+
+  void commit() {
+    uint32_t h = head.load(std::memory_order_relaxed) + 1;
+    head.store(h, std::memory_order_release);
+    uint32_t used = h - tail.load(std::memory_order_relaxed);
+    if (used > highWater.load(std::memory_order_relaxed)) highWater.store(used, std::memory_order_relaxed);
+  }
+
+  bool full() const {
+    return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) == N;
+  }
+
+  // Consumer side
+  T* front() {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return nullptr;
+    return &slots[t & (N - 1)];
+  }
+
+  void pop() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // Either side, approximate while the other is running
+  uint32_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+  uint32_t capacity() const { return N; }
+  uint32_t highWaterMark() const { return highWater.load(std::memory_order_relaxed); }
+
+private:
+  T slots[N];
+  std::atomic<uint32_t> head;       // written by the producer
+  std::atomic<uint32_t> tail;       // written by the consumer
+  std::atomic<uint32_t> highWater;  // most slots ever in use
+};
+
+#endif
@@ -0,0 +1,278 @@
+#ifndef TAG_STORE_H
+#define TAG_STORE_H
+
+// Fixed-size tag and reading records. EPC, PC and CRC are kept as raw bytes
+// and only turned into hex at the API edge, so the read path never touches
+// the heap.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define EPC_LEN 12
+#define EPC_HEX_LEN (2 * EPC_LEN)
+#define TAG_NAME_LEN 50  // matches the dashboard's maxlength
+
+// Per-tag signal statistics, all updated in O(1) per read
+#define RSSI_EWMA_ALPHA 0.125f  // weight of the newest read in the average and variance
+#define READ_RATE_BUCKETS 8     // sliding read-rate window: 8 x 500 ms = 4 s
+#define READ_RATE_BUCKET_MS 500
+
+struct __attribute__((packed)) TagStats {
+  float rssiAvg;  // exponentially weighted mean, dBm
+  float rssiVar;  // exponentially weighted variance, dBm^2
+  int8_t rssiMin;
+  int8_t rssiMax;
+  uint8_t buckets[READ_RATE_BUCKETS];  // reads per 500 ms slot, saturating
+  uint32_t bucketSlot;                 // slot number (ms / 500) of the newest read
+  uint32_t firstSeen;
+};
+
+#define TAG_FLAG_HAS_CRC 0x01
+#define TAG_FLAG_EVENT_FULL 0x02  // next pushed event carries every field
+#define TAG_FLAG_PRESENT 0x04     // entered and not yet left (presence engine)
+
+struct __attribute__((packed)) TagInfo {
+  uint8_t epc[EPC_LEN];
+  uint8_t pc[2];
+  uint8_t crc[2];
+  int8_t rssi;
+  uint8_t antenna;
+  uint8_t flags;
+  int16_t nameSlot;  // index into the name cache, -1 = unregistered
+  uint32_t readCount;
+  uint32_t lastSeen;
+  uint32_t changeSeq;  // status sequence of the last update, for ?since=
+  TagStats stats;
+  uint8_t enterCount;   // reads towards entering, counted from enterStart
+  uint32_t enterStart;
+};
+
+struct __attribute__((packed)) ReadingHistory {
+  uint32_t timestamp;  // millis() at the read
+  uint8_t epc[EPC_LEN];
+  int8_t rssi;
+};
+
+#define NAME_FLAG_DIRTY 0x01  // changed in RAM, not yet written to NVS
+
+struct TagName {
+  uint8_t epc[EPC_LEN];
+  char name[TAG_NAME_LEN + 1];
+  uint8_t flags;
+};
+
+inline void tagStatsBegin(TagStats& stats, int8_t rssi, uint32_t now) {
+  stats.rssiAvg = rssi;
+  stats.rssiVar = 0;
+  stats.rssiMin = rssi;
+  stats.rssiMax = rssi;
+  memset(stats.buckets, 0, sizeof(stats.buckets));
+  stats.bucketSlot = now / READ_RATE_BUCKET_MS;
+  stats.buckets[stats.bucketSlot % READ_RATE_BUCKETS] = 1;
+  stats.firstSeen = now;
+}
+
+inline void tagStatsUpdate(TagStats& stats, int8_t rssi, uint32_t now) {
+  // West's incremental form: no division, no history
+  float diff = rssi - stats.rssiAvg;
+  float step = RSSI_EWMA_ALPHA * diff;
+  stats.rssiAvg += step;
+  stats.rssiVar = (1.0f - RSSI_EWMA_ALPHA) * (stats.rssiVar + diff * step);
+  if (rssi < stats.rssiMin) stats.rssiMin = rssi;
+  if (rssi > stats.rssiMax) stats.rssiMax = rssi;
+
+  // Empty the slots skipped since the last read, at most the whole ring
+  uint32_t slot = now / READ_RATE_BUCKET_MS;
+  uint32_t gap = slot - stats.bucketSlot;
+  if (gap >= READ_RATE_BUCKETS) {
+    memset(stats.buckets, 0, sizeof(stats.buckets));
+  } else {
+    for (uint32_t s = stats.bucketSlot + 1; s <= slot; s++) stats.buckets[s % READ_RATE_BUCKETS] = 0;
+  }
+  stats.bucketSlot = slot;
+  uint8_t& bucket = stats.buckets[slot % READ_RATE_BUCKETS];
+  if (bucket < 255) bucket++;
+}
+
+// Reads per second over the window ending now; slots older than the window
+// count as empty, so the rate decays without further reads
+inline float tagReadRate(const TagStats& stats, uint32_t now) {
+  uint32_t slot = now / READ_RATE_BUCKET_MS;
+  uint32_t reads = 0;
+  for (uint32_t age = slot - stats.bucketSlot; age < READ_RATE_BUCKETS; age++) {
+    reads += stats.buckets[(slot - age) % READ_RATE_BUCKETS];
+  }
+  return reads * 1000.0f / (READ_RATE_BUCKETS * READ_RATE_BUCKET_MS);
+}
+
+inline bool epcEquals(const uint8_t* a, const uint8_t* b) {
+  return memcmp(a, b, EPC_LEN) == 0;
+}
+
+// Upper-case hex, NUL terminated. out must hold 2 * len + 1 chars.
+inline void bytesToHex(const uint8_t* data, int len, char* out) {
+  static const char digits[] = "0123456789ABCDEF";
+  for (int i = 0; i < len; i++) {
+    out[2 * i] = digits[data[i] >> 4];
+    out[2 * i + 1] = digits[data[i] & 0x0F];
+  }
+  out[2 * len] = '\0';
+}
+
+inline int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// Up to max bytes of hex, any length; an odd last digit fills the high
+// nibble. Number of hex digits read, -1 if invalid or too long.
+inline int parseHexBits(const char* hex, uint8_t* out, int max) {
+  int digits = 0;
+  memset(out, 0, max);
+  for (; *hex; hex++, digits++) {
+    int nibble = hexNibble(*hex);
+    if (nibble < 0 || digits == 2 * max) return -1;
+    out[digits / 2] |= digits % 2 ? nibble : nibble << 4;
+  }
+  return digits;
+}
+
+// Bits [offset, offset + bits) of an EPC against a pattern (MSB first, as
+// the reader's Select mask takes it). Spread into per-byte masks when set,
+// so a check is an AND and compare over just the bytes it covers.
+struct EpcFilter {
+  bool active;
+  uint8_t offset;
+  uint8_t bits;
+  uint8_t pattern[EPC_LEN];
+  uint8_t first;  // bytes covered
+  uint8_t last;
+  uint8_t mask[EPC_LEN];
+  uint8_t value[EPC_LEN];
+
+  bool set(int bitOffset, int bitCount, const uint8_t* bitPattern) {
+    if (bitOffset < 0 || bitCount < 1 || bitOffset + bitCount > EPC_LEN * 8) return false;
+    memset(this, 0, sizeof(*this));
+    offset = bitOffset;
+    bits = bitCount;
+    memcpy(pattern, bitPattern, (bitCount + 7) / 8);
+    for (int k = 0; k < bitCount; k++) {
+      int bit = bitOffset + k;
+      uint8_t epcBit = 0x80 >> (bit % 8);
+      mask[bit / 8] |= epcBit;
+      if (pattern[k / 8] & (0x80 >> (k % 8))) value[bit / 8] |= epcBit;
+    }
+    first = bitOffset / 8;
+    last = (bitOffset + bitCount - 1) / 8;
+    active = true;
+    return true;
+  }
+
+  bool matches(const uint8_t* epc) const {
+    for (int i = first; i <= last; i++) {
+      if ((epc[i] & mask[i]) != value[i]) return false;
+    }
+    return true;
+  }
+};
+
+// FNV-1a over the full EPC
+inline uint32_t epcHash(const uint8_t* epc) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < EPC_LEN; i++) {
+    h ^= epc[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Parse exactly 24 hex characters into a 12-byte EPC
+inline bool parseEpcHex(const char* hex, uint8_t* epc) {
+  if (strlen(hex) != EPC_HEX_LEN) return false;
+  for (int i = 0; i < EPC_LEN; i++) {
+    int hi = hexNibble(hex[2 * i]);
+    int lo = hexNibble(hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) return false;
+    epc[i] = (uint8_t)((hi << 4) | lo);
+  }
+  return true;
+}
+
+// Open-addressing hash index from EPC to record number. Linear probing over
+// a power-of-two table kept at most half full, so lookups stay O(1) however
+// many records are stored. The keys live in the records themselves (any type
+// with an epc member); the table only holds record number + 1 (0 = empty).
+template <typename Record>
+class EpcIndex {
+public:
+  EpcIndex() : records(nullptr), table(nullptr), mask(0) {}
+
+  // Table storage comes from the caller so it can live in PSRAM
+  static size_t tableSizeFor(uint16_t maxEntries) {
+    size_t size = 16;
+    while (size < 2u * maxEntries) size <<= 1;
+    return size;
+  }
+
+  void begin(const Record* recordArray, uint16_t* tableStorage, size_t tableSize) {
+    records = recordArray;
+    table = tableStorage;
+    mask = tableSize - 1;
+    clear();
+  }
+
+  void clear() {
+    if (table) memset(table, 0, (mask + 1) * sizeof(uint16_t));
+  }
+
+  int find(const uint8_t* epc) const {
+    for (size_t i = epcHash(epc) & mask;; i = (i + 1) & mask) {
+      uint16_t entry = table[i];
+      if (entry == 0) return -1;
+      if (epcEquals(records[entry - 1].epc, epc)) return entry - 1;
+    }
+  }
+
+  // Caller guarantees the EPC is not present and the table has room
+  void insert(const uint8_t* epc, uint16_t record) {
+    size_t i = epcHash(epc) & mask;
+    while (table[i] != 0) i = (i + 1) & mask;
+    table[i] = record + 1;
+  }
+
+  // Backward-shift delete: pull later entries of the probe chain into the
+  // hole so no tombstones are needed.
+  void remove(const uint8_t* epc) {
+    size_t i = epcHash(epc) & mask;
+    while (true) {
+      if (table[i] == 0) return;
+      if (epcEquals(records[table[i] - 1].epc, epc)) break;
+      i = (i + 1) & mask;
+    }
+    size_t j = i;
+    while (true) {
+      j = (j + 1) & mask;
+      if (table[j] == 0) break;
+      size_t home = epcHash(records[table[j] - 1].epc) & mask;
+      // Move entry j into the hole unless its home lies cyclically in (i, j]
+      bool inRange = (i <= j) ? (home > i && home <= j) : (home > i || home <= j);
+      if (!inRange) {
+        table[i] = table[j];
+        i = j;
+      }
+    }
+    table[i] = 0;
+  }
+
+private:
+  const Record* records;
+  uint16_t* table;
+  size_t mask;
+};
+
+typedef EpcIndex<TagInfo> TagIndex;
+
+#endif
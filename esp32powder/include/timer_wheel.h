@@ -0,0 +1,133 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+// Hierarchical timer wheel for one timer per record. Three levels of 64
+// slots; a timer sits in the finest level that can hold its deadline and
+// drops a level each time the wheel below it wraps. Scheduling, cancelling
+// and firing are O(1) per timer, so a tick costs only the timers that come
+// due (plus one cascade of a coarse slot every 64 ticks), never a scan of
+// every record.
+//
+// Timers are linked through index arrays owned by the caller, so the wheel
+// itself is a fixed 192 list heads.
+
+#include <stdint.h>
+#include <string.h>
+
+#define WHEEL_LEVELS 3
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_NONE 0xFFFF
+#define WHEEL_IDLE 0xFF  // slot marker of a timer that is not scheduled
+
+typedef void (*TimerWheelHandler)(uint16_t id, uint32_t now);
+
+class TimerWheel {
+public:
+  TimerWheel() : next(nullptr), prev(nullptr), slotOf(nullptr), due(nullptr), capacity(0), tickMs(1), tick(0) {}
+
+  // Arrays of capacity entries each
+  void begin(uint16_t* nextIds, uint16_t* prevIds, uint8_t* slots, uint32_t* deadlines, uint16_t count,
+             uint32_t tickLength, uint32_t now) {
+    next = nextIds;
+    prev = prevIds;
+    slotOf = slots;
+    due = deadlines;
+    capacity = count;
+    tickMs = tickLength;
+    clear(now);
+  }
+
+  void clear(uint32_t now) {
+    for (int i = 0; i < WHEEL_LEVELS * WHEEL_SLOTS; i++) heads[i] = WHEEL_NONE;
+    if (slotOf) memset(slotOf, WHEEL_IDLE, capacity);
+    tick = now / tickMs;
+  }
+
+  bool scheduled(uint16_t id) const { return slotOf[id] != WHEEL_IDLE; }
+
+  // Fire at time at (ms), or on the next tick if that has passed. Deadlines
+  // beyond the top level fire early, at the furthest slot; the handler can
+  // check and schedule again.
+  void schedule(uint16_t id, uint32_t at) {
+    if (scheduled(id)) cancel(id);
+    uint32_t deadline = at / tickMs;
+    if ((int32_t)(deadline - tick) <= 0) deadline = tick + 1;
+    due[id] = deadline;
+    link(id);
+  }
+
+  void cancel(uint16_t id) {
+    if (!scheduled(id)) return;
+    uint8_t slot = slotOf[id];
+    if (prev[id] != WHEEL_NONE) next[prev[id]] = next[id]; else heads[slot] = next[id];
+    if (next[id] != WHEEL_NONE) prev[next[id]] = prev[id];
+    slotOf[id] = WHEEL_IDLE;
+  }
+
+  // Run every tick up to now, calling handler for each timer that comes due.
+  // The handler may schedule or cancel the timer that is firing, and
+  // schedule any other.
+  void advance(uint32_t now, TimerWheelHandler handler) {
+    uint32_t target = now / tickMs;
+    while ((int32_t)(target - tick) > 0) {
+      tick++;
+      // Refill the finer levels whenever the one below wraps
+      if ((tick & (WHEEL_SLOTS - 1)) == 0) {
+        if (((tick >> WHEEL_BITS) & (WHEEL_SLOTS - 1)) == 0) cascade(2, (tick >> (2 * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+        cascade(1, (tick >> WHEEL_BITS) & (WHEEL_SLOTS - 1));
+      }
+      uint8_t slot = tick & (WHEEL_SLOTS - 1);
+      uint16_t id = heads[slot];
+      heads[slot] = WHEEL_NONE;
+      while (id != WHEEL_NONE) {
+        uint16_t following = next[id];
+        slotOf[id] = WHEEL_IDLE;
+        handler(id, now);
+        id = following;
+      }
+    }
+  }
+
+private:
+  uint16_t heads[WHEEL_LEVELS * WHEEL_SLOTS];
+  uint16_t* next;
+  uint16_t* prev;
+  uint8_t* slotOf;  // level * WHEEL_SLOTS + slot, or WHEEL_IDLE
+  uint32_t* due;    // deadline in ticks
+  uint16_t capacity;
+  uint32_t tickMs;
+  uint32_t tick;    // last tick processed
+
+  void link(uint16_t id) {
+    uint32_t delta = due[id] - tick;
+    uint8_t slot;
+    if (delta < WHEEL_SLOTS) {
+      slot = due[id] & (WHEEL_SLOTS - 1);
+    } else if (delta < (1u << (2 * WHEEL_BITS))) {
+      slot = WHEEL_SLOTS + ((due[id] >> WHEEL_BITS) & (WHEEL_SLOTS - 1));
+    } else {
+      if (delta >= (1u << (3 * WHEEL_BITS))) due[id] = tick + (1u << (3 * WHEEL_BITS)) - 1;
+      slot = 2 * WHEEL_SLOTS + ((due[id] >> (2 * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+    }
+    slotOf[id] = slot;
+    prev[id] = WHEEL_NONE;
+    next[id] = heads[slot];
+    if (next[id] != WHEEL_NONE) prev[next[id]] = id;
+    heads[slot] = id;
+  }
+
+  // Move every timer of one coarse slot down to where it now belongs
+  void cascade(int level, uint32_t index) {
+    uint8_t slot = level * WHEEL_SLOTS + index;
+    uint16_t id = heads[slot];
+    heads[slot] = WHEEL_NONE;
+    while (id != WHEEL_NONE) {
+      uint16_t following = next[id];
+      link(id);
+      id = following;
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,400 @@
+#ifndef TRACKER_H
+#define TRACKER_H
+
+// Tag-processing core: R200 frame handling, tag database, reading history and
+// the JSON API. Only talks to the outside world through platform.h, so the
+// same code runs on the ESP32 and in the native simulator build. The
+// definitions live in src/core/:
+//   tracker.cpp  state, setup, names, tag processing, ingest, presence
+//   reader.cpp   reader modes, programming workflow, reader settings
+//   status.cpp   status fields and the event stream
+//   api.cpp      HTTP handlers
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <string>
+
+#include "platform.h"
+#include "commands.h"
+#include "r200_parser.h"
+#include "tag_store.h"
+#include "history_log.h"
+#include "json_stream.h"
+#include "event_stream.h"
+#include "csv_stream.h"
+#include "reading_log.h"
+#include "spsc_queue.h"
+#include "timer_wheel.h"
+#include "metrics.h"
+#include "auto_q.h"
+#include "power_sweep.h"
+#include "power_control.h"
+
+extern KeyValueStore* tagNameStore;
+
+// Global state
+extern bool isScanning;
+extern int currentPower;    // centi-dBm as the reader last reported it, 0 until then
+extern int requestedPower;  // last power asked for
+
+// Reader settings from its replies (see applyReaderReply), so the dashboard
+// shows what the module reports rather than what was last sent
+struct ReaderState {
+  char hardware[R200_INFO_MAX + 1];
+  char software[R200_INFO_MAX + 1];
+  uint8_t region;          // 0 until reported
+  int16_t channel;         // -1 until reported
+  int32_t query;           // packed query parameters, -1 until reported
+  bool selectKnown;
+  uint8_t selParam;
+  uint32_t selectPointer;  // bit address
+  uint8_t selectBits;
+  uint8_t selectMask[R200_MASK_MAX_BYTES];
+  uint8_t lastError;       // last error code other than "no tag", 0 if none
+  uint32_t errorReplies;   // error frames other than "no tag"
+  uint32_t emptyRounds;    // "no tag" answers to inventory rounds
+  uint32_t changes;        // bumped whenever a reported setting changes
+};
+
+extern ReaderState readerState;
+
+// EPC select filter: the reader's Select keeps other tags out of inventory,
+// and the same bits are checked on the host for anything still read
+#define SELECT_KEY "select"
+#define EPC_BANK_EPC_BIT 0x20  // EPC bank bit address of the EPC (after CRC and PC)
+extern EpcFilter selectFilter;
+extern uint32_t selectFiltered;  // reads dropped on the host
+
+// Inventory query and RF settings as configured; readerState holds what the
+// reader reports back. With autoQ on, q follows the auto-Q estimate.
+#define QUERY_KEY "query"
+#define RF_KEY "rf"
+struct QueryConfig {
+  uint8_t q;
+  uint8_t session;
+  uint8_t target;
+  bool autoQ;
+};
+extern QueryConfig queryConfig;
+extern AutoQ autoQ;
+extern uint8_t rfRegion;   // 0 = leave the module's own setting
+extern int16_t rfChannel;  // fixed channel, -1 = hopping
+
+// TX power sweep (see power_sweep.h). While one runs the reader polls
+// continuously at each level, with auto-Q held still.
+#define SWEEP_DEFAULT_FROM 1500
+#define SWEEP_DEFAULT_TO 3000
+#define SWEEP_DEFAULT_STEP 100
+#define SWEEP_DEFAULT_DWELL_MS 3000
+extern PowerSweep powerSweep;
+
+// Closed-loop TX power (see power_control.h), off unless asked for. It
+// rests while a sweep runs and while the reader is programming,
+// registering or not polling.
+#define POWER_CONTROL_KEY "powerctl"
+#define POWER_CONTROL_DEFAULT_MIN 1500
+#define POWER_CONTROL_DEFAULT_LOW_RSSI -74   // 4 dB above the presence exit RSSI
+#define POWER_CONTROL_DEFAULT_HIGH_RSSI -66
+extern PowerControl powerControl;
+
+// Reader modes. Single = one inventory round per Start; multiple =
+// continuous polling; controlled = polling in on/off windows. The module
+// stops by itself after 0x2710 (10000) rounds, so polling is re-armed well
+// before that - 10000 rounds last ~50 s at the fastest round rate seen.
+enum ReaderMode { MODE_SINGLE, MODE_MULTIPLE, MODE_CONTROLLED };
+
+#define POLL_REARM_MS 20000
+#define DUTY_MIN_MS 100
+
+extern ReaderMode readerMode;
+extern uint32_t dutyOnMs;
+extern uint32_t dutyOffMs;
+extern bool dutyOn;           // controlled mode: inside the on window
+extern uint32_t dutyPhaseAt;  // start of the current window
+extern uint32_t pollArmedAt;  // last multiple-poll command
+extern uint32_t pollRearms;
+extern uint32_t dutyCycles;
+extern uint8_t lastTagEPC[EPC_LEN];
+extern bool hasLastTag;
+extern int tagCount;
+extern unsigned long lastTagTime;
+
+// R200 frame parser
+extern R200FrameParser r200Parser;
+
+// Reader ingest. Bytes are parsed on the producer side (trackerPoll(), or the
+// board's own UART task when ingestOnOwnTask is set) and complete frames are
+// handed to the consumer side through a lock-free queue.
+#define INGEST_QUEUE_DEPTH 256
+#define INGEST_FRAME_PAYLOAD 64  // longer replies are cut; tag notices are 17 bytes
+
+struct QueuedFrame {
+  uint8_t type;
+  uint8_t command;
+  uint16_t length;
+  uint8_t payload[INGEST_FRAME_PAYLOAD];
+};
+
+// Written by the producer side only (the UART task on the board) and read
+// by the loop task, hence atomics. The parser's own counters are copied in
+// by ingestPublishStats() after each batch of bytes.
+struct IngestStats {
+  std::atomic<uint32_t> queueDropped;     // frames lost to a full queue
+  std::atomic<uint32_t> queueStalls;      // times the UART task waited for queue space
+  std::atomic<uint32_t> uartOverflows;    // UART FIFO/ring overflows (board task)
+  std::atomic<uint32_t> uartRxHighWater;  // most bytes seen waiting in the UART ring
+  std::atomic<uint32_t> uartDrained;      // bytes thrown away by the overflow drain
+  std::atomic<uint32_t> frames;           // R200ParserStats, as last published
+  std::atomic<uint32_t> checksumErrors;
+  std::atomic<uint32_t> framingErrors;
+  std::atomic<uint32_t> bytesDiscarded;
+};
+
+extern SpscQueue<QueuedFrame, INGEST_QUEUE_DEPTH> ingestQueue;
+extern IngestStats ingestStats;
+extern bool ingestOnOwnTask;
+
+// Registration mode
+extern bool registrationMode;
+extern uint8_t registrationEPC[EPC_LEN];
+extern bool registrationHasTag;
+extern int registrationConfirmCount;
+#define REGISTRATION_CONFIRM_THRESHOLD 5
+
+// Programming mode - see the programming workflow in reader.cpp
+enum ProgrammingState {
+  PROG_IDLE,
+  PROG_WAIT_BLANK,   // counting reads of a blank (all-zero) tag
+  PROG_STOPPING,     // stop sent, waiting for the reader to confirm
+  PROG_WRITING,      // write sent, waiting for its response
+  PROG_VERIFYING,    // polling again, looking for the new EPC
+  PROG_DONE,
+  PROG_FAILED
+};
+
+// Step durations of the current/last run, ms
+struct ProgrammingTiming {
+  uint32_t confirm;  // first blank read to confirmed
+  uint32_t stop;
+  uint32_t write;    // all attempts
+  uint32_t verify;
+  uint32_t total;
+};
+
+extern bool programmingMode;  // a run is in progress (PROG_WAIT_BLANK..PROG_VERIFYING)
+extern ProgrammingState programmingState;
+extern uint8_t programmingEPC[EPC_LEN];
+extern int programmingConfirmCount;
+extern int programmingAttempts;
+extern uint8_t programmingErrorCode;  // R200 error code behind a failure, 0 = none
+extern const char* programmingFailure;
+extern ProgrammingTiming programmingTiming;
+extern uint32_t programmingStartedAt;
+extern uint32_t programmingStepAt;
+#define PROGRAMMING_CONFIRM_THRESHOLD 3
+#define PROGRAMMING_WRITE_ATTEMPTS 3
+#define PROGRAMMING_VERIFY_TIMEOUT_MS 1500
+
+// Tag database - records in arrival order, found through a hash index.
+// Capacity is chosen at boot (bigger when PSRAM is present).
+enum TagFullPolicy {
+  TAG_FULL_REJECT,         // ignore tags that do not fit (counted)
+  TAG_FULL_EVICT_STALEST   // reuse the record of the least recently seen tag
+};
+
+extern TagInfo* tagDatabase;
+extern int tagDatabaseCount;
+extern int tagCapacity;
+extern TagIndex tagIndex;
+
+// Presence - a tag enters after enough strong reads close together and
+// leaves when it goes quiet or its average RSSI drops below a lower bar
+#define PRESENCE_TICK_MS 100
+
+struct PresenceConfig {
+  uint8_t enterReads;      // reads needed to enter...
+  uint32_t enterWindowMs;  // ...within this long
+  int8_t enterRssi;        // with an average RSSI at least this strong
+  uint32_t exitTimeoutMs;  // leaves after this long without a read
+  int8_t exitRssi;         // or once its average falls below this
+};
+
+extern PresenceConfig presenceConfig;
+extern TimerWheel presenceWheel;  // one expiry timer per present tag
+extern int presentCount;
+extern uint32_t presenceEnters;
+extern uint32_t presenceLeaves;
+extern TagFullPolicy tagFullPolicy;
+extern uint32_t tagReads;  // tag notifications handled, every mode
+extern RateMeter frameRate;
+extern RateMeter readRate;
+extern uint32_t tagsRejected;
+extern uint32_t tagsEvicted;
+
+// Registered names - all loaded from NVS at boot and looked up by full EPC,
+// so the read path never touches flash. Edits are written back in batches.
+#define MAX_TAG_NAMES 256              // power of two
+#define NAME_KEY_PREFIX "n_"           // + 8 hex digits of epcHash(); value "EPCHEX|name"
+#define LEGACY_NAME_KEY_PREFIX "name_" // + first 8 EPC hex digits - migrated at boot
+#define NAME_FLUSH_DELAY_MS 2000       // edits within this window share one NVS write
+extern TagName tagNames[MAX_TAG_NAMES];
+extern int tagNameCount;
+extern EpcIndex<TagName> tagNameIndex;
+extern uint16_t tagNameTable[2 * MAX_TAG_NAMES];
+extern int tagNamesDirty;
+extern uint32_t tagNamesChangedAt;
+
+// Status change sequence for /api/status?since=N. Every tag update takes the
+// next number; mode fields get one when a status request sees them changed;
+// a clear marks everything older as stale.
+extern uint32_t statusSeq;
+extern uint32_t statusModeSeq;
+extern uint32_t statusResetSeq;
+
+// Server-sent events: records touched since the last push, each queued once.
+// A record is already queued when its changeSeq is newer than eventFlushSeq.
+extern EventHub eventHub;
+extern uint16_t* eventPending;
+extern int eventPendingCount;
+extern uint32_t eventFlushSeq;
+extern uint32_t eventLastFlush;
+
+// Reading history - ring buffer sized at boot, oldest reads overwritten
+extern HistoryLog history;
+
+// Every read also goes to the persistent log when the board has a file system
+extern ReadingLog readingLog;
+extern unsigned long systemStartTime;
+
+// Everything the dashboard shows outside the tag table and counters. The
+// programming fields come last so the event stream can compare the two
+// halves separately.
+struct ModeSnapshot {
+  bool scanning;
+  int power;
+  int requestedPower;
+  uint32_t readerChanges;
+  EpcFilter select;
+  QueryConfig query;
+  uint8_t rfRegion;
+  int16_t rfChannel;
+  int sweepState;
+  uint8_t sweepLevel;
+  PowerControlConfig powerControl;
+  uint32_t powerControlSteps;
+  int mode;
+  uint32_t dutyOn;
+  uint32_t dutyOff;
+  bool dutyPhaseOn;
+  bool registrationMode;
+  bool registrationHasTag;
+  uint8_t registrationEPC[EPC_LEN];
+  int registrationProgress;
+  int programmingState;
+  uint8_t programmingEPC[EPC_LEN];
+  int programmingProgress;
+  int programmingAttempts;
+};
+
+#define MODE_SNAPSHOT_SPLIT offsetof(ModeSnapshot, programmingState)
+
+// Mode fields as last pushed on the event stream
+extern ModeSnapshot eventModeSnapshot;
+
+// ----- tracker.cpp -----
+bool trackerBegin(ReaderPort& port, KeyValueStore& store, int power, uint16_t maxTags, uint32_t maxHistory);
+void trackerBeginLog(FileStore& files, int segments);
+void trackerPoll();
+void trackerShutdown();
+void formatDuration(uint32_t elapsed, char* out, size_t size);
+void formatTimestamp(uint32_t ms, char* out, size_t size);
+std::string toHex(const uint8_t* data, int len);
+int findNameSlot(const uint8_t* epc);
+const char* tagNameFor(int slot);
+int saveTagName(const uint8_t* epc, const std::string& name);
+void loadTagNames();
+void flushTagNames(bool force);
+void flushReader();
+void touchTag(int record, bool full = false);
+void ingestByte(uint8_t b);
+void ingestPublishStats();
+void presenceOnRead(int record, uint32_t now);
+void presenceExpired(uint16_t record, uint32_t now);
+void presenceForget(int record);
+
+// ----- reader.cpp -----
+const char* readerModeName(ReaderMode mode);
+const char* programmingStateName(ProgrammingState state);
+bool startScanning();
+bool startReading();
+void readerModePoll(uint32_t now);
+void setProgrammingState(ProgrammingState state);
+void programmingTagSeen(const uint8_t* epc, uint32_t now);
+void programmingPoll(uint32_t now);
+void logCommandFailure(uint8_t command, R200CommandStatus status, const R200Frame* reply);
+void onPowerSet(uint8_t command, R200CommandStatus status, const R200Frame* reply);
+bool sendQueryConfig();
+bool sendRfConfig();
+bool sendSelectFilter();
+void autoQPoll(uint32_t now);
+void sweepEnd(const char* failure, uint32_t now);
+void sweepPoll(uint32_t now);
+void powerControlPoll(uint32_t now);
+void loadSelectFilter();
+void saveSelectFilter();
+void loadInventorySettings();
+void saveQueryConfig();
+void savePowerControl();
+void saveRfConfig();
+void readerSetup();
+
+// ----- status.cpp -----
+void takeModeSnapshot(ModeSnapshot& snap);
+void writeCountFields(JsonStream& out);
+void writeReaderFields(JsonStream& out);
+void writeSelectFields(JsonStream& out);
+void writeQueryFields(JsonStream& out);
+void writePowerControlFields(JsonStream& out);
+void writeModeFields(JsonStream& out);
+void writeProgrammingFields(JsonStream& out);
+void writeTagFields(JsonStream& out, int record);
+void eventsPoll();
+
+// One event whose data line is a JSON object filled in by writeFields
+template <typename Fields>
+void pushEvent(const char* name, Fields writeFields) {
+  eventHub.beginEvent(name);
+  JsonStream out(eventHub);
+  out.beginObject();
+  writeFields(out);
+  out.endObject();
+  out.flush();
+  eventHub.endEvent();
+}
+
+// ----- api.cpp -----
+void handleStatus(HttpRequest& req);
+void handleHistory(HttpRequest& req);
+void handleHistoryCsv(HttpRequest& req);
+void handleStart(HttpRequest& req);
+void handleMode(HttpRequest& req);
+void handleStop(HttpRequest& req);
+void handlePower(HttpRequest& req);
+void handleClear(HttpRequest& req);
+void handlePresence(HttpRequest& req);
+void handleMetrics(HttpRequest& req);
+void handleSelect(HttpRequest& req);
+void handleQuery(HttpRequest& req);
+void handleRf(HttpRequest& req);
+void handleSweep(HttpRequest& req);
+void handlePowerControl(HttpRequest& req);
+void handleRegisterStart(HttpRequest& req);
+void handleRegisterCancel(HttpRequest& req);
+void handleRegisterConfirm(HttpRequest& req);
+void handleProgramStart(HttpRequest& req);
+void handleProgramCancel(HttpRequest& req);
+void handleEvents(HttpRequest& req);
+
+#endif
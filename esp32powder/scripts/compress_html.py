@@ -0,0 +1,64 @@
+# Gzips the dashboard in include/html.h into include/html_gz.h so it can be
+# served pre-compressed from flash. Runs before every esp32dev build (see
+# extra_scripts in platformio.ini) and only rewrites the header when the
+# page changed. Can also be run by hand: python scripts/compress_html.py
+
+import gzip
+import hashlib
+import os
+import re
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(PROJECT_DIR, "include", "html.h")
+TARGET = os.path.join(PROJECT_DIR, "include", "html_gz.h")
+
+
+def page_text():
+    with open(SOURCE, encoding="utf-8") as f:
+        match = re.search(r'R"rawliteral\((.*?)\)rawliteral"', f.read(), re.S)
+    if not match:
+        raise SystemExit("compress_html: no rawliteral page in " + SOURCE)
+    return match.group(1).encode("utf-8")
+
+
+def render(page):
+    # mtime=0 keeps the output identical for identical input
+    packed = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(page).hexdigest()[:16]
+    lines = [
+        "// Generated by scripts/compress_html.py from include/html.h - do not edit.",
+        "// %d bytes gzipped from %d." % (len(packed), len(page)),
+        "#ifndef HTML_GZ_H",
+        "#define HTML_GZ_H",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        '#define HTML_PAGE_ETAG "\\"%s\\""' % etag,
+        '#define HTML_PAGE_ID_ETAG "\\"%s-id\\""  // the uncompressed page' % etag,
+        "",
+        "const size_t HTML_PAGE_GZ_LEN = %d;" % len(packed),
+        "const uint8_t HTML_PAGE_GZ[] = {",
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+    lines += ["};", "", "#endif", ""]
+    return "\n".join(lines)
+
+
+def main():
+    text = render(page_text())
+    if os.path.exists(TARGET):
+        with open(TARGET, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(TARGET, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("compress_html: wrote " + os.path.relpath(TARGET, PROJECT_DIR))
+
+
+try:
+    Import("env")  # noqa: F821 - defined when run by PlatformIO
+except NameError:
+    pass
+main()
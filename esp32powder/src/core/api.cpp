@@ -0,0 +1,836 @@
+// HTTP handlers. Each takes the request through HttpRequest (platform.h),
+// so the board's web server and the native driver call the same code.
+
+#include "tracker.h"
+
+// Mode fields as /api/status last saw them; a change takes a new sequence
+static ModeSnapshot lastModeSnapshot;
+
+static void updateModeSeq() {
+  ModeSnapshot now = {};
+  takeModeSnapshot(now);
+  if (statusModeSeq == 0 || memcmp(&now, &lastModeSnapshot, sizeof(now)) != 0) {
+    memcpy(&lastModeSnapshot, &now, sizeof(now));
+    statusModeSeq = ++statusSeq;
+  }
+}
+
+// Full status, or with ?since=N only the tags and mode fields that changed
+// after sequence N. Counters are always included. "full":true tells the
+// client to drop what it has (first call, after a clear or a reboot).
+void handleStatus(HttpRequest& req) {
+  updateModeSeq();
+
+  uint32_t since = req.hasArg("since") ? strtoul(req.arg("since").c_str(), NULL, 10) : 0;
+  bool full = since == 0 || since < statusResetSeq || since > statusSeq;
+  if (full) since = 0;
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("seq").num(statusSeq);
+  out.key("full").boolean(full);
+  out.key("time").num(platformMillis() - systemStartTime);  // same clock as the tags' first/last
+  writeCountFields(out);
+
+  out.key("frames").num(ingestStats.frames.load());
+  out.key("checksumErrors").num(ingestStats.checksumErrors.load());
+  out.key("framingErrors").num(ingestStats.framingErrors.load());
+  out.key("ingestQueueHighWater").num(ingestQueue.highWaterMark());
+  out.key("ingestQueueDropped").num(ingestStats.queueDropped.load());
+  out.key("ingestStalls").num(ingestStats.queueStalls.load());
+  out.key("uartOverflows").num(ingestStats.uartOverflows.load());
+  out.key("uartRxHighWater").num(ingestStats.uartRxHighWater.load());
+  out.key("uartDrained").num(ingestStats.uartDrained.load());
+  if (readingLog.ready()) {
+    const LogStats& logStats = readingLog.getStats();
+    out.key("logFirst").num(readingLog.firstSeq());
+    out.key("logLast").num(readingLog.lastSeq());
+    out.key("logSegments").num(readingLog.segments());
+    out.key("logBuffered").num(readingLog.buffered());
+    out.key("logLost").num(logStats.lost);
+  }
+  out.key("tagCapacity").num(tagCapacity);
+  out.key("tagsRejected").num(tagsRejected);
+  out.key("tagsEvicted").num(tagsEvicted);
+
+  if (statusModeSeq > since) {
+    writeModeFields(out);
+    writeProgrammingFields(out);
+  }
+
+  out.key("tags").beginArray();
+  for (int i = 0; i < tagDatabaseCount; i++) {
+    if (tagDatabase[i].changeSeq <= since) continue;
+    out.beginObject();
+    writeTagFields(out, i);
+    out.endObject();
+  }
+  out.endArray();
+  out.endObject();
+  out.end();
+}
+
+// Whole history, or a range via ?from=<seq>&limit=<n> (limit=0 for just the counts)
+void handleHistory(HttpRequest& req) {
+  uint32_t first = history.firstSeq();
+  uint32_t last = history.lastSeq();
+  uint32_t from = first;
+  uint32_t to = last;
+  if (req.hasArg("from")) {
+    uint32_t requested = strtoul(req.arg("from").c_str(), NULL, 10);
+    if (requested > from) from = requested;
+  }
+  if (req.hasArg("limit")) {
+    uint32_t limit = strtoul(req.arg("limit").c_str(), NULL, 10);
+    if (limit == 0) {
+      to = from - 1;
+    } else if (to >= from && to - from >= limit) {
+      to = from + limit - 1;
+    }
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("count").num(history.size());
+  out.key("first").num(first);
+  out.key("last").num(last);
+  out.key("dropped").num(history.droppedCount());
+  out.key("capacity").num(history.capacity());
+  out.key("readings").beginArray();
+  char time[20];
+  for (uint32_t seq = from; seq <= to; seq++) {
+    const ReadingHistory& reading = history.at(seq);
+    int record = tagIndex.find(reading.epc);
+    int slot = record >= 0 ? tagDatabase[record].nameSlot : findNameSlot(reading.epc);
+    formatTimestamp(reading.timestamp, time, sizeof(time));
+
+    out.beginObject();
+    out.key("seq").num(seq);
+    out.key("time").str(time);
+    out.key("epc").hex(reading.epc, EPC_LEN);
+    out.key("name").str(tagNameFor(slot));
+    out.key("rssi").num(reading.rssi);
+    out.endObject();
+  }
+  out.endArray();
+  out.endObject();
+  out.end();
+}
+
+// ----- CSV export -----
+#define CSV_POLL_ROWS 32  // keep draining the reader while a long export streams
+
+static void writeHistoryCsvRow(CsvStream& out, const std::string& location, uint32_t seq, const char* time,
+                               const uint8_t* epc, int rssi) {
+  int record = tagIndex.find(epc);
+  const char* name = tagNameFor(record >= 0 ? tagDatabase[record].nameSlot : findNameSlot(epc));
+  out.str(location.c_str());
+  out.num(seq);
+  out.str(time);
+  out.str(*name ? name : "Unregistered");
+  out.hex(epc, EPC_LEN);
+  out.num(rssi);
+  out.endRow();
+}
+
+// The dashboard's export columns, streamed straight from the store.
+// ?from=&to= are read numbers (inclusive). ?source=log exports the
+// persistent log, timed by the log clock, instead of the RAM history; there
+// ?fromTime=&toTime= (log clock ms, inclusive) narrow it down by time too.
+void handleHistoryCsv(HttpRequest& req) {
+  bool fromLog = req.hasArg("source") && req.arg("source") == "log";
+  if (fromLog && !readingLog.ready()) {
+    req.send(404, "text/plain", "No reading log");
+    return;
+  }
+  std::string location = req.hasArg("location") ? req.arg("location") : "";
+  uint32_t from = fromLog ? readingLog.firstSeq() : history.firstSeq();
+  uint32_t to = fromLog ? readingLog.lastSeq() : history.lastSeq();
+  if (req.hasArg("from")) {
+    uint32_t requested = strtoul(req.arg("from").c_str(), NULL, 10);
+    if (requested > from) from = requested;
+  }
+  if (req.hasArg("to")) {
+    uint32_t requested = strtoul(req.arg("to").c_str(), NULL, 10);
+    if (requested < to) to = requested;
+  }
+  if (fromLog && req.hasArg("fromTime")) {
+    uint32_t requested = readingLog.seqAtTime(strtoul(req.arg("fromTime").c_str(), NULL, 10));
+    if (requested > from) from = requested;
+  }
+  if (fromLog && req.hasArg("toTime")) {
+    uint32_t requested = readingLog.seqAtTime(strtoul(req.arg("toTime").c_str(), NULL, 10) + 1) - 1;
+    if (requested < to) to = requested;
+  }
+
+  CsvStream out(req);
+  out.begin();
+  out.raw("Test Location,Read Number,Timestamp,Bottle Name,EPC,RSSI (dBm)").endRow();
+  char time[20];
+  uint32_t rows = 0;
+  if (fromLog) {
+    LogRecord batch[CSV_POLL_ROWS];
+    uint32_t seq = from;
+    while (seq <= to) {
+      uint32_t n = readingLog.read(seq, batch, CSV_POLL_ROWS);
+      if (n == 0) break;
+      for (uint32_t i = 0; i < n && batch[i].seq <= to; i++) {
+        formatDuration(batch[i].time, time, sizeof(time));
+        writeHistoryCsvRow(out, location, batch[i].seq, time, batch[i].epc, batch[i].rssi);
+      }
+      seq = batch[n - 1].seq + 1;
+      trackerPoll();
+    }
+  } else {
+    for (uint32_t seq = from; seq <= to; seq++) {
+      // A long export can be overtaken by the ring; those rows are gone
+      if (!history.contains(seq)) continue;
+      const ReadingHistory& reading = history.at(seq);
+      formatTimestamp(reading.timestamp, time, sizeof(time));
+      writeHistoryCsvRow(out, location, seq, time, reading.epc, reading.rssi);
+      if (++rows % CSV_POLL_ROWS == 0) trackerPoll();
+    }
+  }
+  out.end();
+}
+
+// Single mode runs one inventory round per call; the others start polling
+void handleStart(HttpRequest& req) {
+  if (readerMode == MODE_SINGLE) {
+    if (!singlePoll()) {
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    req.send(200, "text/plain", "OK");
+    return;
+  }
+  if (!startScanning()) {
+    req.send(503, "text/plain", "Reader busy");
+    return;
+  }
+  isScanning = true;
+  req.send(200, "text/plain", "OK");
+}
+
+// ?mode=single|multiple|controlled, plus &on=&off= window lengths (ms) for
+// controlled. A running scan carries on in the new mode; single stops it.
+void handleMode(HttpRequest& req) {
+  ReaderMode mode = readerMode;
+  if (req.hasArg("mode")) {
+    std::string name = req.arg("mode");
+    if (name == "single") mode = MODE_SINGLE;
+    else if (name == "multiple") mode = MODE_MULTIPLE;
+    else if (name == "controlled") mode = MODE_CONTROLLED;
+    else {
+      req.send(400, "text/plain", "Unknown mode");
+      return;
+    }
+  }
+  if (req.hasArg("on")) {
+    uint32_t on = strtoul(req.arg("on").c_str(), NULL, 10);
+    dutyOnMs = on < DUTY_MIN_MS ? DUTY_MIN_MS : on;
+  }
+  if (req.hasArg("off")) dutyOffMs = strtoul(req.arg("off").c_str(), NULL, 10);
+
+  if (isScanning && mode != readerMode) {
+    bool ok = mode == MODE_SINGLE ? stopMultiplePolling(logCommandFailure) : startScanning();
+    if (!ok) {
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    if (mode == MODE_SINGLE) isScanning = false;
+  }
+  if (mode != readerMode) platformLog("Reader mode: %s\n", readerModeName(mode));
+  readerMode = mode;
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("mode").str(readerModeName(readerMode));
+  out.key("dutyOn").num(dutyOnMs);
+  out.key("dutyOff").num(dutyOffMs);
+  out.key("rearms").num(pollRearms);
+  out.key("dutyCycles").num(dutyCycles);
+  out.endObject();
+  out.end();
+}
+
+// Notices already on the wire when the stop lands are still real reads, so
+// there is no need to wait and flush here
+void handleStop(HttpRequest& req) {
+  if (!stopMultiplePolling(logCommandFailure)) {
+    req.send(503, "text/plain", "Reader busy");
+    return;
+  }
+  isScanning = false;
+  // A stopped session is on flash before anyone pulls the power
+  trackerShutdown();
+  req.send(200, "text/plain", "OK");
+}
+
+void handlePower(HttpRequest& req) {
+  if (powerSweep.running()) {
+    req.send(503, "text/plain", "Power sweep running");
+    return;
+  }
+  if (req.hasArg("value")) {
+    int power = atoi(req.arg("value").c_str());
+    if (power < R200_MIN_POWER || power > R200_MAX_POWER) {
+      req.send(400, "text/plain", "Invalid power");
+      return;
+    }
+    if (!setPower(power, onPowerSet)) {
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    requestedPower = power;
+    if (powerControl.config.enabled) {
+      powerControl.config.enabled = false;  // a power set by hand stays
+      savePowerControl();
+      platformLog("Power control off: power set by hand\n");
+    }
+    req.send(200, "text/plain", "OK");
+  } else {
+    req.send(400, "text/plain", "Missing power");
+  }
+}
+
+void handleClear(HttpRequest& req) {
+  tagDatabaseCount = 0;
+  tagIndex.clear();
+  tagsRejected = 0;
+  tagsEvicted = 0;
+  selectFiltered = 0;
+  statusResetSeq = ++statusSeq;
+  tagCount = 0;
+  history.clear();
+  systemStartTime = platformMillis();
+  presenceWheel.clear(systemStartTime);
+  presentCount = 0;
+  hasLastTag = false;
+  eventPendingCount = 0;
+  eventFlushSeq = statusSeq;
+  if (eventHub.active()) {
+    pushEvent("reset", [](JsonStream&) {});
+    eventHub.flush(platformMillis());
+  }
+  platformLog("Cleared!\n");
+  req.send(200, "text/plain", "OK");
+}
+
+// Presence thresholds; any of enterReads, enterWindow, enterRssi,
+// exitTimeout, exitRssi updates that setting. Answers with the current ones.
+void handlePresence(HttpRequest& req) {
+  if (req.hasArg("enterReads")) {
+    int reads = atoi(req.arg("enterReads").c_str());
+    presenceConfig.enterReads = reads < 1 ? 1 : reads > 255 ? 255 : reads;
+  }
+  if (req.hasArg("enterWindow")) presenceConfig.enterWindowMs = strtoul(req.arg("enterWindow").c_str(), NULL, 10);
+  if (req.hasArg("enterRssi")) presenceConfig.enterRssi = atoi(req.arg("enterRssi").c_str());
+  if (req.hasArg("exitTimeout")) {
+    uint32_t timeout = strtoul(req.arg("exitTimeout").c_str(), NULL, 10);
+    presenceConfig.exitTimeoutMs = timeout < PRESENCE_TICK_MS ? PRESENCE_TICK_MS : timeout;
+  }
+  if (req.hasArg("exitRssi")) presenceConfig.exitRssi = atoi(req.arg("exitRssi").c_str());
+  if (presenceConfig.exitRssi > presenceConfig.enterRssi) presenceConfig.exitRssi = presenceConfig.enterRssi;
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("enterReads").num(presenceConfig.enterReads);
+  out.key("enterWindow").num(presenceConfig.enterWindowMs);
+  out.key("enterRssi").num(presenceConfig.enterRssi);
+  out.key("exitTimeout").num(presenceConfig.exitTimeoutMs);
+  out.key("exitRssi").num(presenceConfig.exitRssi);
+  out.key("present").num(presentCount);
+  out.key("enters").num(presenceEnters);
+  out.key("leaves").num(presenceLeaves);
+  out.endObject();
+  out.end();
+}
+
+// Prometheus text for scraping. Rates are over the last METRICS_RATE_MS;
+// everything else is a counter since boot or a gauge read now.
+void handleMetrics(HttpRequest& req) {
+  PlatformMemory memory;
+  platformMemory(memory);
+
+  MetricsStream out(req);
+  out.begin();
+  out.family("rfid_frames_per_second", "gauge", "Valid R200 frames per second");
+  out.value("rfid_frames_per_second", nullptr, (double)frameRate.perSecond);
+  out.family("rfid_frames_total", "counter", "Valid R200 frames");
+  out.value("rfid_frames_total", nullptr, (unsigned long)ingestStats.frames.load());
+  out.family("rfid_tag_reads_per_second", "gauge", "Tag notifications per second");
+  out.value("rfid_tag_reads_per_second", nullptr, (double)readRate.perSecond);
+  out.family("rfid_tag_reads_total", "counter", "Tag notifications");
+  out.value("rfid_tag_reads_total", nullptr, (unsigned long)tagReads);
+  out.family("rfid_parse_errors_total", "counter", "Frames rejected by the parser");
+  out.value("rfid_parse_errors_total", "kind=\"checksum\"", (unsigned long)ingestStats.checksumErrors.load());
+  out.value("rfid_parse_errors_total", "kind=\"framing\"", (unsigned long)ingestStats.framingErrors.load());
+  out.family("rfid_parser_discarded_bytes_total", "counter", "Bytes skipped while hunting for a frame start");
+  out.value("rfid_parser_discarded_bytes_total", nullptr, (unsigned long)ingestStats.bytesDiscarded.load());
+  out.family("rfid_uart_overflows_total", "counter", "UART FIFO or ring overflows");
+  out.value("rfid_uart_overflows_total", nullptr, (unsigned long)ingestStats.uartOverflows.load());
+  out.family("rfid_uart_drained_bytes_total", "counter", "Bytes dropped by the overflow drain");
+  out.value("rfid_uart_drained_bytes_total", nullptr, (unsigned long)ingestStats.uartDrained.load());
+  out.family("rfid_uart_rx_high_water_bytes", "gauge", "Most bytes seen waiting in the UART ring");
+  out.value("rfid_uart_rx_high_water_bytes", nullptr, (unsigned long)ingestStats.uartRxHighWater.load());
+  out.family("rfid_ingest_queue_high_water", "gauge", "Most frames seen waiting in the ingest queue");
+  out.value("rfid_ingest_queue_high_water", nullptr, (unsigned long)ingestQueue.highWaterMark());
+  out.family("rfid_ingest_queue_dropped_total", "counter", "Frames lost to a full ingest queue");
+  out.value("rfid_ingest_queue_dropped_total", nullptr, (unsigned long)ingestStats.queueDropped.load());
+  out.family("rfid_reader_errors_total", "counter", "Error replies from the reader other than no tag");
+  out.value("rfid_reader_errors_total", nullptr, (unsigned long)readerState.errorReplies);
+  out.family("rfid_reader_empty_rounds_total", "counter", "Inventory rounds no tag answered");
+  out.value("rfid_reader_empty_rounds_total", nullptr, (unsigned long)readerState.emptyRounds);
+  out.family("rfid_select_filtered_total", "counter", "Reads dropped by the host-side select filter");
+  out.value("rfid_select_filtered_total", nullptr, (unsigned long)selectFiltered);
+  out.family("rfid_inventory_q", "gauge", "Q of the inventory query (2^Q slots per round)");
+  out.value("rfid_inventory_q", nullptr, (unsigned long)queryConfig.q);
+  out.family("rfid_auto_q_changes_total", "counter", "Q changes made by auto-Q");
+  out.value("rfid_auto_q_changes_total", nullptr, (unsigned long)autoQ.changes);
+  out.family("rfid_auto_q_window_tags", "gauge", "Distinct tags read in the last auto-Q window");
+  out.value("rfid_auto_q_window_tags", nullptr, (unsigned long)autoQ.lastUnique);
+  out.family("rfid_tx_power_dbm", "gauge", "TX power as the reader last reported it");
+  out.value("rfid_tx_power_dbm", nullptr, currentPower / 100.0);
+  out.family("rfid_power_control_enabled", "gauge", "1 while closed-loop power control is on");
+  out.value("rfid_power_control_enabled", nullptr, (unsigned long)(powerControl.config.enabled ? 1 : 0));
+  out.family("rfid_power_control_steps_total", "counter", "Power changes made by power control");
+  out.value("rfid_power_control_steps_total", "direction=\"up\"", (unsigned long)powerControl.stepsUp);
+  out.value("rfid_power_control_steps_total", "direction=\"down\"", (unsigned long)powerControl.stepsDown);
+  out.family("rfid_power_control_holds_total", "counter", "Times power control held off steps down after oscillating");
+  out.value("rfid_power_control_holds_total", nullptr, (unsigned long)powerControl.holds);
+  out.family("rfid_power_control_window_tags", "gauge", "Tags read in the last power control window");
+  out.value("rfid_power_control_window_tags", "kind=\"all\"", (unsigned long)powerControl.lastTags);
+  out.value("rfid_power_control_window_tags", "kind=\"own\"", (unsigned long)powerControl.lastOwnTags);
+  out.family("rfid_power_control_weak_rssi_dbm", "gauge", "Average RSSI of the weakest tenth of own tags");
+  out.value("rfid_power_control_weak_rssi_dbm", nullptr, (double)powerControl.lastWeakRssi);
+  out.family("rfid_tags", "gauge", "Tags in the database");
+  out.value("rfid_tags", nullptr, (unsigned long)tagDatabaseCount);
+  out.family("rfid_tags_present", "gauge", "Tags currently present");
+  out.value("rfid_tags_present", nullptr, (unsigned long)presentCount);
+  out.family("rfid_loop_duration_seconds", "histogram", "Time per loop() iteration");
+  out.histogram("rfid_loop_duration_seconds", nullptr, loopLatency);
+
+  out.family("rfid_http_requests_total", "counter", "Requests per endpoint");
+  char labels[64];
+  for (int i = 0; i < endpointMetricsCount; i++) {
+    snprintf(labels, sizeof(labels), "path=\"%s\"", endpointMetrics[i].path);
+    out.value("rfid_http_requests_total", labels, (unsigned long)endpointMetrics[i].requests);
+  }
+  out.family("rfid_http_request_duration_seconds", "histogram", "Handler time per endpoint");
+  for (int i = 0; i < endpointMetricsCount; i++) {
+    snprintf(labels, sizeof(labels), "path=\"%s\"", endpointMetrics[i].path);
+    out.histogram("rfid_http_request_duration_seconds", labels, endpointMetrics[i].latency);
+  }
+
+  out.family("heap_free_bytes", "gauge", "Free internal heap");
+  out.value("heap_free_bytes", nullptr, (unsigned long)memory.freeHeap);
+  out.family("heap_min_free_bytes", "gauge", "Lowest free internal heap since boot");
+  out.value("heap_min_free_bytes", nullptr, (unsigned long)memory.minFreeHeap);
+  out.family("heap_largest_free_block_bytes", "gauge", "Largest allocatable internal block");
+  out.value("heap_largest_free_block_bytes", nullptr, (unsigned long)memory.largestFreeBlock);
+  out.family("psram_size_bytes", "gauge", "PSRAM size");
+  out.value("psram_size_bytes", nullptr, (unsigned long)memory.psramSize);
+  out.family("psram_used_bytes", "gauge", "PSRAM in use");
+  out.value("psram_used_bytes", nullptr, (unsigned long)(memory.psramSize - memory.psramFree));
+  out.end();
+}
+
+// EPC select filter. ?prefix=HEX matches the start of the EPC; ?mask=HEX
+// with offset (bits into the EPC, default 0) and bits (default 4 per hex
+// digit) matches anywhere in it; ?clear=1 turns it off. Kept across reboots.
+void handleSelect(HttpRequest& req) {
+  if (req.hasArg("prefix") || req.hasArg("mask") || req.hasArg("clear")) {
+    EpcFilter filter;
+    memset(&filter, 0, sizeof(filter));
+    if (!req.hasArg("clear")) {
+      bool prefix = req.hasArg("prefix");
+      uint8_t pattern[EPC_LEN];
+      int digits = parseHexBits(req.arg(prefix ? "prefix" : "mask").c_str(), pattern, EPC_LEN);
+      int offset = !prefix && req.hasArg("offset") ? atoi(req.arg("offset").c_str()) : 0;
+      int bits = req.hasArg("bits") ? atoi(req.arg("bits").c_str()) : digits * 4;
+      if (digits <= 0 || bits > digits * 4 || !filter.set(offset, bits, pattern)) {
+        req.send(400, "text/plain", "Invalid mask");
+        return;
+      }
+    }
+    EpcFilter previous = selectFilter;
+    selectFilter = filter;
+    if (!sendSelectFilter()) {
+      selectFilter = previous;
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    saveSelectFilter();
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  writeSelectFields(out);
+  out.key("filtered").num(selectFiltered);
+  writeReaderFields(out);
+  out.endObject();
+  out.end();
+}
+
+// Inventory query: ?q=0-15, ?session=0-3, ?target=A|B, ?auto=1|0. A q
+// without auto turns auto-Q off; with auto=1 it is the starting point. The
+// select filter depends on session and target, so it is sent again when
+// they change. Kept across reboots.
+void handleQuery(HttpRequest& req) {
+  if (req.hasArg("q") || req.hasArg("session") || req.hasArg("target") || req.hasArg("auto")) {
+    QueryConfig config = queryConfig;
+    bool valid = true;
+    if (req.hasArg("q")) {
+      int q = atoi(req.arg("q").c_str());
+      valid = q >= 0 && q <= AUTO_Q_MAX;
+      config.q = (uint8_t)q;
+      config.autoQ = false;
+    }
+    if (req.hasArg("session")) {
+      int session = atoi(req.arg("session").c_str());
+      valid = valid && session >= R200_SESSION_S0 && session <= R200_SESSION_S3;
+      config.session = (uint8_t)session;
+    }
+    if (req.hasArg("target")) {
+      std::string target = req.arg("target");
+      valid = valid && (target == "A" || target == "B");
+      config.target = target == "B" ? R200_TARGET_B : R200_TARGET_A;
+    }
+    if (req.hasArg("auto")) config.autoQ = req.arg("auto") == "1";
+    if (!valid) {
+      req.send(400, "text/plain", "Invalid query");
+      return;
+    }
+
+    QueryConfig previous = queryConfig;
+    queryConfig = config;
+    if (!sendQueryConfig()) {
+      queryConfig = previous;
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    if (config.session != previous.session || config.target != previous.target) sendSelectFilter();
+    if (config.autoQ) autoQ.restart(platformMillis());
+    saveQueryConfig();
+    platformLog("Query: Q%u%s S%u target %s\n", config.q, config.autoQ ? " (auto)" : "", config.session,
+                config.target == R200_TARGET_B ? "B" : "A");
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  writeQueryFields(out);
+  out.key("window").beginObject();
+  out.key("tags").num(autoQ.lastUnique);
+  out.key("reads").num(autoQ.lastReads);
+  out.key("emptyRounds").num(autoQ.lastEmptyRounds);
+  out.endObject();
+  writeReaderFields(out);
+  out.endObject();
+  out.end();
+}
+
+// RF: ?region=1|2|3|4|6, ?channel=N for a fixed channel with hopping off,
+// ?hopping=1 to hop again. Channels are checked against the region's plan.
+void handleRf(HttpRequest& req) {
+  if (req.hasArg("region") || req.hasArg("channel") || req.hasArg("hopping")) {
+    int region = req.hasArg("region") ? atoi(req.arg("region").c_str()) : rfRegion ? rfRegion : readerState.region;
+    int channel = rfChannel;
+    if (req.hasArg("hopping")) {
+      channel = req.arg("hopping") == "1" ? -1 : channel >= 0 ? channel : readerState.channel >= 0 ? readerState.channel : 0;
+    }
+    if (req.hasArg("channel")) channel = atoi(req.arg("channel").c_str());
+    const R200RegionPlan* plan = r200RegionPlan(region);
+    if (!plan || channel >= plan->channels || (req.hasArg("channel") && channel < 0)) {
+      req.send(400, "text/plain", "Invalid region or channel");
+      return;
+    }
+
+    uint8_t previousRegion = rfRegion;
+    int16_t previousChannel = rfChannel;
+    rfRegion = (uint8_t)region;
+    rfChannel = (int16_t)channel;
+    if (!sendRfConfig()) {
+      rfRegion = previousRegion;
+      rfChannel = previousChannel;
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    saveRfConfig();
+    if (channel >= 0) {
+      platformLog("RF: region 0x%02X, channel %d (%.3f MHz)\n", region, channel,
+                  (plan->baseKHz + channel * plan->stepKHz) / 1000.0);
+    } else {
+      platformLog("RF: region 0x%02X, hopping\n", region);
+    }
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  writeQueryFields(out);
+  writeReaderFields(out);
+  out.endObject();
+  out.end();
+}
+
+// TX power sweep. ?start=1 runs one over from..to (centi-dBm, both ends
+// included) in steps of step, dwelling dwell ms at each; ?stop=1 ends it
+// early. Answers with the report so far: per level the distinct tags, how
+// many of them were the station's own (see sweepOwnTag) and how many others
+// (cross-reads), reads/s and mean RSSI, and the recommended power.
+void handleSweep(HttpRequest& req) {
+  PowerSweep& sweep = powerSweep;
+  uint32_t now = platformMillis();
+  if (req.hasArg("start")) {
+    if (sweep.running() || sweep.restorePending || programmingMode || registrationMode) {
+      req.send(503, "text/plain", "Reader busy");
+      return;
+    }
+    int from = req.hasArg("from") ? atoi(req.arg("from").c_str()) : SWEEP_DEFAULT_FROM;
+    int to = req.hasArg("to") ? atoi(req.arg("to").c_str()) : SWEEP_DEFAULT_TO;
+    int step = req.hasArg("step") ? atoi(req.arg("step").c_str()) : SWEEP_DEFAULT_STEP;
+    uint32_t dwell = req.hasArg("dwell") ? strtoul(req.arg("dwell").c_str(), NULL, 10) : SWEEP_DEFAULT_DWELL_MS;
+    bool wasScanning = isScanning;
+    if (!sweep.begin(from, to, step, dwell, now)) {
+      req.send(400, "text/plain", "Invalid sweep");
+      return;
+    }
+    sweep.restorePower = requestedPower;
+    sweep.restoreScanning = wasScanning;
+    if (!wasScanning) {
+      if (!startScanning()) {
+        sweep.fail("reader busy", now);
+        req.send(503, "text/plain", "Reader busy");
+        return;
+      }
+      isScanning = true;
+    }
+    platformLog("Power sweep: %.1f to %.1f dBm in %.1f dB steps, %u ms each\n", from / 100.0, to / 100.0,
+                step / 100.0, (unsigned)dwell);
+  } else if (req.hasArg("stop") && sweep.running()) {
+    sweepEnd("stopped", now);
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("state").str(sweepStateName(sweep.state));
+  out.key("failure").str(sweep.state == SWEEP_IDLE ? "" : sweep.failure);
+  out.key("from").num(sweep.from);
+  out.key("to").num(sweep.to);
+  out.key("step").num(sweep.step);
+  out.key("dwell").num(sweep.dwellMs);
+  out.key("ownBy").str(tagNameCount > 0 ? "registered" : "rssi");
+  out.key("ownRssi").num(presenceConfig.enterRssi);
+  out.key("levels").beginArray();
+  for (uint8_t i = 0; i < sweep.levelsDone(); i++) {
+    const SweepLevel& level = sweep.levels[i];
+    out.beginObject();
+    out.key("power").num(level.power);
+    out.key("tags").num(level.tags);
+    out.key("ownTags").num(level.ownTags);
+    out.key("otherTags").num(level.otherTags());
+    out.key("reads").num(level.reads);
+    out.key("readsPerSecond").num(level.readsPerSecond(), 1);
+    out.key("rssiMean").num(level.rssiMean(), 1);
+    out.endObject();
+  }
+  out.endArray();
+  int best = sweep.recommended();
+  out.key("recommended");
+  if (best < 0) {
+    out.literal("null");
+  } else {
+    const SweepLevel& level = sweep.levels[best];
+    out.beginObject();
+    out.key("power").num(level.power);
+    out.key("coveragePercent").num(SWEEP_COVERAGE_PERCENT);
+    out.key("ownTags").num(level.ownTags);
+    out.key("otherTags").num(level.otherTags());
+    out.key("readsPerSecond").num(level.readsPerSecond(), 1);
+    out.endObject();
+  }
+  out.endObject();
+  out.end();
+}
+
+// Closed-loop power control: ?enable=1|0, ?minPower= / ?maxPower= (centi-dBm,
+// the range it moves in), ?lowRssi= / ?highRssi= (dBm, the band for the
+// weakest tenth of own tags, at least POWER_CONTROL_MIN_BAND wide),
+// ?minTags= / ?maxTags= (0 = no bound). Turning it on starts from the
+// current power, clamped into the range. Setting the power by hand turns it
+// off. Kept across reboots.
+void handlePowerControl(HttpRequest& req) {
+  static const char* const fields[] = {"enable", "minPower", "maxPower", "lowRssi", "highRssi", "minTags", "maxTags"};
+  bool change = false;
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) change = change || req.hasArg(fields[i]);
+  if (change) {
+    PowerControlConfig config = powerControl.config;
+    int minPower = req.hasArg("minPower") ? atoi(req.arg("minPower").c_str()) : config.minPower;
+    int maxPower = req.hasArg("maxPower") ? atoi(req.arg("maxPower").c_str()) : config.maxPower;
+    int lowRssi = req.hasArg("lowRssi") ? atoi(req.arg("lowRssi").c_str()) : config.lowRssi;
+    int highRssi = req.hasArg("highRssi") ? atoi(req.arg("highRssi").c_str()) : config.highRssi;
+    long minTags = req.hasArg("minTags") ? atol(req.arg("minTags").c_str()) : config.minTags;
+    long maxTags = req.hasArg("maxTags") ? atol(req.arg("maxTags").c_str()) : config.maxTags;
+    if (minPower < R200_MIN_POWER || maxPower > R200_MAX_POWER || minPower > maxPower ||
+        lowRssi < POWER_CONTROL_RSSI_FLOOR || highRssi > POWER_CONTROL_RSSI_CEIL ||
+        highRssi - lowRssi < POWER_CONTROL_MIN_BAND || minTags < 0 || minTags > 65535 || maxTags < 0 ||
+        maxTags > 65535 || (maxTags && minTags > maxTags)) {
+      req.send(400, "text/plain", "Invalid power control");
+      return;
+    }
+    if (req.hasArg("enable")) config.enabled = req.arg("enable") == "1";
+    config.minPower = (int16_t)minPower;
+    config.maxPower = (int16_t)maxPower;
+    config.lowRssi = (int8_t)lowRssi;
+    config.highRssi = (int8_t)highRssi;
+    config.minTags = (uint16_t)minTags;
+    config.maxTags = (uint16_t)maxTags;
+
+    if (config.enabled) {
+      if (powerSweep.running()) {
+        req.send(503, "text/plain", "Power sweep running");
+        return;
+      }
+      int power = requestedPower < minPower ? minPower : requestedPower > maxPower ? maxPower : requestedPower;
+      if (power != requestedPower) {
+        if (!setPower(power, onPowerSet)) {
+          req.send(503, "text/plain", "Reader busy");
+          return;
+        }
+        requestedPower = power;
+      }
+    }
+    bool starting = config.enabled && !powerControl.config.enabled;
+    powerControl.config = config;
+    if (starting) powerControl.restart(platformMillis());
+    savePowerControl();
+    platformLog("Power control %s: %.1f-%.1f dBm, weak tenth %d..%d dBm, tags %u..%u\n",
+                config.enabled ? "on" : "off", minPower / 100.0, maxPower / 100.0, lowRssi, highRssi,
+                config.minTags, config.maxTags);
+  }
+
+  JsonStream out(req);
+  out.begin();
+  out.beginObject();
+  out.key("power").num(currentPower);
+  out.key("powerRequested").num(requestedPower);
+  writePowerControlFields(out);
+  out.endObject();
+  out.end();
+}
+
+void handleRegisterStart(HttpRequest& req) {
+  if (!startReading()) {
+    req.send(503, "text/plain", "Reader busy");
+    return;
+  }
+  registrationMode = true;
+  registrationHasTag = false;
+  registrationConfirmCount = 0;
+
+  platformLog(">>> REGISTRATION MODE <<<\n");
+  req.send(200, "text/plain", "OK");
+}
+
+void handleRegisterCancel(HttpRequest& req) {
+  registrationMode = false;
+  registrationHasTag = false;
+  registrationConfirmCount = 0;
+  req.send(200, "text/plain", "OK");
+}
+
+void handleRegisterConfirm(HttpRequest& req) {
+  if (!req.hasArg("name") || !req.hasArg("epc")) {
+    req.send(400, "text/plain", "Missing data");
+    return;
+  }
+
+  std::string name = req.arg("name");
+  uint8_t epc[EPC_LEN];
+  if (!parseEpcHex(req.arg("epc").c_str(), epc)) {
+    req.send(400, "text/plain", "Invalid EPC");
+    return;
+  }
+
+  int slot = saveTagName(epc, name);
+  if (slot < 0) {
+    req.send(507, "text/plain", "Name table full");
+    return;
+  }
+
+  int record = tagIndex.find(epc);
+  if (record >= 0) {
+    tagDatabase[record].nameSlot = slot;
+    touchTag(record, true);
+  }
+
+  registrationMode = false;
+  registrationHasTag = false;
+  registrationConfirmCount = 0;
+
+  platformLog("✓ Registered: %s\n", name.c_str());
+  req.send(200, "text/plain", "OK");
+}
+
+void handleProgramStart(HttpRequest& req) {
+  if (!req.hasArg("epc")) {
+    req.send(400, "text/plain", "Missing EPC");
+    return;
+  }
+
+  if (!parseEpcHex(req.arg("epc").c_str(), programmingEPC)) {
+    req.send(400, "text/plain", "EPC must be exactly 24 hex characters");
+    return;
+  }
+  if (!startReading()) {
+    req.send(503, "text/plain", "Reader busy");
+    return;
+  }
+  setProgrammingState(PROG_WAIT_BLANK);
+  programmingConfirmCount = 0;
+  programmingAttempts = 0;
+  programmingErrorCode = 0;
+  programmingFailure = "";
+  memset(&programmingTiming, 0, sizeof(programmingTiming));
+
+  platformLog(">>> PROGRAMMING MODE <<<\n");
+  req.send(200, "text/plain", "OK");
+}
+
+void handleProgramCancel(HttpRequest& req) {
+  // Replies still in the queue are ignored once the state has moved on
+  bool pollingStopped = programmingState == PROG_STOPPING || programmingState == PROG_WRITING;
+  setProgrammingState(PROG_IDLE);
+  programmingConfirmCount = 0;
+  if (pollingStopped && isScanning) startScanning();
+  req.send(200, "text/plain", "OK");
+}
+
+// Subscribe to pushed tag/mode/programming events (text/event-stream)
+void handleEvents(HttpRequest& req) {
+  if (!eventHub.hasRoom()) {
+    req.send(503, "text/plain", "Too many event clients");
+    return;
+  }
+  EventChannel* channel = req.openEventStream();
+  if (!channel) {
+    req.send(503, "text/plain", "Too many event clients");
+    return;
+  }
+  if (!eventHub.active()) {
+    // First subscriber - start from now, the page fetches /api/status on open
+    eventPendingCount = 0;
+    eventFlushSeq = statusSeq;
+    takeModeSnapshot(eventModeSnapshot);
+  }
+  eventHub.attach(channel);
+  platformLog("✓ Event client connected (%d)\n", eventHub.clients());
+}
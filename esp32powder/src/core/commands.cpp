@@ -0,0 +1,139 @@
+// R200 command helpers: build the frame, queue it, log it
+
+#include "commands.h"
+
+ReaderPort* r200Port = nullptr;
+R200CommandQueue r200Commands;
+
+// Log a frame as hex
+void logR200Frame(const byte* cmd, int len) {
+  char line[3 * 32 + 1];
+  int n = 0;
+  for (int i = 0; i < len && i < 32; i++) {
+    n += snprintf(line + n, sizeof(line) - n, "%02X ", cmd[i]);
+  }
+  platformLog("TX: %s\n", line);
+}
+
+bool sendR200Command(const byte* cmd, int len, bool expectsReply, R200ReplyHandler handler, uint16_t timeoutMs) {
+  if (!r200Commands.enqueue(cmd, len, expectsReply, handler, timeoutMs)) {
+    platformLog("✗ R200 queue full, dropped command 0x%02X\n", cmd[2]);
+    return false;
+  }
+  logR200Frame(cmd, len);
+  return true;
+}
+
+bool r200QueueHasRoom(int commands) {
+  if (r200Commands.room() >= commands) return true;
+  platformLog("✗ R200 queue full, %d commands not sent\n", commands);
+  return false;
+}
+
+bool setPower(int power, R200ReplyHandler handler) {
+  if (!sendR200Command(r200SetPowerFrame(power), true, handler)) return false;
+  platformLog("Power set to %.2f dBm\n", power / 100.0);
+  return true;
+}
+
+// Get current power setting
+bool getPower(R200ReplyHandler handler) {
+  if (!sendR200Command(R200GetPowerFrame(), true, handler)) return false;
+  platformLog("Requesting power level...\n");
+  return true;
+}
+
+// Start continuous multi-tag polling
+// (no response frame - tag notices start arriving instead)
+bool startMultiplePolling() {
+  if (!sendR200Command(R200MultiplePollFrame())) return false;
+  platformLog(">>> Scanning STARTED <<<\n");
+  return true;
+}
+
+// Stop multi-tag polling
+bool stopMultiplePolling(R200ReplyHandler handler) {
+  if (!sendR200Command(R200StopPollFrame(), true, handler)) return false;
+  platformLog(">>> Scanning STOPPED <<<\n");
+  return true;
+}
+
+// Single tag poll (read once)
+bool singlePoll() {
+  if (!sendR200Command(R200SinglePollFrame())) return false;
+  platformLog("Single poll triggered\n");
+  return true;
+}
+
+// Get hardware version
+bool getHardwareVersion(R200ReplyHandler handler) {
+  if (!sendR200Command(R200HardwareVersionFrame(), true, handler)) return false;
+  platformLog("Requesting hardware version...\n");
+  return true;
+}
+
+// Get software version
+bool getSoftwareVersion(R200ReplyHandler handler) {
+  if (!sendR200Command(R200SoftwareVersionFrame(), true, handler)) return false;
+  platformLog("Requesting software version...\n");
+  return true;
+}
+
+// Write EPC to tag: EPC bank from word 2 (after CRC and PC), access password 0
+bool writeEPC(const uint8_t* epcBytes, R200ReplyHandler handler) {
+  if (!sendR200Command(r200WriteFrame(0, R200_BANK_EPC, 2, epcBytes, EPC_LEN / 2), true, handler,
+                       R200_WRITE_TIMEOUT_MS)) {
+    return false;
+  }
+  char epcHex[EPC_HEX_LEN + 1];
+  bytesToHex(epcBytes, EPC_LEN, epcHex);
+  platformLog("Writing EPC: %s\n", epcHex);
+  return true;
+}
+
+// Select: selParam is Target(7-5) | Action(4-2) | MemBank(1-0), pointer a
+// bit address in that bank
+bool setSelectParams(uint8_t selParam, uint32_t pointer, const uint8_t* mask, uint8_t maskBits,
+                     R200ReplyHandler handler) {
+  return sendR200Command(r200SetSelectFrame(selParam, pointer, mask, maskBits), true, handler);
+}
+
+bool setSelectMode(uint8_t mode, R200ReplyHandler handler) {
+  return sendR200Command(r200SetSelectModeFrame(mode), true, handler);
+}
+
+// Query parameters from r200QueryParam(): Q, session and target of every
+// inventory round
+bool setQueryParams(uint16_t param, R200ReplyHandler handler) {
+  return sendR200Command(r200SetQueryFrame(param), true, handler);
+}
+
+// RF region, and a fixed channel - only used while hopping is off
+bool setRegion(uint8_t region, R200ReplyHandler handler) {
+  return sendR200Command(r200SetRegionFrame(region), true, handler);
+}
+
+bool setChannel(uint8_t channel, R200ReplyHandler handler) {
+  return sendR200Command(r200SetChannelFrame(channel), true, handler);
+}
+
+bool setHopping(bool on, R200ReplyHandler handler) {
+  return sendR200Command(r200SetHoppingFrame(on), true, handler);
+}
+
+// Reader settings, answered through r200DecodeReply()
+bool getQueryParams(R200ReplyHandler handler) {
+  return sendR200Command(R200GetQueryFrame(), true, handler);
+}
+
+bool getSelectParams(R200ReplyHandler handler) {
+  return sendR200Command(R200GetSelectFrame(), true, handler);
+}
+
+bool getRegion(R200ReplyHandler handler) {
+  return sendR200Command(R200GetRegionFrame(), true, handler);
+}
+
+bool getChannel(R200ReplyHandler handler) {
+  return sendR200Command(R200GetChannelFrame(), true, handler);
+}
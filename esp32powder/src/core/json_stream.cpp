@@ -0,0 +1,6 @@
+// The response and event buffers - see json_stream.h
+
+#include "json_stream.h"
+
+char jsonChunkBuffer[JSON_CHUNK_SIZE];
+char jsonEventBuffer[JSON_CHUNK_SIZE];
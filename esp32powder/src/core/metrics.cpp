@@ -0,0 +1,23 @@
+// Per-endpoint request counters and the loop latency histogram
+
+#include "metrics.h"
+
+EndpointMetrics endpointMetrics[METRICS_MAX_ENDPOINTS];
+int endpointMetricsCount = 0;
+LatencyHistogram loopLatency;
+
+// Slot for one route, taken once when routes are registered; -1 when the
+// table is full (requests to it are then simply not counted)
+int metricsEndpoint(const char* path) {
+  if (endpointMetricsCount == METRICS_MAX_ENDPOINTS) return -1;
+  EndpointMetrics& endpoint = endpointMetrics[endpointMetricsCount];
+  memset(&endpoint, 0, sizeof(endpoint));
+  endpoint.path = path;
+  return endpointMetricsCount++;
+}
+
+void metricsRequestDone(int endpoint, uint32_t us) {
+  if (endpoint < 0) return;
+  endpointMetrics[endpoint].requests++;
+  endpointMetrics[endpoint].latency.observe(us);
+}
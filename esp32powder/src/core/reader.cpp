@@ -0,0 +1,480 @@
+// Reader modes, the programming workflow and the reader's settings: what
+// is sent to the R200 and what its replies are checked against
+
+#include "tracker.h"
+
+// ========================================
+// Reader modes
+// ========================================
+const char* readerModeName(ReaderMode mode) {
+  switch (mode) {
+    case MODE_SINGLE: return "single";
+    case MODE_CONTROLLED: return "controlled";
+    default: return "multiple";
+  }
+}
+
+// Start polling at the beginning of an on window
+bool startScanning() {
+  if (!startMultiplePolling()) return false;
+  uint32_t now = platformMillis();
+  dutyOn = true;
+  dutyPhaseAt = now;
+  pollArmedAt = now;
+  return true;
+}
+
+// Switch controlled-mode windows and keep the module's poll count topped
+// up. A command that does not fit the queue is simply tried again on the
+// next pass.
+void readerModePoll(uint32_t now) {
+  // a power sweep polls without pause whatever the mode
+  ReaderMode mode = powerSweep.running() ? MODE_MULTIPLE : readerMode;
+  if (!isScanning || programmingMode || mode == MODE_SINGLE) return;
+
+  if (mode == MODE_CONTROLLED && dutyOffMs > 0) {
+    if (now - dutyPhaseAt >= (dutyOn ? dutyOnMs : dutyOffMs)) {
+      if (dutyOn ? !stopMultiplePolling(logCommandFailure) : !startMultiplePolling()) return;
+      dutyOn = !dutyOn;
+      dutyPhaseAt = now;
+      pollArmedAt = now;
+      if (dutyOn) dutyCycles++;
+      return;
+    }
+  }
+
+  if (dutyOn && now - pollArmedAt >= POLL_REARM_MS && startMultiplePolling()) {
+    pollArmedAt = now;
+    pollRearms++;
+  }
+}
+
+// ========================================
+// Programming workflow
+// ========================================
+// Confirm a blank tag, stop polling, write, restart polling and read the new
+// EPC back. Every step moves on from a reader reply or a tag read, never a
+// sleep; a write the module reports as "no tag" (0x10) is retried.
+const char* programmingStateName(ProgrammingState state) {
+  switch (state) {
+    case PROG_WAIT_BLANK: return "waiting";
+    case PROG_STOPPING: return "stopping";
+    case PROG_WRITING: return "writing";
+    case PROG_VERIFYING: return "verifying";
+    case PROG_DONE: return "done";
+    case PROG_FAILED: return "failed";
+    default: return "idle";
+  }
+}
+
+
+void setProgrammingState(ProgrammingState state) {
+  bool wasProgramming = programmingMode;
+  programmingState = state;
+  programmingMode = state >= PROG_WAIT_BLANK && state <= PROG_VERIFYING;
+  if (programmingMode == wasProgramming) return;
+  // A blank tag never matches the select mask - let the reader see all
+  // tags while programming
+  if (selectFilter.active) {
+    setSelectMode(programmingMode ? R200_SELECT_NEVER : R200_SELECT_ALWAYS, logCommandFailure);
+  }
+  // and keep answering after each read (see sendQueryConfig)
+  if (queryConfig.session != R200_SESSION_S0 || queryConfig.target != R200_TARGET_A) sendQueryConfig();
+}
+
+static void programmingFailed(const char* reason, uint8_t errorCode) {
+  bool pollingStopped = programmingState == PROG_STOPPING || programmingState == PROG_WRITING;
+  programmingFailure = reason;
+  programmingErrorCode = errorCode;
+  programmingTiming.total = platformMillis() - programmingStartedAt;
+  setProgrammingState(PROG_FAILED);
+  if (pollingStopped && isScanning) startScanning();
+  platformLog(">>> FAILED: %s (error 0x%02X, %u ms) <<<\n", reason, errorCode,
+              (unsigned)programmingTiming.total);
+}
+
+static void startProgrammingWrite();
+
+static void onProgrammingWritten(uint8_t, R200CommandStatus status, const R200Frame* reply) {
+  if (programmingState != PROG_WRITING) return;  // cancelled meanwhile
+  uint32_t now = platformMillis();
+  programmingTiming.write += now - programmingStepAt;
+
+  if (status == R200_COMMAND_TIMEOUT || !reply) {
+    programmingFailed("No response to write", 0);
+    return;
+  }
+  // Success is a write reply with status 0x00, failure an error frame
+  R200Reply result;
+  if (!r200DecodeReply(*reply, result) ||
+      (result.kind != R200_REPLY_MEMORY && result.kind != R200_REPLY_ERROR)) {
+    programmingFailed("Malformed write response", 0);
+    return;
+  }
+  uint8_t errorCode = result.kind == R200_REPLY_ERROR ? result.error.code : result.memory.status;
+  if (errorCode != 0x00) {
+    if (errorCode == R200_ERROR_WRITE_FAIL && programmingAttempts < PROGRAMMING_WRITE_ATTEMPTS) {
+      platformLog("Write attempt %d: no tag, retrying\n", programmingAttempts);
+      startProgrammingWrite();
+    } else {
+      programmingFailed("Write rejected by reader", errorCode);
+    }
+    return;
+  }
+
+  platformLog("✓ Write acknowledged in %u ms, verifying\n", (unsigned)programmingTiming.write);
+  setProgrammingState(PROG_VERIFYING);
+  programmingStepAt = now;
+  if (!startMultiplePolling()) programmingFailed("Reader busy", 0);
+}
+
+static void startProgrammingWrite() {
+  setProgrammingState(PROG_WRITING);
+  programmingAttempts++;
+  programmingStepAt = platformMillis();
+  if (!writeEPC(programmingEPC, onProgrammingWritten)) programmingFailed("Reader busy", 0);
+}
+
+static void onProgrammingStopped(uint8_t, R200CommandStatus status, const R200Frame*) {
+  if (programmingState != PROG_STOPPING) return;
+  if (status != R200_COMMAND_OK) {
+    programmingFailed("Reader did not stop polling", 0);
+    return;
+  }
+  programmingTiming.stop = platformMillis() - programmingStepAt;
+  startProgrammingWrite();
+}
+
+void programmingTagSeen(const uint8_t* epc, uint32_t now) {
+  if (programmingState == PROG_WAIT_BLANK) {
+    for (int i = 0; i < EPC_LEN; i++) {
+      if (epc[i] != 0x00) return;
+    }
+    if (programmingConfirmCount == 0) programmingStartedAt = now;
+    if (++programmingConfirmCount < PROGRAMMING_CONFIRM_THRESHOLD) return;
+
+    platformLog(">>> WRITING <<<\n");
+    programmingTiming.confirm = now - programmingStartedAt;
+    setProgrammingState(PROG_STOPPING);
+    programmingStepAt = now;
+    if (!stopMultiplePolling(onProgrammingStopped)) programmingFailed("Reader busy", 0);
+  } else if (programmingState == PROG_VERIFYING && epcEquals(epc, programmingEPC)) {
+    programmingTiming.verify = now - programmingStepAt;
+    programmingTiming.total = now - programmingStartedAt;
+    setProgrammingState(PROG_DONE);
+    platformLog(">>> SUCCESS! confirm %u, stop %u, write %u (%d attempts), verify %u, total %u ms <<<\n",
+                (unsigned)programmingTiming.confirm, (unsigned)programmingTiming.stop,
+                (unsigned)programmingTiming.write, programmingAttempts,
+                (unsigned)programmingTiming.verify, (unsigned)programmingTiming.total);
+  }
+}
+
+// Timeout for the read-back; the other steps are bounded by the command queue
+void programmingPoll(uint32_t now) {
+  if (programmingState == PROG_VERIFYING && now - programmingStepAt > PROGRAMMING_VERIFY_TIMEOUT_MS) {
+    programmingFailed("Written, but new EPC not read back", 0);
+  }
+}
+
+// Reply handlers for the setup queries
+static void logVersionReply(uint8_t, R200CommandStatus status, const R200Frame* reply) {
+  R200Reply decoded;
+  if (status != R200_COMMAND_OK || !reply || !r200DecodeReply(*reply, decoded) ||
+      decoded.kind != R200_REPLY_MODULE_INFO) {
+    platformLog("✗ R200 version query failed\n");
+    return;
+  }
+  platformLog("R200 %s version: %s\n", decoded.info.type == 0x00 ? "hardware" : "software", decoded.info.text);
+}
+
+void logCommandFailure(uint8_t command, R200CommandStatus status, const R200Frame*) {
+  if (status == R200_COMMAND_TIMEOUT) {
+    platformLog("✗ R200 command 0x%02X timed out\n", command);
+  } else if (status == R200_COMMAND_ERROR_REPLY) {
+    platformLog("✗ R200 command 0x%02X failed\n", command);
+  }
+}
+
+// Read the power back once it is set; currentPower only ever comes from the
+// reader's answer
+void onPowerSet(uint8_t command, R200CommandStatus status, const R200Frame* reply) {
+  if (status != R200_COMMAND_OK) {
+    logCommandFailure(command, status, reply);
+    return;
+  }
+  getPower(logCommandFailure);
+}
+
+static void onQuerySet(uint8_t command, R200CommandStatus status, const R200Frame* reply) {
+  if (status != R200_COMMAND_OK) {
+    logCommandFailure(command, status, reply);
+    return;
+  }
+  getQueryParams(logCommandFailure);
+}
+
+// Query for the following rounds, read back once set. Programming runs in
+// S0 / target A so the tag on the pad keeps answering after each read.
+bool sendQueryConfig() {
+  uint8_t session = programmingMode ? R200_SESSION_S0 : queryConfig.session;
+  uint8_t target = programmingMode ? R200_TARGET_A : queryConfig.target;
+  return setQueryParams(r200QueryParam(R200_SEL_ALL, session, target, queryConfig.q), onQuerySet);
+}
+
+// Fixed channel with hopping off, or hopping; region first since it
+// decides the channel plan
+bool sendRfConfig() {
+  if (!r200QueueHasRoom((rfRegion ? 1 : 0) + (rfChannel >= 0 ? 2 : 1) + 2)) return false;
+  bool ok = true;
+  if (rfRegion) ok = setRegion(rfRegion, logCommandFailure);
+  if (rfChannel >= 0) {
+    ok = ok && setHopping(false, logCommandFailure) && setChannel((uint8_t)rfChannel, logCommandFailure);
+  } else {
+    ok = ok && setHopping(true, logCommandFailure);
+  }
+  return ok && getRegion(logCommandFailure) && getChannel(logCommandFailure);
+}
+
+// Re-pick Q once per window while polling into the tag table
+void autoQPoll(uint32_t now) {
+  if (!autoQ.windowDone(now)) return;
+  if (!queryConfig.autoQ || !isScanning || programmingMode || registrationMode || powerSweep.running()) {
+    autoQ.restart(now);
+    return;
+  }
+  uint8_t previous = queryConfig.q;
+  queryConfig.q = autoQ.decide(previous, now);
+  if (queryConfig.q == previous) return;
+  if (!sendQueryConfig()) {
+    queryConfig.q = previous;  // queue full - the next window asks again
+    return;
+  }
+  autoQ.changes++;
+  platformLog("Auto-Q: %u -> %u (%u tags, %u reads, %u empty rounds)\n", previous, queryConfig.q,
+              (unsigned)autoQ.lastUnique, (unsigned)autoQ.lastReads, (unsigned)autoQ.lastEmptyRounds);
+}
+
+// End a sweep: log the outcome and go back to the power and scanning state
+// it started from (sweepPoll retries whatever does not fit the queue)
+void sweepEnd(const char* failure, uint32_t now) {
+  PowerSweep& sweep = powerSweep;
+  if (failure) {
+    sweep.fail(failure, now);
+    platformLog("✗ Power sweep: %s at %.1f dBm\n", failure, sweep.levels[sweep.level].power / 100.0);
+  } else {
+    int best = sweep.recommended();
+    if (best >= 0) {
+      const SweepLevel& level = sweep.levels[best];
+      platformLog("✓ Power sweep done: %.1f dBm recommended (%u own tags, %u others, %.0f reads/s)\n",
+                  level.power / 100.0, (unsigned)level.ownTags, (unsigned)level.otherTags(), level.readsPerSecond());
+    } else {
+      platformLog("✓ Power sweep done: no level read a tag of the station's own\n");
+    }
+  }
+  sweep.restorePending = true;
+}
+
+// Set each level's power, count once the reader reports it, move on after
+// the dwell. Stopping the scan, or programming or registration starting,
+// ends the sweep.
+void sweepPoll(uint32_t now) {
+  PowerSweep& sweep = powerSweep;
+  if (sweep.restorePending) {
+    if (requestedPower != sweep.restorePower) {
+      if (!setPower(sweep.restorePower, onPowerSet)) return;
+      requestedPower = sweep.restorePower;
+    }
+    if (!sweep.restoreScanning && isScanning && !programmingMode && !registrationMode) {
+      if (!stopMultiplePolling(logCommandFailure)) return;
+      isScanning = false;
+    }
+    sweep.restorePending = false;
+    return;
+  }
+  if (!sweep.running()) return;
+  if (!isScanning || programmingMode || registrationMode) {
+    sweepEnd(!isScanning ? "scanning stopped" : "reader taken for programming or registration", now);
+    return;
+  }
+
+  if (sweep.state == SWEEP_SETTING) {
+    int power = sweep.levels[sweep.level].power;
+    if (requestedPower != power && setPower(power, onPowerSet)) requestedPower = power;
+    if (requestedPower == power && currentPower == power) {
+      sweep.confirmed(now);
+    } else if (now - sweep.stateAt >= SWEEP_CONFIRM_MS) {
+      sweepEnd("reader did not confirm the power", now);
+    }
+    return;
+  }
+  if (sweep.dwellDone(now) && !sweep.nextLevel(now)) sweepEnd(nullptr, now);
+}
+
+// Once per window: the tags read in it, the station's own among them (the
+// registered ones once there are any, before that all of them - the weak
+// ones are what the controller has to see) and the average RSSI the
+// weakest tenth of those sits at; then the next power. A change is only
+// judged once the reader has reported the power set before it.
+void powerControlPoll(uint32_t now) {
+  PowerControl& control = powerControl;
+  if (!control.windowDone(now)) return;
+  if (!control.config.enabled || !isScanning || readerMode == MODE_SINGLE || programmingMode || registrationMode ||
+      powerSweep.running() || powerSweep.restorePending || currentPower != requestedPower) {
+    control.restart(now);
+    return;
+  }
+
+  uint16_t bins[POWER_CONTROL_BINS];
+  memset(bins, 0, sizeof(bins));
+  uint32_t tags = 0, own = 0;
+  bool byName = tagNameCount > 0;
+  for (int i = 0; i < tagDatabaseCount; i++) {
+    const TagInfo& tag = tagDatabase[i];
+    if ((int32_t)(tag.lastSeen - control.windowStart) <= 0) continue;
+    tags++;
+    if (byName && tag.nameSlot < 0) continue;
+    own++;
+    bins[powerControlBin(tag.stats.rssiAvg)]++;
+  }
+  int weakRssi = powerControlWeakRssi(bins, own);
+
+  int previous = requestedPower;
+  int power = control.decide(previous, tags, own, weakRssi, now);
+  if (power == previous) return;
+  if (!setPower(power, onPowerSet)) {
+    control.restart(now);  // queue full - the next window asks again
+    return;
+  }
+  requestedPower = power;
+  platformLog("Power control: %.1f -> %.1f dBm (%s: %u tags, %u own, weak tenth %d dBm)\n", previous / 100.0,
+              power / 100.0, control.reason, (unsigned)tags, (unsigned)own, weakRssi);
+}
+
+// Program the reader's Select from selectFilter and read it back. Matching
+// tags go to the inventoried flag the query asks for in its session, the
+// rest to the other one, before every round.
+bool sendSelectFilter() {
+  bool filtering = selectFilter.active && !programmingMode;
+  if (!r200QueueHasRoom(filtering ? 3 : 2)) return false;
+  bool ok;
+  if (filtering) {
+    uint8_t action = queryConfig.target == R200_TARGET_B ? 0x04 : 0x00;  // 100: match -> B; 000: match -> A
+    uint8_t selParam = (uint8_t)(queryConfig.session << 5 | action << 2 | R200_BANK_EPC);
+    ok = setSelectParams(selParam, EPC_BANK_EPC_BIT + selectFilter.offset, selectFilter.pattern,
+                         selectFilter.bits, logCommandFailure) &&
+         setSelectMode(R200_SELECT_ALWAYS, logCommandFailure);
+  } else {
+    ok = setSelectMode(R200_SELECT_NEVER, logCommandFailure);
+  }
+  return ok && getSelectParams(logCommandFailure);
+}
+
+// Stored as "offset,bits,HEX"
+void loadSelectFilter() {
+  memset(&selectFilter, 0, sizeof(selectFilter));
+  std::string value = tagNameStore->getString(SELECT_KEY);
+  int offset, bits;
+  char hex[2 * EPC_LEN + 1];
+  uint8_t pattern[EPC_LEN];
+  if (sscanf(value.c_str(), "%d,%d,%24s", &offset, &bits, hex) == 3 &&
+      parseHexBits(hex, pattern, EPC_LEN) > 0 && selectFilter.set(offset, bits, pattern)) {
+    platformLog("Select filter: %d bits at %d\n", bits, offset);
+  }
+}
+
+void saveSelectFilter() {
+  if (!selectFilter.active) {
+    tagNameStore->remove(SELECT_KEY);
+    return;
+  }
+  char hex[2 * EPC_LEN + 1];
+  bytesToHex(selectFilter.pattern, (selectFilter.bits + 7) / 8, hex);
+  char value[48];
+  snprintf(value, sizeof(value), "%d,%d,%s", selectFilter.offset, selectFilter.bits, hex);
+  tagNameStore->putString(SELECT_KEY, value);
+}
+
+// Stored as "q,session,target,auto", "region,channel" and
+// "enabled,minPower,maxPower,lowRssi,highRssi,minTags,maxTags"
+void loadInventorySettings() {
+  int q, session, target, autoOn, region, channel;
+  int enabled, minPower, maxPower, lowRssi, highRssi, minTags, maxTags;
+  if (sscanf(tagNameStore->getString(QUERY_KEY).c_str(), "%d,%d,%d,%d", &q, &session, &target, &autoOn) == 4 &&
+      q >= 0 && q <= AUTO_Q_MAX && session >= 0 && session <= 3 && (target == 0 || target == 1)) {
+    queryConfig.q = q;
+    queryConfig.session = session;
+    queryConfig.target = target;
+    queryConfig.autoQ = autoOn != 0;
+  }
+  if (sscanf(tagNameStore->getString(RF_KEY).c_str(), "%d,%d", &region, &channel) == 2) {
+    const R200RegionPlan* plan = r200RegionPlan(region);
+    if (plan && channel < plan->channels) {
+      rfRegion = region;
+      rfChannel = channel < 0 ? -1 : channel;
+    }
+  }
+  if (sscanf(tagNameStore->getString(POWER_CONTROL_KEY).c_str(), "%d,%d,%d,%d,%d,%d,%d", &enabled, &minPower,
+             &maxPower, &lowRssi, &highRssi, &minTags, &maxTags) == 7 &&
+      minPower >= R200_MIN_POWER && minPower <= maxPower && maxPower <= R200_MAX_POWER &&
+      highRssi - lowRssi >= POWER_CONTROL_MIN_BAND && lowRssi >= POWER_CONTROL_RSSI_FLOOR &&
+      highRssi <= POWER_CONTROL_RSSI_CEIL && minTags >= 0 && maxTags >= 0 && minTags <= 65535 && maxTags <= 65535) {
+    PowerControlConfig& config = powerControl.config;
+    config.enabled = enabled != 0;
+    config.minPower = (int16_t)minPower;
+    config.maxPower = (int16_t)maxPower;
+    config.lowRssi = (int8_t)lowRssi;
+    config.highRssi = (int8_t)highRssi;
+    config.minTags = (uint16_t)minTags;
+    config.maxTags = (uint16_t)maxTags;
+    // readerSetup starts from requestedPower
+    if (config.enabled) {
+      requestedPower = requestedPower < minPower ? minPower : requestedPower > maxPower ? maxPower : requestedPower;
+    }
+  }
+}
+
+void saveQueryConfig() {
+  char value[24];
+  snprintf(value, sizeof(value), "%u,%u,%u,%d", queryConfig.q, queryConfig.session, queryConfig.target,
+           queryConfig.autoQ ? 1 : 0);
+  tagNameStore->putString(QUERY_KEY, value);
+}
+
+void savePowerControl() {
+  const PowerControlConfig& config = powerControl.config;
+  char value[48];
+  snprintf(value, sizeof(value), "%d,%d,%d,%d,%d,%u,%u", config.enabled ? 1 : 0, config.minPower, config.maxPower,
+           config.lowRssi, config.highRssi, config.minTags, config.maxTags);
+  tagNameStore->putString(POWER_CONTROL_KEY, value);
+}
+
+void saveRfConfig() {
+  char value[16];
+  snprintf(value, sizeof(value), "%u,%d", rfRegion, rfChannel);
+  tagNameStore->putString(RF_KEY, value);
+}
+
+// Queue the setup commands; readerState fills in as the answers arrive
+void readerSetup() {
+  getHardwareVersion(logVersionReply);
+  getSoftwareVersion(logVersionReply);
+  setPower(requestedPower, onPowerSet);
+  sendQueryConfig();
+  sendSelectFilter();
+  if (rfRegion) {
+    sendRfConfig();
+  } else {
+    getRegion(logCommandFailure);
+    getChannel(logCommandFailure);
+  }
+}
+
+// Get tags read for registration or programming as Start would: one round
+// in single mode, otherwise polling unless it already runs
+bool startReading() {
+  if (readerMode == MODE_SINGLE) return singlePoll();
+  if (isScanning) return true;
+  if (!startScanning()) return false;
+  isScanning = true;
+  return true;
+}
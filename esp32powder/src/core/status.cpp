@@ -0,0 +1,262 @@
+// Status fields shared by /api/status and the event stream, and the event
+// stream itself
+
+#include "tracker.h"
+
+ModeSnapshot eventModeSnapshot;
+
+void takeModeSnapshot(ModeSnapshot& snap) {
+  memset(&snap, 0, sizeof(snap));
+  snap.scanning = isScanning;
+  snap.power = currentPower;
+  snap.requestedPower = requestedPower;
+  snap.readerChanges = readerState.changes;
+  snap.select = selectFilter;
+  snap.query = queryConfig;
+  snap.rfRegion = rfRegion;
+  snap.rfChannel = rfChannel;
+  snap.sweepState = powerSweep.state;
+  snap.sweepLevel = powerSweep.level;
+  // Field by field: the config's padding is not cleared where it is set
+  const PowerControlConfig& control = powerControl.config;
+  snap.powerControl.enabled = control.enabled;
+  snap.powerControl.minPower = control.minPower;
+  snap.powerControl.maxPower = control.maxPower;
+  snap.powerControl.lowRssi = control.lowRssi;
+  snap.powerControl.highRssi = control.highRssi;
+  snap.powerControl.minTags = control.minTags;
+  snap.powerControl.maxTags = control.maxTags;
+  snap.powerControlSteps = powerControl.stepsUp + powerControl.stepsDown;
+  snap.mode = readerMode;
+  snap.dutyOn = dutyOnMs;
+  snap.dutyOff = dutyOffMs;
+  snap.dutyPhaseOn = dutyOn;
+  snap.registrationMode = registrationMode;
+  snap.registrationHasTag = registrationHasTag;
+  if (registrationHasTag) memcpy(snap.registrationEPC, registrationEPC, EPC_LEN);
+  snap.registrationProgress = registrationConfirmCount;
+  snap.programmingState = programmingState;
+  if (programmingState != PROG_IDLE) memcpy(snap.programmingEPC, programmingEPC, EPC_LEN);
+  snap.programmingProgress = programmingConfirmCount;
+  snap.programmingAttempts = programmingAttempts;
+}
+
+void writeCountFields(JsonStream& out) {
+  out.key("tagCount").num(tagCount);
+  out.key("lastTag");
+  if (hasLastTag) out.hex(lastTagEPC, EPC_LEN); else out.str("No tags detected yet");
+  out.key("historyCount").num(history.size());
+  out.key("historyDropped").num(history.droppedCount());
+  out.key("presentCount").num(presentCount);
+  out.key("selectFiltered").num(selectFiltered);
+}
+
+void writeReaderFields(JsonStream& out) {
+  const ReaderState& state = readerState;
+  out.key("reader").beginObject();
+  out.key("hardware").str(state.hardware);
+  out.key("software").str(state.software);
+  out.key("region").num(state.region);
+  out.key("channel").num(state.channel);
+  const R200RegionPlan* plan = r200RegionPlan(state.region);
+  if (plan && state.channel >= 0) {
+    out.key("channelKHz").num((unsigned long)(plan->baseKHz + (uint32_t)state.channel * plan->stepKHz));
+  }
+  if (state.query >= 0) {
+    out.key("q").num((state.query >> 3) & 15);
+    out.key("session").num((state.query >> 8) & 3);
+    out.key("target").str((state.query >> 7) & 1 ? "B" : "A");
+  }
+  if (state.selectKnown) {
+    out.key("selectBank").num(state.selParam & 3);
+    out.key("selectPointer").num(state.selectPointer);
+    out.key("selectBits").num(state.selectBits);
+    out.key("selectMask").hex(state.selectMask, (state.selectBits + 7) / 8);
+  }
+  out.key("lastError").num(state.lastError);
+  out.key("lastErrorText").str(state.lastError ? r200ErrorName(state.lastError) : "");
+  out.endObject();
+}
+
+void writeSelectFields(JsonStream& out) {
+  out.key("select").beginObject();
+  out.key("active").boolean(selectFilter.active);
+  if (selectFilter.active) {
+    out.key("offset").num(selectFilter.offset);
+    out.key("bits").num(selectFilter.bits);
+    out.key("mask").hex(selectFilter.pattern, (selectFilter.bits + 7) / 8);
+  }
+  out.endObject();
+}
+
+void writeQueryFields(JsonStream& out) {
+  out.key("query").beginObject();
+  out.key("q").num(queryConfig.q);
+  out.key("session").num(queryConfig.session);
+  out.key("target").str(queryConfig.target == R200_TARGET_B ? "B" : "A");
+  out.key("auto").boolean(queryConfig.autoQ);
+  out.key("autoChanges").num(autoQ.changes);
+  out.endObject();
+  out.key("rf").beginObject();
+  out.key("region").num(rfRegion);
+  out.key("channel").num(rfChannel);
+  out.key("hopping").boolean(rfChannel < 0);
+  out.endObject();
+}
+
+// Sweep progress and outcome for the dashboard; /api/sweep has the levels
+static void writeSweepFields(JsonStream& out) {
+  const PowerSweep& sweep = powerSweep;
+  out.key("sweep").beginObject();
+  out.key("state").str(sweepStateName(sweep.state));
+  if (sweep.state != SWEEP_IDLE) {
+    out.key("level").num(sweep.level);
+    out.key("levels").num(sweep.levelCount);
+    out.key("power").num(sweep.levels[sweep.level].power);
+    int best = sweep.recommended();
+    out.key("recommended").num(best >= 0 ? sweep.levels[best].power : 0);
+    out.key("failure").str(sweep.failure);
+  }
+  out.endObject();
+}
+
+// Controller settings and its last window
+void writePowerControlFields(JsonStream& out) {
+  const PowerControl& control = powerControl;
+  const PowerControlConfig& config = control.config;
+  out.key("powerControl").beginObject();
+  out.key("enabled").boolean(config.enabled);
+  out.key("minPower").num(config.minPower);
+  out.key("maxPower").num(config.maxPower);
+  out.key("lowRssi").num(config.lowRssi);
+  out.key("highRssi").num(config.highRssi);
+  out.key("minTags").num(config.minTags);
+  out.key("maxTags").num(config.maxTags);
+  out.key("tags").num(control.lastTags);
+  out.key("ownTags").num(control.lastOwnTags);
+  out.key("weakRssi").num(control.lastWeakRssi);
+  out.key("reason").str(control.reason);
+  out.key("stepsUp").num(control.stepsUp);
+  out.key("stepsDown").num(control.stepsDown);
+  out.key("holds").num(control.holds);
+  out.key("holding").boolean(control.holdWindows > 0);
+  out.endObject();
+}
+
+void writeModeFields(JsonStream& out) {
+  out.key("scanning").boolean(isScanning);
+  out.key("power").num(currentPower);
+  out.key("powerRequested").num(requestedPower);
+  writeReaderFields(out);
+  writeSelectFields(out);
+  writeQueryFields(out);
+  writeSweepFields(out);
+  writePowerControlFields(out);
+  out.key("mode").str(readerModeName(readerMode));
+  out.key("dutyOn").num(dutyOnMs);
+  out.key("dutyOff").num(dutyOffMs);
+  out.key("dutyPhase").str(readerMode != MODE_CONTROLLED || !isScanning ? "" : dutyOn ? "on" : "off");
+  out.key("registrationMode").boolean(registrationMode);
+  out.key("registrationEPC");
+  if (registrationHasTag) out.hex(registrationEPC, EPC_LEN); else out.str("");
+  out.key("registrationProgress").num(registrationConfirmCount);
+}
+
+void writeProgrammingFields(JsonStream& out) {
+  out.key("programmingMode").boolean(programmingMode);
+  out.key("programmingState").str(programmingStateName(programmingState));
+  out.key("programmingEPC");
+  if (programmingState != PROG_IDLE) out.hex(programmingEPC, EPC_LEN); else out.str("");
+  out.key("programmingProgress").num(programmingConfirmCount);
+  out.key("programmingComplete").boolean(programmingState == PROG_DONE);
+  out.key("programmingAttempts").num(programmingAttempts);
+  out.key("programmingError").str(programmingState == PROG_FAILED ? programmingFailure : "");
+  out.key("programmingErrorCode").num(programmingErrorCode);
+  out.key("programmingTiming").beginObject();
+  out.key("confirm").num(programmingTiming.confirm);
+  out.key("stop").num(programmingTiming.stop);
+  out.key("write").num(programmingTiming.write);
+  out.key("verify").num(programmingTiming.verify);
+  out.key("total").num(programmingTiming.total);
+  out.endObject();
+}
+
+// Signal statistics; times are ms since start/clear
+static void writeTagStatsFields(JsonStream& out, const TagInfo& tag) {
+  out.key("avg").num(tag.stats.rssiAvg, 1);
+  out.key("var").num(tag.stats.rssiVar, 1);
+  out.key("min").num(tag.stats.rssiMin);
+  out.key("max").num(tag.stats.rssiMax);
+  out.key("rate").num(tagReadRate(tag.stats, platformMillis()), 1);
+  out.key("first").num(tag.stats.firstSeen - systemStartTime);
+  out.key("last").num(tag.lastSeen - systemStartTime);
+}
+
+void writeTagFields(JsonStream& out, int record) {
+  const TagInfo& tag = tagDatabase[record];
+  out.key("no").num(record + 1);
+  out.key("pc").hex(tag.pc, 2);
+  out.key("epc").hex(tag.epc, EPC_LEN);
+  out.key("crc");
+  if (tag.flags & TAG_FLAG_HAS_CRC) out.hex(tag.crc, 2); else out.str("N/A");
+  out.key("rssi").num(tag.rssi);
+  out.key("cnt").num(tag.readCount);
+  out.key("ant").num(tag.antenna);
+  out.key("name").str(tagNameFor(tag.nameSlot));
+  out.key("present").boolean(tag.flags & TAG_FLAG_PRESENT);
+  writeTagStatsFields(out, tag);
+}
+
+// Tag event: every field the first time, then only what a read changes
+static void writeTagEventFields(JsonStream& out, int record) {
+  TagInfo& tag = tagDatabase[record];
+  if (tag.flags & TAG_FLAG_EVENT_FULL) {
+    tag.flags &= ~TAG_FLAG_EVENT_FULL;
+    writeTagFields(out, record);
+    return;
+  }
+  out.key("no").num(record + 1);
+  out.key("rssi").num(tag.rssi);
+  out.key("cnt").num(tag.readCount);
+  out.key("avg").num(tag.stats.rssiAvg, 1);
+}
+
+// ========================================
+// Event stream (/api/events)
+// ========================================
+// Every EVENT_COALESCE_MS: one "tag" event per record touched since the last
+// push plus "counts", and "mode"/"programming" when those fields changed
+void eventsPoll() {
+  uint32_t now = platformMillis();
+  if (!eventHub.active()) {
+    eventPendingCount = 0;
+    eventFlushSeq = statusSeq;
+    return;
+  }
+  if (now - eventLastFlush < EVENT_COALESCE_MS) return;
+  eventLastFlush = now;
+
+  ModeSnapshot snap = {};
+  takeModeSnapshot(snap);
+  const uint8_t* current = (const uint8_t*)&snap;
+  const uint8_t* sent = (const uint8_t*)&eventModeSnapshot;
+  if (memcmp(current, sent, MODE_SNAPSHOT_SPLIT) != 0) {
+    pushEvent("mode", writeModeFields);
+  }
+  if (memcmp(current + MODE_SNAPSHOT_SPLIT, sent + MODE_SNAPSHOT_SPLIT,
+             sizeof(snap) - MODE_SNAPSHOT_SPLIT) != 0) {
+    pushEvent("programming", writeProgrammingFields);
+  }
+  memcpy(&eventModeSnapshot, &snap, sizeof(snap));  // padding included, as compared
+
+  if (eventPendingCount > 0) {
+    for (int i = 0; i < eventPendingCount; i++) {
+      int record = eventPending[i];
+      pushEvent("tag", [record](JsonStream& out) { writeTagEventFields(out, record); });
+    }
+    pushEvent("counts", writeCountFields);
+    eventPendingCount = 0;
+  }
+  eventFlushSeq = statusSeq;
+  eventHub.flush(now);
+}
@@ -0,0 +1,669 @@
+// Tracker state, setup, names, tag processing, ingest and presence - see
+// tracker.h for what each piece of state means
+
+#include <vector>
+
+#include "tracker.h"
+
+KeyValueStore* tagNameStore = nullptr;
+
+bool isScanning = false;
+int currentPower = 0;
+int requestedPower = 3000;
+ReaderState readerState;
+EpcFilter selectFilter;
+uint32_t selectFiltered = 0;
+QueryConfig queryConfig;
+AutoQ autoQ;
+uint8_t rfRegion = 0;
+int16_t rfChannel = -1;
+PowerSweep powerSweep;
+PowerControl powerControl;
+
+ReaderMode readerMode = MODE_MULTIPLE;
+uint32_t dutyOnMs = 2000;
+uint32_t dutyOffMs = 1000;
+bool dutyOn = true;
+uint32_t dutyPhaseAt = 0;
+uint32_t pollArmedAt = 0;
+uint32_t pollRearms = 0;
+uint32_t dutyCycles = 0;
+uint8_t lastTagEPC[EPC_LEN];
+bool hasLastTag = false;
+int tagCount = 0;
+unsigned long lastTagTime = 0;
+
+R200FrameParser r200Parser;
+SpscQueue<QueuedFrame, INGEST_QUEUE_DEPTH> ingestQueue;
+IngestStats ingestStats;
+bool ingestOnOwnTask = false;
+
+bool registrationMode = false;
+uint8_t registrationEPC[EPC_LEN];
+bool registrationHasTag = false;
+int registrationConfirmCount = 0;
+
+bool programmingMode = false;
+ProgrammingState programmingState = PROG_IDLE;
+uint8_t programmingEPC[EPC_LEN];
+int programmingConfirmCount = 0;
+int programmingAttempts = 0;
+uint8_t programmingErrorCode = 0;
+const char* programmingFailure = "";
+ProgrammingTiming programmingTiming;
+uint32_t programmingStartedAt = 0;
+uint32_t programmingStepAt = 0;
+
+TagInfo* tagDatabase = nullptr;
+int tagDatabaseCount = 0;
+int tagCapacity = 0;
+TagIndex tagIndex;
+
+PresenceConfig presenceConfig = {3, 2000, -70, 5000, -78};
+TimerWheel presenceWheel;
+int presentCount = 0;
+uint32_t presenceEnters = 0;
+uint32_t presenceLeaves = 0;
+TagFullPolicy tagFullPolicy = TAG_FULL_REJECT;
+uint32_t tagReads = 0;
+RateMeter frameRate;
+RateMeter readRate;
+uint32_t tagsRejected = 0;
+uint32_t tagsEvicted = 0;
+
+TagName tagNames[MAX_TAG_NAMES];
+int tagNameCount = 0;
+EpcIndex<TagName> tagNameIndex;
+uint16_t tagNameTable[2 * MAX_TAG_NAMES];
+int tagNamesDirty = 0;
+uint32_t tagNamesChangedAt = 0;
+
+uint32_t statusSeq = 0;
+uint32_t statusModeSeq = 0;
+uint32_t statusResetSeq = 0;
+
+EventHub eventHub;
+uint16_t* eventPending = nullptr;
+int eventPendingCount = 0;
+uint32_t eventFlushSeq = 0;
+uint32_t eventLastFlush = 0;
+
+HistoryLog history;
+ReadingLog readingLog;
+unsigned long systemStartTime = 0;
+
+bool trackerBegin(ReaderPort& port, KeyValueStore& store, int power, uint16_t maxTags,
+                  uint32_t maxHistory) {
+  r200Port = &port;
+  r200Commands.begin(&port);
+  tagNameStore = &store;
+  requestedPower = power;
+  currentPower = 0;
+  memset(&readerState, 0, sizeof(readerState));
+  readerState.channel = -1;
+  readerState.query = -1;
+  systemStartTime = platformMillis();
+  queryConfig.q = 4;
+  queryConfig.session = R200_SESSION_S0;
+  queryConfig.target = R200_TARGET_A;
+  queryConfig.autoQ = false;
+  rfRegion = 0;
+  rfChannel = -1;
+  autoQ.begin(systemStartTime);
+  memset(&powerSweep, 0, sizeof(powerSweep));
+  PowerControlConfig& control = powerControl.config;
+  control.enabled = false;
+  control.minPower = POWER_CONTROL_DEFAULT_MIN < power ? POWER_CONTROL_DEFAULT_MIN : power;
+  control.maxPower = power;
+  control.lowRssi = POWER_CONTROL_DEFAULT_LOW_RSSI;
+  control.highRssi = POWER_CONTROL_DEFAULT_HIGH_RSSI;
+  control.minTags = 0;
+  control.maxTags = 0;
+  powerControl.begin(systemStartTime);
+
+  size_t tableSize = TagIndex::tableSizeFor(maxTags);
+  tagDatabase = (TagInfo*)platformAllocLarge(maxTags * sizeof(TagInfo));
+  uint16_t* table = (uint16_t*)platformAllocLarge(tableSize * sizeof(uint16_t));
+  eventPending = (uint16_t*)platformAllocLarge(maxTags * sizeof(uint16_t));
+  uint16_t* timerNext = (uint16_t*)platformAllocLarge(maxTags * sizeof(uint16_t));
+  uint16_t* timerPrev = (uint16_t*)platformAllocLarge(maxTags * sizeof(uint16_t));
+  uint8_t* timerSlot = (uint8_t*)platformAllocLarge(maxTags);
+  uint32_t* timerDue = (uint32_t*)platformAllocLarge(maxTags * sizeof(uint32_t));
+  if (!tagDatabase || !table || !eventPending || !timerNext || !timerPrev || !timerSlot || !timerDue) {
+    platformLog("✗ Tag database allocation failed (%u tags)\n", maxTags);
+    tagCapacity = 0;
+    return false;
+  }
+  tagCapacity = maxTags;
+  memset(tagDatabase, 0, maxTags * sizeof(TagInfo));
+  tagIndex.begin(tagDatabase, table, tableSize);
+  presenceWheel.begin(timerNext, timerPrev, timerSlot, timerDue, maxTags, PRESENCE_TICK_MS, platformMillis());
+  platformLog("✓ Tag database: %u tags, %u index slots\n", maxTags, (unsigned)tableSize);
+
+  ReadingHistory* readings = (ReadingHistory*)platformAllocLarge(maxHistory * sizeof(ReadingHistory));
+  if (!readings) {
+    platformLog("✗ History allocation failed (%u records)\n", (unsigned)maxHistory);
+    return false;
+  }
+  history.begin(readings, maxHistory);
+  platformLog("✓ History: %u records\n", (unsigned)maxHistory);
+
+  loadTagNames();
+  loadSelectFilter();
+  loadInventorySettings();
+  return true;
+}
+
+// Recover the persistent log; reads are only logged once this has run
+void trackerBeginLog(FileStore& files, int segments) {
+  uint32_t started = platformMillis();
+  readingLog.begin(&files, segments);
+  const LogStats& stats = readingLog.getStats();
+  platformLog("✓ Reading log: %u records in %d segments (seq %u..%u), recovered in %u ms\n",
+              (unsigned)stats.recovered, readingLog.segments(), (unsigned)readingLog.firstSeq(),
+              (unsigned)readingLog.lastSeq(), (unsigned)(platformMillis() - started));
+}
+
+// Timestamp helpers - a duration, or the time since start/clear, as HH:MM:SS
+void formatDuration(uint32_t elapsed, char* out, size_t size) {
+  unsigned long seconds = elapsed / 1000;
+  unsigned long minutes = seconds / 60;
+  unsigned long hours = minutes / 60;
+  seconds = seconds % 60;
+  minutes = minutes % 60;
+
+  snprintf(out, size, "%02lu:%02lu:%02lu", hours, minutes, seconds);
+}
+
+void formatTimestamp(uint32_t ms, char* out, size_t size) {
+  formatDuration(ms - systemStartTime, out, size);
+}
+
+// Hex for the JSON API
+std::string toHex(const uint8_t* data, int len) {
+  char out[2 * EPC_LEN + 1];
+  bytesToHex(data, len, out);
+  return std::string(out);
+}
+
+// Tag name management
+int findNameSlot(const uint8_t* epc) {
+  return tagNameIndex.find(epc);
+}
+
+static int storeNameSlot(const uint8_t* epc, const char* name) {
+  int slot = findNameSlot(epc);
+  if (slot < 0) {
+    if (tagNameCount >= MAX_TAG_NAMES) return -1;
+    slot = tagNameCount++;
+    memcpy(tagNames[slot].epc, epc, EPC_LEN);
+    tagNames[slot].flags = 0;
+    tagNameIndex.insert(epc, slot);
+  }
+  strncpy(tagNames[slot].name, name, TAG_NAME_LEN);
+  tagNames[slot].name[TAG_NAME_LEN] = '\0';
+  return slot;
+}
+
+const char* tagNameFor(int slot) {
+  return slot >= 0 ? tagNames[slot].name : "";
+}
+
+static void nameKey(const uint8_t* epc, char* out, size_t size) {
+  snprintf(out, size, NAME_KEY_PREFIX "%08X", (unsigned)epcHash(epc));
+}
+
+static void markNameDirty(int slot) {
+  if (!(tagNames[slot].flags & NAME_FLAG_DIRTY)) {
+    tagNames[slot].flags |= NAME_FLAG_DIRTY;
+    tagNamesDirty++;
+  }
+  tagNamesChangedAt = platformMillis();
+}
+
+// RAM now, NVS on the next flushTagNames()
+int saveTagName(const uint8_t* epc, const std::string& name) {
+  int slot = storeNameSlot(epc, name.c_str());
+  if (slot < 0) {
+    platformLog("✗ Name table full (%d names)\n", MAX_TAG_NAMES);
+    return -1;
+  }
+  markNameDirty(slot);
+  platformLog("Saved: %s -> %s\n", toHex(epc, EPC_LEN).c_str(), name.c_str());
+  return slot;
+}
+
+// Memory only - every registered name is loaded at boot
+static int lookupTagName(const uint8_t* epc) {
+  return findNameSlot(epc);
+}
+
+// Write-behind: dirty names go out together once edits have settled for
+// NAME_FLUSH_DELAY_MS, or right away with force
+void flushTagNames(bool force) {
+  if (tagNamesDirty == 0) return;
+  if (!force && platformMillis() - tagNamesChangedAt < NAME_FLUSH_DELAY_MS) return;
+
+  char key[16];
+  int written = 0;
+  tagNameStore->beginBatch();
+  for (int i = 0; i < tagNameCount; i++) {
+    if (!(tagNames[i].flags & NAME_FLAG_DIRTY)) continue;
+    nameKey(tagNames[i].epc, key, sizeof(key));
+    tagNameStore->putString(key, toHex(tagNames[i].epc, EPC_LEN) + "|" + tagNames[i].name);
+    tagNames[i].flags &= ~NAME_FLAG_DIRTY;
+    written++;
+  }
+  tagNameStore->endBatch();
+  tagNamesDirty = 0;
+  platformLog("✓ %d name(s) written to NVS\n", written);
+}
+
+// "EPCHEX|name" -> name table slot, -1 when malformed or the table is full
+static int loadNameValue(const std::string& value) {
+  uint8_t epc[EPC_LEN];
+  if (value.length() < EPC_HEX_LEN + 2 || value[EPC_HEX_LEN] != '|') return -1;
+  if (!parseEpcHex(value.substr(0, EPC_HEX_LEN).c_str(), epc)) return -1;
+  return storeNameSlot(epc, value.c_str() + EPC_HEX_LEN + 1);
+}
+
+static std::vector<std::string> legacyNameKeys;
+
+static void loadNameEntry(const char*, const std::string& value) {
+  loadNameValue(value);
+}
+
+// Old keys only held the first 8 hex digits, so registrations with a shared
+// prefix overwrote each other; whatever survived moves to a full-EPC key
+static void loadLegacyNameEntry(const char* key, const std::string& value) {
+  legacyNameKeys.push_back(key);
+  uint8_t epc[EPC_LEN];
+  if (value.length() > EPC_HEX_LEN && parseEpcHex(value.substr(0, EPC_HEX_LEN).c_str(), epc) &&
+      findNameSlot(epc) >= 0) {
+    return;  // already stored under the new scheme
+  }
+  int slot = loadNameValue(value);
+  if (slot >= 0) markNameDirty(slot);
+}
+
+void loadTagNames() {
+  tagNameCount = 0;
+  tagNamesDirty = 0;
+  tagNameIndex.begin(tagNames, tagNameTable, 2 * MAX_TAG_NAMES);
+  tagNameStore->forEachString(NAME_KEY_PREFIX, loadNameEntry);
+  tagNameStore->forEachString(LEGACY_NAME_KEY_PREFIX, loadLegacyNameEntry);
+
+  if (!legacyNameKeys.empty()) {
+    flushTagNames(true);
+    tagNameStore->beginBatch();
+    for (size_t i = 0; i < legacyNameKeys.size(); i++) tagNameStore->remove(legacyNameKeys[i].c_str());
+    tagNameStore->endBatch();
+    platformLog("✓ Migrated %u legacy name key(s)\n", (unsigned)legacyNameKeys.size());
+    legacyNameKeys.clear();
+  }
+  platformLog("✓ Names: %d loaded\n", tagNameCount);
+}
+
+// Drop anything already waiting on the reader link. Only before the ingest
+// task starts - the parser belongs to the producer side.
+void flushReader() {
+  while (r200Port->available()) r200Port->read();
+  r200Parser.reset();
+  while (ingestQueue.front()) ingestQueue.pop();
+}
+
+// Tag notification payload: RSSI | PC (2) | EPC (12) | CRC (2)
+#define TAG_PAYLOAD_MIN 15
+#define TAG_PAYLOAD_WITH_CRC 17
+
+// Record for a tag not yet in the database, or -1 when the full policy
+// says to drop it
+static int allocateTagRecord() {
+  if (tagDatabaseCount < tagCapacity) {
+    return tagDatabaseCount++;
+  }
+
+  if (tagFullPolicy == TAG_FULL_REJECT || tagCapacity == 0) {
+    tagsRejected++;
+    return -1;
+  }
+
+  // Full scan, but only runs when a new tag arrives at a full database
+  int stalest = 0;
+  for (int i = 1; i < tagDatabaseCount; i++) {
+    if ((int32_t)(tagDatabase[i].lastSeen - tagDatabase[stalest].lastSeen) < 0) stalest = i;
+  }
+  tagIndex.remove(tagDatabase[stalest].epc);
+  presenceForget(stalest);
+  tagsEvicted++;
+  return stalest;
+}
+
+// Give a record a new change sequence and queue it for the event stream.
+// full = more than RSSI and count changed (new tag, eviction, rename).
+void touchTag(int record, bool full) {
+  TagInfo& tag = tagDatabase[record];
+  if (full) tag.flags |= TAG_FLAG_EVENT_FULL;
+  if (eventHub.active() && tag.changeSeq <= eventFlushSeq) {
+    eventPending[eventPendingCount++] = record;
+  }
+  tag.changeSeq = ++statusSeq;
+}
+
+// Station stock for the power sweep: the registered tags once there are
+// any, before that every tag read at the presence enter RSSI or better
+static bool sweepOwnTag(int record, int8_t rssi) {
+  if (tagNameCount > 0) return record >= 0 && tagDatabase[record].nameSlot >= 0;
+  return rssi >= presenceConfig.enterRssi;
+}
+
+// Process tag packet
+static void processTagPacket(const R200Frame& frame) {
+  const byte* p = frame.payload;
+  int8_t rssi = (int8_t)p[0];  // signed dBm
+  const uint8_t* pc = p + 1;
+  const uint8_t* epc = p + 3;
+  bool hasCrc = frame.length >= TAG_PAYLOAD_WITH_CRC;  // short notifications carry no CRC
+  uint32_t now = platformMillis();
+
+  // Registration mode
+  if (registrationMode) {
+    if (!registrationHasTag) {
+      memcpy(registrationEPC, epc, EPC_LEN);
+      registrationHasTag = true;
+      registrationConfirmCount = 1;
+    } else if (epcEquals(registrationEPC, epc)) {
+      registrationConfirmCount++;
+      if (registrationConfirmCount >= REGISTRATION_CONFIRM_THRESHOLD) {
+        platformLog(">>> READY FOR NAMING <<<\n");
+      }
+    } else {
+      memcpy(registrationEPC, epc, EPC_LEN);
+      registrationConfirmCount = 1;
+    }
+    return;
+  }
+
+  // Programming mode
+  if (programmingMode) {
+    programmingTagSeen(epc, now);
+    return;
+  }
+
+  // Normal mode - update database
+  int record = tagIndex.find(epc);
+  bool autoQFirst = record == -1 || (int32_t)(tagDatabase[record].lastSeen - autoQ.windowStart) <= 0;
+  // Reads in the millisecond counting started are left out, so a tag's
+  // first read at the level is the one with lastSeen at or before it
+  bool sweepCounts = powerSweep.state == SWEEP_DWELL && (int32_t)(now - powerSweep.levelStart) > 0;
+  bool sweepFirst = record == -1 || (int32_t)(tagDatabase[record].lastSeen - powerSweep.levelStart) <= 0;
+
+  if (record == -1) {
+    record = allocateTagRecord();
+    if (record >= 0) {
+      TagInfo& tag = tagDatabase[record];
+      memcpy(tag.epc, epc, EPC_LEN);
+      memcpy(tag.pc, pc, 2);
+      if (hasCrc) memcpy(tag.crc, p + 15, 2);
+      tag.flags = hasCrc ? TAG_FLAG_HAS_CRC : 0;
+      tag.rssi = rssi;
+      tag.readCount = 1;
+      tag.antenna = 1;
+      tag.lastSeen = now;
+      tagStatsBegin(tag.stats, rssi, now);
+      tag.enterCount = 0;
+      tag.nameSlot = lookupTagName(epc);
+      touchTag(record, true);
+      tagIndex.insert(epc, record);
+      presenceOnRead(record, now);
+    }
+  } else {
+    TagInfo& tag = tagDatabase[record];
+    tag.rssi = rssi;
+    tag.readCount++;
+    tag.lastSeen = now;
+    tagStatsUpdate(tag.stats, rssi, now);
+    touchTag(record);
+    presenceOnRead(record, now);
+  }
+
+  // A read the full table rejected is no new tag, however often it comes
+  autoQ.onRead(record >= 0 && autoQFirst);
+
+  if (history.capacity() > 0) {
+    ReadingHistory& reading = history.append();
+    reading.timestamp = now;
+    memcpy(reading.epc, epc, EPC_LEN);
+    reading.rssi = rssi;
+  }
+  if (readingLog.ready()) readingLog.append(epc, rssi, now);
+
+  if (sweepCounts) powerSweep.onRead(record >= 0 && sweepFirst, rssi, sweepOwnTag(record, rssi));
+
+  tagCount = tagDatabaseCount;
+  memcpy(lastTagEPC, epc, EPC_LEN);
+  hasLastTag = true;
+  lastTagTime = now;
+}
+
+// Keep readerState in step with every reply, whoever asked
+static void applyReaderReply(const R200Reply& reply) {
+  ReaderState& state = readerState;
+  bool changed = false;
+  switch (reply.kind) {
+    case R200_REPLY_MODULE_INFO: {
+      char* text = reply.info.type == 0x00 ? state.hardware : reply.info.type == 0x01 ? state.software : nullptr;
+      if (text && strcmp(text, reply.info.text) != 0) {
+        strcpy(text, reply.info.text);
+        changed = true;
+      }
+      break;
+    }
+    case R200_REPLY_POWER:
+      changed = currentPower != reply.power;
+      currentPower = reply.power;
+      break;
+    case R200_REPLY_QUERY:
+      changed = state.query != reply.query.param;
+      state.query = reply.query.param;
+      break;
+    case R200_REPLY_REGION:
+      changed = state.region != reply.region;
+      state.region = reply.region;
+      break;
+    case R200_REPLY_CHANNEL:
+      changed = state.channel != reply.channel;
+      state.channel = reply.channel;
+      break;
+    case R200_REPLY_SELECT: {
+      uint8_t bits = reply.select.maskBits > R200_MASK_MAX_BYTES * 8 ? R200_MASK_MAX_BYTES * 8 : reply.select.maskBits;
+      int bytes = (bits + 7) / 8;
+      changed = !state.selectKnown || state.selParam != reply.select.selParam ||
+                state.selectPointer != reply.select.pointer || state.selectBits != bits ||
+                memcmp(state.selectMask, reply.select.mask, bytes) != 0;
+      state.selectKnown = true;
+      state.selParam = reply.select.selParam;
+      state.selectPointer = reply.select.pointer;
+      state.selectBits = bits;
+      memset(state.selectMask, 0, sizeof(state.selectMask));
+      memcpy(state.selectMask, reply.select.mask, bytes);
+      break;
+    }
+    case R200_REPLY_ERROR:
+      if (reply.error.code == R200_ERROR_INVENTORY_FAIL) {
+        state.emptyRounds++;
+        autoQ.onEmptyRound();
+        break;
+      }
+      state.errorReplies++;
+      changed = state.lastError != reply.error.code;
+      state.lastError = reply.error.code;
+      platformLog("✗ R200 error 0x%02X (%s)\n", reply.error.code, r200ErrorName(reply.error.code));
+      break;
+    default:
+      break;
+  }
+  if (changed) state.changes++;
+}
+
+static void handleR200Frame(const R200Frame& frame) {
+  if (frame.type == R200_TYPE_RESPONSE) {
+    R200Reply reply;
+    if (r200DecodeReply(frame, reply)) applyReaderReply(reply);
+  }
+
+  // Replies to queued commands go to their handlers
+  if (r200Commands.onFrame(frame)) return;
+
+  // Error frames are only counted
+  if (frame.type == R200_TYPE_RESPONSE && frame.command == R200_CMD_ERROR) {
+    return;
+  }
+
+  if (frame.type == R200_TYPE_NOTICE && frame.command == R200_CMD_SINGLE_POLL &&
+      frame.length >= TAG_PAYLOAD_MIN) {
+    tagReads++;
+    // RSSI and PC come before the EPC
+    if (selectFilter.active && !programmingMode && !selectFilter.matches(frame.payload + 3)) {
+      selectFiltered++;
+      return;
+    }
+    processTagPacket(frame);
+  }
+}
+
+// ----- Ingest, producer side -----
+static void queueR200Frame(const R200Frame& frame) {
+  QueuedFrame* slot = ingestQueue.reserve();
+  if (!slot) {
+    ingestStats.queueDropped++;
+    return;
+  }
+  slot->type = frame.type;
+  slot->command = frame.command;
+  slot->length = frame.length < INGEST_FRAME_PAYLOAD ? frame.length : INGEST_FRAME_PAYLOAD;
+  memcpy(slot->payload, frame.payload, slot->length);
+  ingestQueue.commit();
+}
+
+// One byte off the reader link - parser checks length, checksum and end
+// byte. Callers hold bytes back while ingestQueue.full().
+void ingestByte(uint8_t b) {
+  r200Parser.push(b, queueR200Frame);
+}
+
+// Producer side: make the parser's counters readable from the loop task
+void ingestPublishStats() {
+  const R200ParserStats& stats = r200Parser.getStats();
+  ingestStats.frames.store(stats.frames, std::memory_order_relaxed);
+  ingestStats.checksumErrors.store(stats.checksumErrors, std::memory_order_relaxed);
+  ingestStats.framingErrors.store(stats.framingErrors, std::memory_order_relaxed);
+  ingestStats.bytesDiscarded.store(stats.bytesDiscarded, std::memory_order_relaxed);
+}
+
+static void ingestPoll() {
+  while (!ingestQueue.full() && r200Port->available()) {
+    ingestByte((byte)r200Port->read());
+  }
+  ingestPublishStats();
+}
+
+// ----- Consumer side -----
+// Handle queued frames, then let the command queue send, retry or time out
+void trackerPoll() {
+  do {
+    if (!ingestOnOwnTask) ingestPoll();
+    QueuedFrame* queued;
+    while ((queued = ingestQueue.front()) != nullptr) {
+      R200Frame frame = {queued->type, queued->command, queued->length, queued->payload};
+      handleR200Frame(frame);
+      ingestQueue.pop();
+    }
+  } while (!ingestOnOwnTask && r200Port->available());
+
+  uint32_t now = platformMillis();
+  r200Commands.poll(now);
+  programmingPoll(now);
+  flushTagNames(false);
+  if (readingLog.ready()) readingLog.poll(now);
+  presenceWheel.advance(now, presenceExpired);
+  readerModePoll(now);
+  autoQPoll(now);
+  sweepPoll(now);
+  powerControlPoll(now);
+  frameRate.sample(ingestStats.frames.load(), now);
+  readRate.sample(tagReads, now);
+}
+
+// Call before the board loses power (e.g. releasing a power latch) so
+// buffered names and log records reach flash
+void trackerShutdown() {
+  flushTagNames(true);
+  if (readingLog.ready()) readingLog.commit();
+}
+
+// ========================================
+// Presence engine
+// ========================================
+// Entering is decided on reads; leaving on a read (RSSI) or by the tag's
+// expiry timer. The timer is not moved on every read: when it fires early
+// it is set again from lastSeen, so a steady tag costs one wheel operation
+// per exit timeout instead of one per read.
+static void setPresence(int record, bool present, uint32_t now) {
+  TagInfo& tag = tagDatabase[record];
+  tag.enterCount = 0;
+  if (present) {
+    tag.flags |= TAG_FLAG_PRESENT;
+    presentCount++;
+    presenceEnters++;
+    presenceWheel.schedule(record, tag.lastSeen + presenceConfig.exitTimeoutMs);
+  } else {
+    tag.flags &= ~TAG_FLAG_PRESENT;
+    presentCount--;
+    presenceLeaves++;
+    presenceWheel.cancel(record);
+  }
+  touchTag(record);
+  if (eventHub.active()) {
+    pushEvent(present ? "enter" : "leave", [record, now](JsonStream& out) {
+      const TagInfo& t = tagDatabase[record];
+      out.key("no").num(record + 1);
+      out.key("epc").hex(t.epc, EPC_LEN);
+      out.key("name").str(tagNameFor(t.nameSlot));
+      out.key("time").num(now - systemStartTime);
+    });
+  }
+}
+
+void presenceOnRead(int record, uint32_t now) {
+  TagInfo& tag = tagDatabase[record];
+  if (tag.flags & TAG_FLAG_PRESENT) {
+    if (tag.stats.rssiAvg < presenceConfig.exitRssi) setPresence(record, false, now);
+    return;
+  }
+  if (tag.enterCount == 0 || now - tag.enterStart > presenceConfig.enterWindowMs) {
+    tag.enterCount = 0;
+    tag.enterStart = now;
+  }
+  if (tag.enterCount < 255) tag.enterCount++;
+  if (tag.enterCount >= presenceConfig.enterReads && tag.stats.rssiAvg >= presenceConfig.enterRssi) {
+    setPresence(record, true, now);
+  }
+}
+
+void presenceExpired(uint16_t record, uint32_t now) {
+  const TagInfo& tag = tagDatabase[record];
+  if (!(tag.flags & TAG_FLAG_PRESENT)) return;
+  if (now - tag.lastSeen >= presenceConfig.exitTimeoutMs) {
+    setPresence(record, false, now);
+  } else {
+    presenceWheel.schedule(record, tag.lastSeen + presenceConfig.exitTimeoutMs);
+  }
+}
+
+// A record about to be reused (eviction) - no event, the tag is gone anyway
+void presenceForget(int record) {
+  if (tagDatabase[record].flags & TAG_FLAG_PRESENT) presentCount--;
+  tagDatabase[record].flags &= ~TAG_FLAG_PRESENT;
+  presenceWheel.cancel(record);
+}
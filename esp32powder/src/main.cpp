@@ -2,414 +2,249 @@
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
+#include <LittleFS.h>
 #include <ESPmDNS.h>
+#include <driver/uart.h>
+#include <nvs.h>
+#include <esp_system.h>
 
 #include "config.h"
-#include "commands.h"
+#include "tracker.h"
 #include "html.h"
+#include "html_gz.h"
 
 WebServer server(WEB_SERVER_PORT);
 Preferences preferences;
 
-// Global state
-bool isScanning = false;
-int currentPower = DEFAULT_POWER;
-String lastTagEPC = "No tags detected yet";
-int tagCount = 0;
-unsigned long lastTagTime = 0;
-
-// Buffer
-byte rxBuffer[BUFFER_SIZE];
-int bufferIndex = 0;
-
-// Registration mode
-bool registrationMode = false;
-String registrationEPC = "";
-int registrationConfirmCount = 0;
-#define REGISTRATION_CONFIRM_THRESHOLD 5
-
-// Programming mode
-bool programmingMode = false;
-String programmingEPC = "";
-int programmingConfirmCount = 0;
-bool programmingWriteComplete = false;
-int verifyAttempts = 0;
-
-// Tag database
-struct TagInfo {
-  String epc;
-  String pc;
-  String crc;
-  int rssi;
-  int readCount;
-  int antenna;
-  unsigned long lastSeen;
-  String friendlyName;
-};
-
-#define MAX_UNIQUE_TAGS 50
-TagInfo tagDatabase[MAX_UNIQUE_TAGS];
-int tagDatabaseCount = 0;
+// ========================================
+// Board bindings for the tracker core
+// ========================================
+uint32_t platformMillis() { return millis(); }
+uint32_t platformMicros() { return micros(); }
 
-// Reading history
-struct ReadingHistory {
-  unsigned long timestamp;
-  String epc;
-  String bottleName;
-  int rssi;
-  String datetime;
-};
+void platformLog(const char* fmt, ...) {
+  char line[256];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  Serial.print(line);
+}
 
-#define MAX_HISTORY 1000
-ReadingHistory readingHistory[MAX_HISTORY];
-int historyCount = 0;
-unsigned long systemStartTime = 0;
+void* platformAllocLarge(size_t bytes) {
+  if (psramFound()) {
+    void* p = ps_malloc(bytes);
+    if (p) return p;
+  }
+  return malloc(bytes);
+}
 
-// Timestamp helper
-String getTimestamp() {
-  unsigned long elapsed = millis() - systemStartTime;
-  unsigned long seconds = elapsed / 1000;
-  unsigned long minutes = seconds / 60;
-  unsigned long hours = minutes / 60;
-  seconds = seconds % 60;
-  minutes = minutes % 60;
-  
-  char timestamp[20];
-  sprintf(timestamp, "%02lu:%02lu:%02lu", hours, minutes, seconds);
-  return String(timestamp);
+void platformMemory(PlatformMemory& out) {
+  out.freeHeap = ESP.getFreeHeap();
+  out.minFreeHeap = ESP.getMinFreeHeap();
+  out.largestFreeBlock = ESP.getMaxAllocHeap();
+  out.psramSize = psramFound() ? ESP.getPsramSize() : 0;
+  out.psramFree = psramFound() ? ESP.getFreePsram() : 0;
 }
 
-// Tag name management
-void saveTagName(String epc, String name) {
-  preferences.begin("rfid", false);
-  String key = "name_" + epc.substring(0, 8);
-  preferences.putString(key.c_str(), epc + "|" + name);
-  preferences.end();
-  Serial.println("Saved: " + epc + " -> " + name);
+// Half the free PSRAM, or a quarter of the largest internal heap block
+uint32_t historyCapacityForBoard() {
+  size_t budget = psramFound() ? ESP.getFreePsram() / 2 : ESP.getMaxAllocHeap() / 4;
+  uint32_t records = budget / sizeof(ReadingHistory);
+  if (records < HISTORY_MIN_RECORDS) records = HISTORY_MIN_RECORDS;
+  if (records > HISTORY_MAX_RECORDS) records = HISTORY_MAX_RECORDS;
+  return records;
 }
 
-String getTagName(String epc) {
-  preferences.begin("rfid", true);
-  String key = "name_" + epc.substring(0, 8);
-  String stored = preferences.getString(key.c_str(), "");
-  preferences.end();
-  
-  if (stored.length() > 0 && stored.startsWith(epc)) {
-    int separator = stored.indexOf('|');
-    if (separator > 0) {
-      return stored.substring(separator + 1);
-    }
+// R200 on UART2 through the IDF driver, so the ingest task can block on
+// its event queue. read()/available() are only used before the task starts.
+#define R200_UART UART_NUM_2
+
+QueueHandle_t r200UartEvents = nullptr;
+
+class UartReaderPort : public ReaderPort {
+public:
+  int available() override {
+    size_t buffered = 0;
+    uart_get_buffered_data_len(R200_UART, &buffered);
+    return (int)buffered;
   }
-  return "";
-}
+  int read() override {
+    uint8_t b;
+    return uart_read_bytes(R200_UART, &b, 1, 0) == 1 ? b : -1;
+  }
+  size_t write(const uint8_t* data, size_t len) override {
+    int written = uart_write_bytes(R200_UART, data, len);
+    return written < 0 ? 0 : (size_t)written;
+  }
+};
 
-// Process tag packet
-void processTagPacket() {
-  byte rssi_raw = rxBuffer[5];
-  int rssi_dbm = (int)rssi_raw - 256;
-  
-  String pc = "";
-  if (rxBuffer[6] < 0x10) pc += "0";
-  pc += String(rxBuffer[6], HEX);
-  if (rxBuffer[7] < 0x10) pc += "0";
-  pc += String(rxBuffer[7], HEX);
-  pc.toUpperCase();
-  
-  String epc = "";
-  for (int i = 8; i < 20; i++) {
-    if (rxBuffer[i] < 0x10) epc += "0";
-    epc += String(rxBuffer[i], HEX);
+class PreferencesStore : public KeyValueStore {
+public:
+  explicit PreferencesStore(Preferences& prefs) : prefs(prefs), batching(false) {}
+  std::string getString(const char* key) override {
+    open(true);
+    String value = prefs.getString(key, "");
+    close();
+    return std::string(value.c_str());
   }
-  epc.toUpperCase();
-  
-  // CRC (might not exist in 20-byte packets)
-  String crc = "";
-  if (bufferIndex >= 24) {
-    if (rxBuffer[20] < 0x10) crc += "0";
-    crc += String(rxBuffer[20], HEX);
-    if (rxBuffer[21] < 0x10) crc += "0";
-    crc += String(rxBuffer[21], HEX);
-    crc.toUpperCase();
-  } else {
-    crc = "N/A";
+  void putString(const char* key, const std::string& value) override {
+    open(false);
+    prefs.putString(key, value.c_str());
+    close();
   }
-  
-  // Registration mode
-  if (registrationMode) {
-    if (registrationEPC == "") {
-      registrationEPC = epc;
-      registrationConfirmCount = 1;
-    } else if (registrationEPC == epc) {
-      registrationConfirmCount++;
-      if (registrationConfirmCount >= REGISTRATION_CONFIRM_THRESHOLD) {
-        Serial.println(">>> READY FOR NAMING <<<");
-      }
-    } else {
-      registrationEPC = epc;
-      registrationConfirmCount = 1;
-    }
-    return;
+  void remove(const char* key) override {
+    open(false);
+    prefs.remove(key);
+    close();
   }
-  
-  // Programming mode
-  if (programmingMode) {
-    bool isBlank = true;
-    for (int i = 8; i < 20; i++) {
-      if (rxBuffer[i] != 0x00) {
-        isBlank = false;
-        break;
-      }
-    }
-    
-    if (isBlank && !programmingWriteComplete) {
-      programmingConfirmCount++;
-      if (programmingConfirmCount >= 3) {
-        Serial.println(">>> WRITING <<<");
-        stopMultiplePolling();
-        delay(500);
-        
-        while (Serial2.available()) Serial2.read();
-        bufferIndex = 0;
-        
-        writeEPC(programmingEPC);
-        delay(1000);
-        
-        while (Serial2.available()) Serial2.read();
-        bufferIndex = 0;
-        
-        programmingWriteComplete = true;
-        programmingConfirmCount = 0;
-        startMultiplePolling();
-        delay(300);
-      }
-    } else if (!isBlank && programmingWriteComplete) {
-      if (epc == programmingEPC) {
-        Serial.println(">>> SUCCESS! <<<");
-        programmingMode = false;
-        programmingWriteComplete = false;
-        programmingConfirmCount = 0;
-        verifyAttempts = 0;
-      } else {
-        verifyAttempts++;
-        if (verifyAttempts > 8) {
-          Serial.println(">>> FAILED <<<");
-          programmingMode = false;
-          programmingWriteComplete = false;
-          verifyAttempts = 0;
-        }
+  void forEachString(const char* prefix, void (*visit)(const char* key, const std::string& value)) override {
+    size_t prefixLen = strlen(prefix);
+    open(true);
+    nvs_iterator_t it = nvs_entry_find("nvs", "rfid", NVS_TYPE_STR);
+    while (it != nullptr) {
+      nvs_entry_info_t info;
+      nvs_entry_info(it, &info);
+      if (strncmp(info.key, prefix, prefixLen) == 0) {
+        String value = prefs.getString(info.key, "");
+        visit(info.key, std::string(value.c_str()));
       }
+      it = nvs_entry_next(it);
     }
-    return;
+    close();
   }
-  
-  // Normal mode - update database
-  int tagIndex = -1;
-  for (int i = 0; i < tagDatabaseCount; i++) {
-    if (tagDatabase[i].epc == epc) {
-      tagIndex = i;
-      break;
-    }
+  // One open handle for the whole batch; Preferences commits on end()
+  void beginBatch() override {
+    prefs.begin("rfid", false);
+    batching = true;
   }
-  
-  if (tagIndex == -1) {
-    if (tagDatabaseCount < MAX_UNIQUE_TAGS) {
-      tagDatabase[tagDatabaseCount].epc = epc;
-      tagDatabase[tagDatabaseCount].pc = pc;
-      tagDatabase[tagDatabaseCount].crc = crc;
-      tagDatabase[tagDatabaseCount].rssi = rssi_dbm;
-      tagDatabase[tagDatabaseCount].readCount = 1;
-      tagDatabase[tagDatabaseCount].antenna = 1;
-      tagDatabase[tagDatabaseCount].lastSeen = millis();
-      tagDatabase[tagDatabaseCount].friendlyName = getTagName(epc);
-      tagDatabaseCount++;
-    }
-  } else {
-    tagDatabase[tagIndex].rssi = rssi_dbm;
-    tagDatabase[tagIndex].readCount++;
-    tagDatabase[tagIndex].lastSeen = millis();
+  void endBatch() override {
+    batching = false;
+    prefs.end();
   }
-  
-  if (historyCount < MAX_HISTORY) {
-    readingHistory[historyCount].timestamp = millis();
-    readingHistory[historyCount].epc = epc;
-    readingHistory[historyCount].bottleName = (tagIndex >= 0) ? tagDatabase[tagIndex].friendlyName : "";
-    readingHistory[historyCount].rssi = rssi_dbm;
-    readingHistory[historyCount].datetime = getTimestamp();
-    historyCount++;
-  }
-  
-  tagCount = tagDatabaseCount;
-  lastTagEPC = epc;
-  lastTagTime = millis();
-}
+private:
+  Preferences& prefs;
+  bool batching;
 
-// Web handlers
-void handleRoot() {
-  server.send(200, "text/html", HTML_PAGE);
-}
-
-void handleStatus() {
-  String json = "{";
-  json += "\"scanning\":" + String(isScanning ? "true" : "false") + ",";
-  json += "\"tagCount\":" + String(tagCount) + ",";
-  json += "\"power\":" + String(currentPower) + ",";
-  json += "\"lastTag\":\"" + lastTagEPC + "\",";
-  json += "\"registrationMode\":" + String(registrationMode ? "true" : "false") + ",";
-  json += "\"registrationEPC\":\"" + registrationEPC + "\",";
-  json += "\"registrationProgress\":" + String(registrationConfirmCount) + ",";
-  json += "\"historyCount\":" + String(historyCount) + ",";
-  json += "\"programmingMode\":" + String(programmingMode ? "true" : "false") + ",";
-  json += "\"programmingEPC\":\"" + programmingEPC + "\",";
-  json += "\"programmingProgress\":" + String(programmingConfirmCount) + ",";
-  json += "\"programmingComplete\":" + String(programmingWriteComplete ? "true" : "false") + ",";
-  
-  json += "\"tags\":[";
-  for (int i = 0; i < tagDatabaseCount; i++) {
-    if (i > 0) json += ",";
-    json += "{";
-    json += "\"no\":" + String(i + 1) + ",";
-    json += "\"pc\":\"" + tagDatabase[i].pc + "\",";
-    json += "\"epc\":\"" + tagDatabase[i].epc + "\",";
-    json += "\"crc\":\"" + tagDatabase[i].crc + "\",";
-    json += "\"rssi\":" + String(tagDatabase[i].rssi) + ",";
-    json += "\"cnt\":" + String(tagDatabase[i].readCount) + ",";
-    json += "\"ant\":" + String(tagDatabase[i].antenna) + ",";
-    json += "\"name\":\"" + tagDatabase[i].friendlyName + "\"";
-    json += "}";
+  void open(bool readOnly) {
+    if (!batching) prefs.begin("rfid", readOnly);
   }
-  json += "]";
-  json += "}";
-  
-  server.send(200, "application/json", json);
-}
-
-void handleHistory() {
-  String json = "{\"count\":" + String(historyCount) + ",\"readings\":[";
-  for (int i = 0; i < historyCount; i++) {
-    if (i > 0) json += ",";
-    json += "{";
-    json += "\"time\":\"" + readingHistory[i].datetime + "\",";
-    json += "\"epc\":\"" + readingHistory[i].epc + "\",";
-    json += "\"name\":\"" + readingHistory[i].bottleName + "\",";
-    json += "\"rssi\":" + String(readingHistory[i].rssi);
-    json += "}";
+  void close() {
+    if (!batching) prefs.end();
   }
-  json += "]}";
-  server.send(200, "application/json", json);
-}
-
-void handleStart() {
-  isScanning = true;
-  startMultiplePolling();
-  server.send(200, "text/plain", "OK");
-}
-
-void handleStop() {
-  isScanning = false;
-  stopMultiplePolling();
-  delay(100);
-  while (Serial2.available()) Serial2.read();
-  bufferIndex = 0;
-  server.send(200, "text/plain", "OK");
-}
+};
 
-void handlePower() {
-  if (server.hasArg("value")) {
-    int power = server.arg("value").toInt();
-    currentPower = power;
-    setPower(power);
-    server.send(200, "text/plain", "OK");
-  } else {
-    server.send(400, "text/plain", "Missing power");
+// Reading log segments on LittleFS. Files are opened per call; appends come
+// in groups, so the open/close cost is spread over a whole commit.
+class LittleFSFileStore : public FileStore {
+public:
+  bool append(const char* path, const uint8_t* data, size_t len) override {
+    File file = LittleFS.open(path, FILE_APPEND);
+    if (!file) return false;
+    size_t written = file.write(data, len);
+    file.close();
+    return written == len;
   }
-}
-
-void handleClear() {
-  tagDatabaseCount = 0;
-  tagCount = 0;
-  historyCount = 0;
-  systemStartTime = millis();
-  lastTagEPC = "No tags detected yet";
-  Serial.println("Cleared!");
-  server.send(200, "text/plain", "OK");
-}
+  size_t read(const char* path, uint32_t offset, uint8_t* data, size_t len) override {
+    File file = LittleFS.open(path, FILE_READ);
+    if (!file) return 0;
+    size_t got = file.seek(offset) ? file.read(data, len) : 0;
+    file.close();
+    return got;
+  }
+  bool remove(const char* path) override { return LittleFS.remove(path); }
+  void list(const char* dir, void (*visit)(void* context, const char* name, uint32_t size),
+            void* context) override {
+    File root = LittleFS.open(dir);
+    if (!root || !root.isDirectory()) return;
+    for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+      if (!file.isDirectory()) visit(context, file.name(), file.size());
+    }
+  }
+};
 
-void handleRegisterStart() {
-  registrationMode = true;
-  registrationEPC = "";
-  registrationConfirmCount = 0;
-  
-  if (!isScanning) {
-    isScanning = true;
-    startMultiplePolling();
+// Event-stream client kept after its request returns. WiFiClient copies
+// share the socket, so holding one keeps the connection open.
+class WiFiEventChannel : public EventChannel {
+public:
+  WiFiEventChannel() : open(false) {}
+  bool inUse() const { return open; }
+  void attach(const WiFiClient& c) {
+    client = c;
+    client.setNoDelay(true);  // events are small; don't let Nagle hold them
+    open = true;
   }
-  
-  Serial.println(">>> REGISTRATION MODE <<<");
-  server.send(200, "text/plain", "OK");
-}
+  bool connected() override { return open && client.connected(); }
+  size_t write(const char* data, size_t len) override { return client.write((const uint8_t*)data, len); }
+  void close() override {
+    client.stop();
+    open = false;
+  }
+private:
+  WiFiClient client;
+  bool open;
+};
 
-void handleRegisterCancel() {
-  registrationMode = false;
-  registrationEPC = "";
-  registrationConfirmCount = 0;
-  server.send(200, "text/plain", "OK");
-}
+WiFiEventChannel eventChannels[EVENT_MAX_CHANNELS];
 
-void handleRegisterConfirm() {
-  if (!server.hasArg("name") || !server.hasArg("epc")) {
-    server.send(400, "text/plain", "Missing data");
-    return;
+class WebServerRequest : public HttpRequest {
+public:
+  explicit WebServerRequest(WebServer& server) : server(server) {}
+  bool hasArg(const char* name) override { return server.hasArg(name); }
+  std::string arg(const char* name) override { return std::string(server.arg(name).c_str()); }
+  void send(int code, const char* contentType, const std::string& body) override {
+    server.send(code, contentType, body.c_str());
   }
-  
-  String name = server.arg("name");
-  String epc = server.arg("epc");
-  
-  saveTagName(epc, name);
-  
-  for (int i = 0; i < tagDatabaseCount; i++) {
-    if (tagDatabase[i].epc == epc) {
-      tagDatabase[i].friendlyName = name;
-      break;
+  void beginChunked(int code, const char* contentType) override {
+    // Unknown length on an HTTP/1.1 request makes WebServer use chunked encoding
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(code, contentType, "");
+  }
+  void sendChunk(const char* data, size_t len) override { server.sendContent(data, len); }
+  void endChunked() override { server.sendContent(""); }
+  EventChannel* openEventStream() override {
+    static const char headers[] =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n\r\n";
+    for (WiFiEventChannel& channel : eventChannels) {
+      if (channel.inUse()) continue;
+      WiFiClient client = server.client();
+      client.write((const uint8_t*)headers, sizeof(headers) - 1);
+      channel.attach(client);
+      return &channel;
     }
+    return nullptr;
   }
-  
-  registrationMode = false;
-  registrationEPC = "";
-  registrationConfirmCount = 0;
-  
-  Serial.println("✓ Registered: " + name);
-  server.send(200, "text/plain", "OK");
-}
+private:
+  WebServer& server;
+};
+
+UartReaderPort r200Uart;
+PreferencesStore nvsStore(preferences);
+LittleFSFileStore logFiles;
+WebServerRequest httpRequest(server);
 
-void handleProgramStart() {
-  if (!server.hasArg("epc")) {
-    server.send(400, "text/plain", "Missing EPC");
+// Web handlers
+// Dashboard: gzipped copy from flash, revalidated by ETag on every load.
+// The plain page is another representation, so it gets its own ETag.
+void handleRoot(HttpRequest&) {
+  bool gzip = server.header("Accept-Encoding").indexOf("gzip") >= 0;
+  const char* etag = gzip ? HTML_PAGE_ETAG : HTML_PAGE_ID_ETAG;
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Vary", "Accept-Encoding");
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
     return;
   }
-  
-  programmingEPC = server.arg("epc");
-  programmingEPC.toUpperCase();
-  programmingMode = true;
-  programmingConfirmCount = 0;
-  programmingWriteComplete = false;
-  verifyAttempts = 0;
-  
-  if (!isScanning) {
-    isScanning = true;
-    startMultiplePolling();
+  if (!gzip) {
+    server.send(200, "text/html", HTML_PAGE);
+    return;
   }
-  
-  Serial.println(">>> PROGRAMMING MODE <<<");
-  server.send(200, "text/plain", "OK");
-}
-
-void handleProgramCancel() {
-  programmingMode = false;
-  programmingEPC = "";
-  programmingConfirmCount = 0;
-  programmingWriteComplete = false;
-  verifyAttempts = 0;
-  server.send(200, "text/plain", "OK");
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (const char*)HTML_PAGE_GZ, HTML_PAGE_GZ_LEN);
 }
 
 // ========================================
@@ -488,47 +323,140 @@ void setupWiFi() {
   // }
 }
 
+// Every route goes through here so /api/metrics can count its requests and
+// time its handler
+void route(const char* uri, void (*handler)(HttpRequest&)) {
+  int endpoint = metricsEndpoint(uri);
+  server.on(uri, [endpoint, handler]() {
+    uint32_t started = micros();
+    handler(httpRequest);
+    metricsRequestDone(endpoint, micros() - started);
+  });
+}
+
 void setupWebServer() {
   Serial.println("\n--- Web Server ---");
   
-  server.on("/", handleRoot);
-  server.on("/api/status", handleStatus);
-  server.on("/api/history", handleHistory);
-  server.on("/api/start", handleStart);
-  server.on("/api/stop", handleStop);
-  server.on("/api/power", handlePower);
-  server.on("/api/clear", handleClear);
-  server.on("/api/register/start", handleRegisterStart);
-  server.on("/api/register/cancel", handleRegisterCancel);
-  server.on("/api/register/confirm", handleRegisterConfirm);
-  server.on("/api/program/start", handleProgramStart);
-  server.on("/api/program/cancel", handleProgramCancel);
+  static const char* requestHeaders[] = {"If-None-Match", "Accept-Encoding"};
+  server.collectHeaders(requestHeaders, 2);
+  route("/", handleRoot);
+  route("/api/status", handleStatus);
+  route("/api/history", handleHistory);
+  route("/api/history.csv", handleHistoryCsv);
+  route("/api/events", handleEvents);
+  route("/api/start", handleStart);
+  route("/api/stop", handleStop);
+  route("/api/power", handlePower);
+  route("/api/mode", handleMode);
+  route("/api/clear", handleClear);
+  route("/api/presence", handlePresence);
+  route("/api/select", handleSelect);
+  route("/api/query", handleQuery);
+  route("/api/rf", handleRf);
+  route("/api/sweep", handleSweep);
+  route("/api/power/control", handlePowerControl);
+  route("/api/metrics", handleMetrics);
+  route("/api/register/start", handleRegisterStart);
+  route("/api/register/cancel", handleRegisterCancel);
+  route("/api/register/confirm", handleRegisterConfirm);
+  route("/api/program/start", handleProgramStart);
+  route("/api/program/cancel", handleProgramCancel);
   
   server.begin();
   Serial.println("✓ Server started on port " + String(WEB_SERVER_PORT));
   Serial.println("Access at: http://" + WiFi.localIP().toString());
 }
 
+// Producer side of the ingest queue: wakes on UART events, parses and queues
+// frames. When the app core falls behind it waits for queue space and lets
+// the 16 KB driver ring absorb the traffic instead of dropping reads.
+void r200IngestTask(void*) {
+  uint8_t chunk[256];
+  uart_event_t event;
+  for (;;) {
+    if (xQueueReceive(r200UartEvents, &event, portMAX_DELAY) != pdTRUE) continue;
+    switch (event.type) {
+      case UART_DATA: {
+        size_t buffered = 0;
+        uart_get_buffered_data_len(R200_UART, &buffered);
+        if (buffered > ingestStats.uartRxHighWater.load()) ingestStats.uartRxHighWater.store(buffered);
+        while (buffered > 0) {
+          int n = uart_read_bytes(R200_UART, chunk, buffered < sizeof(chunk) ? buffered : sizeof(chunk), 0);
+          if (n <= 0) break;
+          for (int i = 0; i < n; i++) {
+            while (ingestQueue.full()) {
+              ingestStats.queueStalls++;
+              vTaskDelay(1);
+            }
+            ingestByte(chunk[i]);
+          }
+          buffered -= n;
+        }
+        ingestPublishStats();
+        break;
+      }
+      case UART_FIFO_OVF:
+      case UART_BUFFER_FULL: {
+        // Bytes are already lost; start clean
+        size_t drained = 0;
+        uart_get_buffered_data_len(R200_UART, &drained);
+        ingestStats.uartOverflows++;
+        ingestStats.uartDrained += drained;
+        uart_flush_input(R200_UART);
+        xQueueReset(r200UartEvents);
+        r200Parser.reset();
+        ingestPublishStats();
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
 void setupR200() {
   Serial.println("\n--- R200 Setup ---");
   
-  Serial2.begin(R200_BAUD, SERIAL_8N1, R200_RX_PIN, R200_TX_PIN);
+  uart_config_t uartConfig = {};
+  uartConfig.baud_rate = R200_BAUD;
+  uartConfig.data_bits = UART_DATA_8_BITS;
+  uartConfig.parity = UART_PARITY_DISABLE;
+  uartConfig.stop_bits = UART_STOP_BITS_1;
+  uartConfig.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  uart_driver_install(R200_UART, R200_UART_RX_RING, R200_UART_TX_RING, R200_UART_EVENT_QUEUE,
+                      &r200UartEvents, 0);
+  uart_param_config(R200_UART, &uartConfig);
+  uart_set_pin(R200_UART, R200_TX_PIN, R200_RX_PIN, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
   delay(500);
-  while (Serial2.available()) Serial2.read();
+  flushReader();
+
+  // From here on only the ingest task reads the UART
+  ingestOnOwnTask = true;
+  xTaskCreatePinnedToCore(r200IngestTask, "r200-ingest", INGEST_TASK_STACK, nullptr,
+                          INGEST_TASK_PRIORITY, nullptr, INGEST_TASK_CORE);
   
-  getHardwareVersion();
-  delay(300);
-  getSoftwareVersion();
-  delay(300);
-  setPower(currentPower);
-  delay(300);
+  // Queued; sent and answered from loop()
+  readerSetup();
   
   Serial.println("✓ R200 ready");
 }
 
 void setup() {
   Serial.begin(115200);
-  systemStartTime = millis();
+  tagFullPolicy = TAG_FULL_POLICY;
+  trackerBegin(r200Uart, nvsStore, DEFAULT_POWER,
+               psramFound() ? TAG_CAPACITY_PSRAM : TAG_CAPACITY_INTERNAL,
+               historyCapacityForBoard());
+  // Formats the data partition on first boot
+  if (LittleFS.begin(true)) {
+    if (!LittleFS.exists(LOG_DIR)) LittleFS.mkdir(LOG_DIR);
+    trackerBeginLog(logFiles, READING_LOG_SEGMENTS);
+  } else {
+    Serial.println("✗ LittleFS mount failed - reads are not logged to flash");
+  }
+  // Software restarts flush on the way down; cutting the power does not,
+  // so stop the scan (/api/stop) before releasing the latch
+  esp_register_shutdown_handler(trackerShutdown);
   delay(2000);
   
   Serial.println("\n\n");
@@ -552,41 +480,11 @@ void setup() {
 }
 
 void loop() {
+  uint32_t started = micros();
   server.handleClient();
   
-  // Process incoming data
-  while (Serial2.available()) {
-    byte b = Serial2.read();
-    
-    if (bufferIndex < BUFFER_SIZE) {
-      rxBuffer[bufferIndex++] = b;
-    } else {
-      bufferIndex = 0;
-      break;
-    }
-    
-    if (b == 0xDD && bufferIndex > 2 && rxBuffer[0] == 0xAA) {
-      
-      // Silently skip error packets
-      if (bufferIndex == 8 && rxBuffer[1] == 0x01 && rxBuffer[2] == 0xFF) {
-        bufferIndex = 0;
-        continue;
-      }
-      
-      // Process tag packets (20 or 24 bytes)
-      if ((bufferIndex == 20 || bufferIndex >= 24) && rxBuffer[1] == 0x02 && rxBuffer[2] == 0x22) {
-        processTagPacket();
-      }
-      
-      bufferIndex = 0;
-    }
-  }
-  
-  // Emergency drain
-  if (Serial2.available() > 300) {
-    while (Serial2.available()) Serial2.read();
-    bufferIndex = 0;
-  }
+  trackerPoll();
+  eventsPoll();
   
   // WiFi watchdog
   static unsigned long lastWiFiCheck = 0;
@@ -597,4 +495,5 @@ void loop() {
     }
     lastWiFiCheck = millis();
   }
+  loopLatency.observe(micros() - started);
 }
\ No newline at end of file
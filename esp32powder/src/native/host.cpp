@@ -0,0 +1,32 @@
+// Host bindings for the tracker core; see host.h
+
+#include <chrono>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+uint32_t simMillis = 0;
+bool verbose = false;
+
+uint32_t platformMillis() { return simMillis; }
+
+void platformLog(const char* fmt, ...) {
+  if (!verbose) return;
+  va_list args;
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+}
+
+uint32_t platformMicros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void* platformAllocLarge(size_t bytes) { return malloc(bytes); }
+
+// Host heap figures mean nothing for the board; report zeros
+void platformMemory(PlatformMemory& out) { memset(&out, 0, sizeof(out)); }
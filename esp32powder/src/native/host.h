@@ -0,0 +1,132 @@
+#ifndef HOST_H
+#define HOST_H
+
+// Host bindings for the tracker core and in-memory stand-ins for the board's
+// storage and web server, shared by the simulator driver (main.cpp) and the
+// unit tests in test/. The bindings are in host.cpp.
+
+#include <algorithm>
+#include <map>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "platform.h"
+
+// Simulated clock behind platformMillis(), advanced by the caller
+extern uint32_t simMillis;
+
+// Print the tracker's log output
+extern bool verbose;
+
+class MemoryStore : public KeyValueStore {
+public:
+  std::string getString(const char* key) override {
+    auto it = values.find(key);
+    return it == values.end() ? std::string() : it->second;
+  }
+  void putString(const char* key, const std::string& value) override {
+    values[key] = value;
+    writes++;
+  }
+  void remove(const char* key) override { values.erase(key); }
+  void forEachString(const char* prefix, void (*visit)(const char* key, const std::string& value)) override {
+    std::string p(prefix);
+    for (auto it = values.lower_bound(p); it != values.end() && it->first.compare(0, p.size(), p) == 0; ++it) {
+      visit(it->first.c_str(), it->second);
+    }
+  }
+  size_t writes = 0;
+private:
+  std::map<std::string, std::string> values;
+};
+
+// Reading log files held in memory, counting flash-side work
+class MemoryFileStore : public FileStore {
+public:
+  bool append(const char* path, const uint8_t* data, size_t len) override {
+    std::vector<uint8_t>& file = files[path];
+    file.insert(file.end(), data, data + len);
+    appends++;
+    return true;
+  }
+  size_t read(const char* path, uint32_t offset, uint8_t* data, size_t len) override {
+    auto it = files.find(path);
+    if (it == files.end() || offset >= it->second.size()) return 0;
+    size_t n = std::min(len, it->second.size() - offset);
+    memcpy(data, it->second.data() + offset, n);
+    reads++;
+    return n;
+  }
+  bool remove(const char* path) override { return files.erase(path) > 0; }
+  void list(const char* dir, void (*visit)(void* context, const char* name, uint32_t size),
+            void* context) override {
+    std::string prefix = std::string(dir) + "/";
+    for (auto it = files.lower_bound(prefix); it != files.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+         ++it) {
+      visit(context, it->first.c_str() + prefix.size(), (uint32_t)it->second.size());
+    }
+  }
+  std::map<std::string, std::vector<uint8_t>> files;
+  size_t appends = 0;
+  size_t reads = 0;
+};
+
+// Event-stream client that only counts what it is sent
+class CountingChannel : public EventChannel {
+public:
+  bool open = false;
+  size_t bytes = 0;
+  uint32_t writes = 0;
+  bool connected() override { return open; }
+  size_t write(const char*, size_t len) override {
+    bytes += len;
+    writes++;
+    return len;
+  }
+  void close() override { open = false; }
+};
+
+// Request with preset arguments; counts the response, and keeps it when
+// keepBody is set
+class CaptureRequest : public HttpRequest {
+public:
+  std::map<std::string, std::string> args;
+  CountingChannel* eventChannel = nullptr;
+  bool keepBody = false;
+  std::string body;
+  int code = 0;
+  size_t bytes = 0;
+  uint32_t chunks = 0;
+  size_t largestChunk = 0;
+  bool hasArg(const char* name) override { return args.count(name) > 0; }
+  std::string arg(const char* name) override { return hasArg(name) ? args[name] : std::string(); }
+  void send(int c, const char*, const std::string& content) override {
+    code = c;
+    bytes = content.size();
+    chunks = 0;
+    largestChunk = content.size();
+    if (keepBody) body = content;
+  }
+  void beginChunked(int c, const char*) override {
+    code = c;
+    bytes = 0;
+    chunks = 0;
+    largestChunk = 0;
+    body.clear();
+  }
+  void sendChunk(const char* data, size_t len) override {
+    bytes += len;
+    chunks++;
+    if (len > largestChunk) largestChunk = len;
+    if (keepBody) body.append(data, len);
+  }
+  void endChunked() override {}
+  EventChannel* openEventStream() override {
+    if (!eventChannel || eventChannel->open) return nullptr;
+    eventChannel->open = true;
+    return eventChannel;
+  }
+};
+
+#endif
@@ -0,0 +1,520 @@
+// Native (host) build of the powder tracker core.
+//
+//   pio run -e native
+//   .pio/build/native/program --tags 200 --seconds 60 --corrupt 0.01
+//
+// Runs the tracker against the simulated R200 on a simulated clock and
+// reports parser, database and JSON API throughput in host CPU time.
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// The unit tests link the core and host.cpp and bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+#include "config.h"
+#include "tracker.h"
+#include "host.h"
+#include "r200_simulator.h"
+
+// ========================================
+// Simulated link to the R200
+// ========================================
+class SimReaderPort : public ReaderPort {
+public:
+  explicit SimReaderPort(R200Simulator& sim) : sim(sim) {}
+  int available() override { return (int)(rx.size() - rxPos); }
+  int read() override {
+    if (rxPos >= rx.size()) return -1;
+    return rx[rxPos++];
+  }
+  size_t write(const uint8_t* data, size_t len) override {
+    sim.receive(data, len);
+    return len;
+  }
+  void advance(uint32_t ms) {
+    if (rxPos == rx.size()) {
+      rx.clear();
+      rxPos = 0;
+    }
+    sim.advance(ms, rx);
+  }
+private:
+  R200Simulator& sim;
+  std::vector<uint8_t> rx;
+  size_t rxPos = 0;
+};
+
+// ========================================
+// Benchmark driver
+// ========================================
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedUs(Clock::time_point since) {
+  return std::chrono::duration<double, std::micro>(Clock::now() - since).count();
+}
+
+// Lookup cost of the tag index against the old linear scan, for growing
+// populations in a table sized for the largest one
+static void benchIndex() {
+  const uint16_t sizes[] = {50, 250, 500, 1000, 2000, 4000};
+  const uint16_t capacity = 4096;
+  const int lookups = 200000;
+
+  std::vector<TagInfo> records(capacity);
+  std::vector<uint16_t> table(TagIndex::tableSizeFor(capacity));
+  std::mt19937 rng(7);
+
+  printf("%8s %14s %14s %14s\n", "tags", "index hit ns", "index miss ns", "linear hit ns");
+  for (uint16_t n : sizes) {
+    TagIndex index;
+    index.begin(records.data(), table.data(), table.size());
+    for (uint16_t i = 0; i < n; i++) {
+      for (int b = 0; b < EPC_LEN; b++) records[i].epc[b] = (uint8_t)rng();
+      index.insert(records[i].epc, i);
+    }
+
+    std::vector<uint8_t> missing(1024 * EPC_LEN);
+    for (size_t i = 0; i < missing.size(); i++) missing[i] = (uint8_t)rng();
+    long found = 0;
+    Clock::time_point t = Clock::now();
+    for (int i = 0; i < lookups; i++) found += index.find(records[rng() % n].epc);
+    double hitNs = elapsedUs(t) * 1000.0 / lookups;
+
+    t = Clock::now();
+    for (int i = 0; i < lookups; i++) found += index.find(&missing[(i % 1024) * EPC_LEN]);
+    double missNs = elapsedUs(t) * 1000.0 / lookups;
+
+    t = Clock::now();
+    for (int i = 0; i < lookups; i++) {
+      const uint8_t* epc = records[rng() % n].epc;
+      for (uint16_t r = 0; r < n; r++) {
+        if (epcEquals(records[r].epc, epc)) {
+          found += r;
+          break;
+        }
+      }
+    }
+    double linearNs = elapsedUs(t) * 1000.0 / lookups;
+
+    printf("%8u %14.1f %14.1f %14.1f\n", n, hitNs, missNs, linearNs);
+    if (found == 42) printf(" ");  // keep the lookups from being optimised away
+  }
+}
+
+static void usage() {
+  printf("options:\n"
+         "  --tags N        tag population (50)\n"
+         "  --rounds N      inventory rounds per second (40)\n"
+         "  --prob P        per-round read probability (0.8)\n"
+         "  --rssi DBM      population mean RSSI (-55)\n"
+         "  --spread DB     RSSI stddev between tags (8)\n"
+         "  --jitter DB     RSSI stddev between reads (3)\n"
+         "  --corrupt P     fraction of corrupted frames (0)\n"
+         "  --baud N        link speed, 0 = unlimited (115200)\n"
+         "  --capacity N    tag database capacity (4096)\n"
+         "  --history N     history ring capacity (100000)\n"
+         "  --evict         evict the stalest tag when full instead of rejecting\n"
+         "  --program       put a blank tag on the pad and program it after 1 s\n"
+         "  --names N       register N of the tags seen after 2 s, one per tick\n"
+         "  --leave N       take N tags out of the field half way through\n"
+         "  --mode M        reader mode: single, multiple (default) or controlled\n"
+         "  --duty ON/OFF   controlled-mode windows in ms (2000/1000)\n"
+         "  --foreign N     add N neighbouring tags with another EPC prefix (0)\n"
+         "  --foreign-rssi DBM  mean RSSI of the foreign tags (same as --rssi)\n"
+         "  --sensitivity DBM   replies weaker than this are lost (-100)\n"
+         "  --select HEX    EPC select prefix programmed into the reader\n"
+         "  --slotted       2^Q slots per round with collisions and session flags\n"
+         "  --q N           inventory Q (4)\n"
+         "  --session N     inventory session 0-3 (0)\n"
+         "  --auto-q        let auto-Q pick Q, starting from --q\n"
+         "  --sweep F:T:S:D TX power sweep from F to T centi-dBm in steps of S, D ms each\n"
+         "  --registered    register all --tags tags (not the foreign ones) before the run\n"
+         "  --power-control LOW:HIGH[:MIN:MAX]  closed-loop power with the weak tenth held in\n"
+         "                  LOW..HIGH dBm and, optionally, MIN..MAX tags\n"
+         "  --bench-index   benchmark tag index lookups and exit\n"
+         "  --seconds N     simulated run time (30)\n"
+         "  --seed N        random seed (1)\n"
+         "  --verbose       print tracker log output\n");
+}
+
+int main(int argc, char** argv) {
+  R200SimConfig cfg;
+  uint32_t seconds = 30;
+  uint16_t capacity = 4096;
+  uint32_t historyCapacity = 100000;
+  bool program = false;
+  uint32_t names = 0;
+  uint32_t leave = 0;
+  const char* mode = nullptr;
+  const char* duty = nullptr;
+  const char* select = nullptr;
+  const char* q = nullptr;
+  const char* session = nullptr;
+  bool autoQOn = false;
+  const char* sweep = nullptr;
+  bool registered = false;
+  const char* powerControlBand = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const char* opt = argv[i];
+    const char* val = (i + 1 < argc) ? argv[i + 1] : "0";
+    if (!strcmp(opt, "--tags")) { cfg.tagCount = atoi(val); i++; }
+    else if (!strcmp(opt, "--rounds")) { cfg.roundsPerSecond = atoi(val); i++; }
+    else if (!strcmp(opt, "--prob")) { cfg.readProbability = atof(val); i++; }
+    else if (!strcmp(opt, "--rssi")) { cfg.rssiMean = atoi(val); i++; }
+    else if (!strcmp(opt, "--spread")) { cfg.rssiSpread = atoi(val); i++; }
+    else if (!strcmp(opt, "--jitter")) { cfg.rssiJitter = atoi(val); i++; }
+    else if (!strcmp(opt, "--corrupt")) { cfg.corruptRate = atof(val); i++; }
+    else if (!strcmp(opt, "--baud")) { cfg.baud = atoi(val); i++; }
+    else if (!strcmp(opt, "--capacity")) { capacity = atoi(val); i++; }
+    else if (!strcmp(opt, "--history")) { historyCapacity = atoi(val); i++; }
+    else if (!strcmp(opt, "--evict")) { tagFullPolicy = TAG_FULL_EVICT_STALEST; }
+    else if (!strcmp(opt, "--program")) { program = true; cfg.blankTags = 1; }
+    else if (!strcmp(opt, "--names")) { names = atoi(val); i++; }
+    else if (!strcmp(opt, "--leave")) { leave = atoi(val); i++; }
+    else if (!strcmp(opt, "--mode")) { mode = val; i++; }
+    else if (!strcmp(opt, "--duty")) { duty = val; i++; }
+    else if (!strcmp(opt, "--foreign")) { cfg.foreignTags = atoi(val); i++; }
+    else if (!strcmp(opt, "--foreign-rssi")) { cfg.foreignRssi = atoi(val); i++; }
+    else if (!strcmp(opt, "--sensitivity")) { cfg.sensitivity = atoi(val); i++; }
+    else if (!strcmp(opt, "--select")) { select = val; i++; }
+    else if (!strcmp(opt, "--slotted")) { cfg.slotted = true; }
+    else if (!strcmp(opt, "--q")) { q = val; i++; }
+    else if (!strcmp(opt, "--session")) { session = val; i++; }
+    else if (!strcmp(opt, "--auto-q")) { autoQOn = true; }
+    else if (!strcmp(opt, "--sweep")) { sweep = val; i++; }
+    else if (!strcmp(opt, "--registered")) { registered = true; }
+    else if (!strcmp(opt, "--power-control")) { powerControlBand = val; i++; }
+    else if (!strcmp(opt, "--bench-index")) { benchIndex(); return 0; }
+    else if (!strcmp(opt, "--seconds")) { seconds = atoi(val); i++; }
+    else if (!strcmp(opt, "--seed")) { cfg.seed = atoi(val); i++; }
+    else if (!strcmp(opt, "--verbose")) { verbose = true; }
+    else { usage(); return 1; }
+  }
+
+  R200Simulator sim(cfg);
+  SimReaderPort port(sim);
+  MemoryStore store;
+  if (!trackerBegin(port, store, DEFAULT_POWER, capacity, historyCapacity)) return 1;
+  MemoryFileStore logFiles;
+  trackerBeginLog(logFiles, READING_LOG_SEGMENTS);
+
+  CaptureRequest req;
+  CountingChannel events;
+  req.eventChannel = &events;
+  handleEvents(req);
+  readerSetup();
+  if (select) {
+    CaptureRequest selectReq;
+    selectReq.args["prefix"] = select;
+    handleSelect(selectReq);
+  }
+  if (q || session || autoQOn) {
+    CaptureRequest queryReq;
+    if (q) queryReq.args["q"] = q;
+    if (session) queryReq.args["session"] = session;
+    if (autoQOn) queryReq.args["auto"] = "1";
+    handleQuery(queryReq);
+  }
+  if (mode || duty) {
+    CaptureRequest modeReq;
+    if (mode) modeReq.args["mode"] = mode;
+    if (duty) {
+      modeReq.args["on"] = std::to_string(atoi(duty));
+      if (strchr(duty, '/')) modeReq.args["off"] = strchr(duty, '/') + 1;
+    }
+    handleMode(modeReq);
+  }
+  for (uint32_t i = 0; registered && i < cfg.tagCount; i++) {
+    CaptureRequest reg;
+    reg.args["epc"] = toHex(sim.tagEpc(i), EPC_LEN);
+    reg.args["name"] = "Stock " + std::to_string(i);
+    handleRegisterConfirm(reg);
+  }
+  handleStart(req);
+  if (sweep) {
+    int from = 0, to = 0, step = 0, dwell = 0;
+    sscanf(sweep, "%d:%d:%d:%d", &from, &to, &step, &dwell);
+    CaptureRequest sweepReq;
+    sweepReq.args["start"] = "1";
+    sweepReq.args["from"] = std::to_string(from);
+    sweepReq.args["to"] = std::to_string(to);
+    sweepReq.args["step"] = std::to_string(step);
+    sweepReq.args["dwell"] = std::to_string(dwell);
+    handleSweep(sweepReq);
+    if (sweepReq.code != 200) printf("sweep rejected (%d)\n", sweepReq.code);
+  }
+  if (powerControlBand) {
+    int low = 0, high = 0, minTags = 0, maxTags = 0;
+    sscanf(powerControlBand, "%d:%d:%d:%d", &low, &high, &minTags, &maxTags);
+    CaptureRequest controlReq;
+    controlReq.args["enable"] = "1";
+    controlReq.args["lowRssi"] = std::to_string(low);
+    controlReq.args["highRssi"] = std::to_string(high);
+    controlReq.args["minTags"] = std::to_string(minTags);
+    controlReq.args["maxTags"] = std::to_string(maxTags);
+    handlePowerControl(controlReq);
+    if (controlReq.code != 200) printf("power control rejected (%d)\n", controlReq.code);
+  }
+
+  const uint32_t tickMs = 10;
+  double ingestUs = 0;
+  double eventsUs = 0;
+  double statusUs = 0;
+  uint32_t statusCalls = 0;
+  size_t statusBytes = 0;
+  size_t statusFullBytes = 0;
+  uint32_t statusSince = 0;
+  uint32_t leftAt = 0;
+  uint32_t leaveLatency = 0;
+  bool leftWaiting = false;
+  uint32_t allSeenAt = 0;
+  uint64_t distinctPerSecond = 0;
+  int statusEndpoint = metricsEndpoint("/api/status");
+
+  while (simMillis < seconds * 1000) {
+    port.advance(tickMs);
+    simMillis += tickMs;
+
+    // Removed tags still marked present; the last one to go gives the latency
+    if (leave > 0 && simMillis == seconds * 500) {
+      sim.removeTags(leave);
+      leftAt = simMillis;
+      leftWaiting = true;
+    }
+    if (leftWaiting) {
+      bool anyPresent = false;
+      for (uint32_t i = 0; i < sim.tagCount() && !anyPresent; i++) {
+        int record = sim.tagGone(i) ? tagIndex.find(sim.tagEpc(i)) : -1;
+        anyPresent = record >= 0 && (tagDatabase[record].flags & TAG_FLAG_PRESENT);
+      }
+      if (!anyPresent) {
+        leaveLatency = simMillis - leftAt;
+        leftWaiting = false;
+      }
+    }
+
+    if (program && simMillis == 1000) {
+      CaptureRequest start;
+      start.args["epc"] = "E2806915000000000000C0DE";
+      handleProgramStart(start);
+    }
+
+    // All the simulated EPCs share one 8-digit prefix, like a real batch
+    uint32_t nameIndex = (simMillis - 2000) / tickMs;
+    if (simMillis >= 2000 && nameIndex < names && (int)nameIndex < tagCount) {
+      CaptureRequest reg;
+      reg.args["epc"] = toHex(tagDatabase[nameIndex].epc, EPC_LEN);
+      reg.args["name"] = "Bottle " + std::to_string(nameIndex);
+      handleRegisterConfirm(reg);
+    }
+
+    uint32_t loopStarted = platformMicros();
+    Clock::time_point t = Clock::now();
+    trackerPoll();
+    ingestUs += elapsedUs(t);
+
+    t = Clock::now();
+    eventsPoll();
+    eventsUs += elapsedUs(t);
+    loopLatency.observe(platformMicros() - loopStarted);
+
+    if (!allSeenAt && tagDatabaseCount >= (int)cfg.tagCount) allSeenAt = simMillis;
+
+    // Dashboard poll, once per simulated second, asking only for changes
+    if (simMillis % 1000 == 0) {
+      for (int i = 0; i < tagDatabaseCount; i++) distinctPerSecond += simMillis - tagDatabase[i].lastSeen < 1000;
+      req.args["since"] = std::to_string(statusSince);
+      t = Clock::now();
+      handleStatus(req);
+      statusUs += elapsedUs(t);
+      metricsRequestDone(statusEndpoint, (uint32_t)elapsedUs(t));
+      if (statusSince != 0) statusBytes += req.bytes;
+      statusSince = statusSeq;
+      statusCalls++;
+    }
+  }
+
+  // Size of a full refresh with the final population
+  req.args.clear();
+  handleStatus(req);
+  statusFullBytes = req.bytes;
+
+  Clock::time_point t = Clock::now();
+  handleHistory(req);
+  double historyUs = elapsedUs(t);
+  size_t historyBytes = req.bytes;
+  uint32_t historyChunks = req.chunks;
+  size_t historyLargest = req.largestChunk;
+
+  req.args["location"] = "Level-1 \"Front\"";
+  t = Clock::now();
+  handleHistoryCsv(req);
+  double csvUs = elapsedUs(t);
+  size_t csvBytes = req.bytes;
+  uint32_t csvChunks = req.chunks;
+  req.args["source"] = "log";
+  t = Clock::now();
+  handleHistoryCsv(req);
+  double csvLogUs = elapsedUs(t);
+  size_t csvLogBytes = req.bytes;
+  // The second quarter of the run by log clock
+  uint32_t rangeFrom = readingLog.now() / 4;
+  uint32_t rangeTo = readingLog.now() / 2;
+  req.args["fromTime"] = std::to_string(rangeFrom);
+  req.args["toTime"] = std::to_string(rangeTo);
+  t = Clock::now();
+  handleHistoryCsv(req);
+  double csvRangeUs = elapsedUs(t);
+  size_t csvRangeBytes = req.bytes;
+
+  req.args.clear();
+  t = Clock::now();
+  handleMetrics(req);
+  double metricsUs = elapsedUs(t);
+
+  const R200SimStats& s = sim.getStats();
+  const R200ParserStats& p = r200Parser.getStats();
+
+  printf("simulated        %u s, %u tags, %u rounds/s, baud %u\n",
+         seconds, cfg.tagCount, cfg.roundsPerSecond, cfg.baud);
+  printf("reader           %llu frames (%llu corrupted, %llu over link budget), %llu bytes\n",
+         (unsigned long long)s.framesSent, (unsigned long long)s.framesCorrupted,
+         (unsigned long long)s.framesDroppedByLink, (unsigned long long)s.bytesSent);
+  printf("parser           %u frames, %u checksum errors, %u framing errors, %u bytes discarded\n",
+         p.frames, p.checksumErrors, p.framingErrors, p.bytesDiscarded);
+  printf("database         %d unique tags (capacity %d, %u rejected, %u evicted)\n",
+         tagDatabaseCount, tagCapacity, tagsRejected, tagsEvicted);
+  printf("history          %u records held (seq %u..%u), %u overwritten\n",
+         history.size(), history.firstSeq(), history.lastSeq(), history.droppedCount());
+  printf("records          TagInfo %zu bytes, ReadingHistory %zu bytes\n",
+         sizeof(TagInfo), sizeof(ReadingHistory));
+  printf("ingest           %.0f us total, %.3f us/frame, %.0f frames/s of host CPU\n",
+         ingestUs, p.frames ? ingestUs / p.frames : 0.0, ingestUs > 0 ? p.frames / (ingestUs / 1e6) : 0.0);
+  printf("/api/status      %u calls, %.1f us/call, %zu bytes full, %zu bytes/delta\n",
+         statusCalls, statusCalls ? statusUs / statusCalls : 0.0, statusFullBytes,
+         statusCalls > 1 ? statusBytes / (statusCalls - 1) : 0);
+  if (names > 0) {
+    size_t nameWrites = store.writes;
+    flushTagNames(true);
+    int named = 0;
+    for (int i = 0; i < tagCount; i++) named += tagDatabase[i].nameSlot >= 0;
+    int registered = tagNameCount;
+    loadTagNames();
+    printf("names            %d registered, %d tags named, %zu NVS writes, %d reloaded from NVS\n",
+           registered, named, nameWrites, tagNameCount);
+  }
+  if (program) {
+    printf("programming      %s%s%s after %d attempts: confirm %u, stop %u, write %u, verify %u, total %u ms\n",
+           programmingStateName(programmingState), programmingState == PROG_FAILED ? " - " : "",
+           programmingState == PROG_FAILED ? programmingFailure : "", programmingAttempts,
+           programmingTiming.confirm, programmingTiming.stop, programmingTiming.write,
+           programmingTiming.verify, programmingTiming.total);
+  }
+
+  // Reboot onto the same files with the last commit cut mid-record, then
+  // query the middle of the recovered range by time
+  readingLog.commit();
+  const LogStats& l = readingLog.getStats();
+  size_t logAppends = logFiles.appends;
+  if (!logFiles.files.empty()) logFiles.files.rbegin()->second.resize(logFiles.files.rbegin()->second.size() - 5);
+  ReadingLog reopened;
+  t = Clock::now();
+  reopened.begin(&logFiles, READING_LOG_SEGMENTS);
+  double recoverUs = elapsedUs(t);
+  uint32_t midTime = readingLog.now() / 2;
+  size_t readsBefore = logFiles.reads;
+  t = Clock::now();
+  uint32_t midSeq = reopened.seqAtTime(midTime);
+  LogRecord range[256];
+  uint32_t rangeCount = reopened.read(midSeq, range, 256);
+  double queryUs = elapsedUs(t);
+  printf("reading log      %u reads in %u commits (%zu appends, %u bytes), %d segments, %u lost\n",
+         l.appended, l.commits, logAppends, l.bytesWritten, readingLog.segments(), l.lost);
+  printf("log recovery     %u records back (of %u logged) after a torn tail, %u file reads, %.1f us\n",
+         reopened.getStats().recovered, l.appended, reopened.getStats().recoveryReads, recoverUs);
+  printf("log query        t=%u ms -> seq %u, %u records read, %zu file reads, %.1f us; "
+         "CSV for %u..%u ms %zu bytes, %.1f us\n",
+         midTime, midSeq, rangeCount, logFiles.reads - readsBefore, queryUs, rangeFrom, rangeTo, csvRangeBytes,
+         csvRangeUs);
+
+  printf("reader mode      %s", readerModeName(readerMode));
+  if (readerMode == MODE_CONTROLLED) printf(" %u/%u ms, %u on windows", dutyOnMs, dutyOffMs, dutyCycles);
+  if (cfg.slotted) printf(", %u re-arms, %u rounds polled\n", pollRearms, s.rounds);
+  else printf(", %u re-arms, %u rounds polled (%.0f%% of the run)\n", pollRearms, s.rounds,
+              100.0 * s.rounds / ((double)cfg.roundsPerSecond * seconds));
+  printf("presence         %d present, %u enters, %u leaves", presentCount, presenceEnters, presenceLeaves);
+  if (leave > 0 && leftWaiting) printf("; removed tags still present after %u ms\n", simMillis - leftAt);
+  else if (leave > 0) printf("; %u removed tags all left within %u ms\n", leave, leaveLatency);
+  else printf("\n");
+
+  printf("reader state     \"%s\" / \"%s\", %.2f dBm (asked %.2f), region 0x%02X, channel %d, query 0x%04X, "
+         "%u errors, %u empty rounds\n",
+         readerState.hardware, readerState.software, currentPower / 100.0, requestedPower / 100.0,
+         readerState.region, readerState.channel, (unsigned)readerState.query, readerState.errorReplies,
+         readerState.emptyRounds);
+  if (cfg.foreignTags > 0 || select) {
+    int foreignKept = 0;
+    uint32_t ownReads = 0;
+    for (int i = 0; i < tagDatabaseCount; i++) {
+      if (tagDatabase[i].epc[1] == 0x00) foreignKept++; else ownReads += tagDatabase[i].readCount;
+    }
+    printf("select           %s, reader reports %u bits; %u reads of our tags, %u dropped on the host, "
+           "%d foreign tags kept\n",
+           selectFilter.active ? "on" : "off", readerState.selectKnown ? readerState.selectBits : 0,
+           ownReads, selectFiltered, foreignKept);
+  }
+  printf("inventory        Q%u%s S%u, %u Q changes; %.1f distinct tags/s, all %u seen after %u ms",
+         queryConfig.q, queryConfig.autoQ ? " auto" : "", queryConfig.session, autoQ.changes,
+         seconds ? (double)distinctPerSecond / seconds : 0.0, cfg.tagCount, allSeenAt);
+  if (cfg.slotted) printf("; %llu slots, %.0f%% collided", (unsigned long long)s.slots,
+                          s.slots ? 100.0 * s.collisions / s.slots : 0.0);
+  printf("\n");
+  if (sweep) {
+    CaptureRequest sweepReq;
+    handleSweep(sweepReq);
+    int best = powerSweep.recommended();
+    printf("power sweep      %s%s%s, %u of %u levels, /api/sweep %zu bytes; ", sweepStateName(powerSweep.state),
+           powerSweep.state == SWEEP_FAILED ? " - " : "", powerSweep.state == SWEEP_FAILED ? powerSweep.failure : "",
+           powerSweep.levelsDone(), powerSweep.levelCount, sweepReq.bytes);
+    if (best >= 0) printf("%.1f dBm recommended\n", powerSweep.levels[best].power / 100.0);
+    else printf("no recommendation\n");
+    for (uint8_t i = 0; i < powerSweep.levelsDone(); i++) {
+      const SweepLevel& level = powerSweep.levels[i];
+      printf("  %5.1f dBm      %4u tags (%u own, %u others), %6.1f reads/s, RSSI %.1f dBm%s\n",
+             level.power / 100.0, level.tags, level.ownTags, level.otherTags(), level.readsPerSecond(),
+             level.rssiMean(), (int)i == best ? "  <-" : "");
+    }
+    printf("                 back at %.2f dBm (asked %.2f), scanning %s\n", currentPower / 100.0,
+           requestedPower / 100.0, isScanning ? "on" : "off");
+  }
+  if (powerControlBand) {
+    const PowerControl& control = powerControl;
+    printf("power control    %s, at %.1f dBm (from %.1f), %u up / %u down, %u holds; last window %u tags "
+           "(%u own), weak tenth %d dBm: %s\n",
+           control.config.enabled ? "on" : "off", currentPower / 100.0, DEFAULT_POWER / 100.0, control.stepsUp,
+           control.stepsDown, control.holds, control.lastTags, control.lastOwnTags, control.lastWeakRssi,
+           control.reason);
+  }
+  const R200QueueStats& queue = r200Commands.getStats();
+  printf("commands         %u sent, %u replies, %u errors, %u retries, %u timeouts\n",
+         queue.sent, queue.replies, queue.errors, queue.retries, queue.timeouts);
+  const EventStats& e = eventHub.getStats();
+  printf("/api/events      %u events, %zu bytes in %u writes, %.1f us/s of host CPU\n",
+         e.events, events.bytes, events.writes, seconds ? eventsUs / seconds : 0.0);
+  printf("/api/history     %.1f us, %zu bytes in %u chunks (largest %zu)\n",
+         historyUs, historyBytes, historyChunks, historyLargest);
+  printf("/api/history.csv %.1f us, %zu bytes in %u chunks; from the log %.1f us, %zu bytes\n",
+         csvUs, csvBytes, csvChunks, csvLogUs, csvLogBytes);
+  printf("/api/metrics     %.1f us, %zu bytes; %.0f frames/s, %.0f reads/s, loop %.1f us mean, %u us max\n",
+         metricsUs, req.bytes, frameRate.perSecond, readRate.perSecond,
+         loopLatency.count ? (double)loopLatency.sumUs / loopLatency.count : 0.0, loopLatency.maxUs);
+  return 0;
+}
+
+#endif  // PIO_UNIT_TESTING
@@ -0,0 +1,435 @@
+#ifndef R200_SIMULATOR_H
+#define R200_SIMULATOR_H
+
+// Simulated R200 for the native build. Answers start/stop polling, power,
+// version and EPC write commands and, while polling, emits multi-poll tag
+// notifications for a configurable tag population at UART speed, with
+// optional corrupted frames mixed in.
+//
+// By default every tag that answers in a round is read. With slotted set,
+// a round has 2^Q slots from the query parameters, tags that pick the same
+// slot collide and nobody is read, and each round takes the air time of its
+// slots instead of a fixed 1/roundsPerSecond. Tags read in session S1-S3
+// then sit out rounds until their inventoried flag decays.
+//
+// RSSI means hold at R200_SIM_REF_POWER; every dB of TX power away from it
+// moves each reply by a dB, and a reply weaker than sensitivity is lost.
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "r200_parser.h"
+
+struct R200SimConfig {
+  uint32_t tagCount = 50;        // bottles in the field
+  uint32_t roundsPerSecond = 40; // inventory rounds per second
+  float readProbability = 0.8f;  // chance a tag answers in a given round
+  int rssiMean = -55;            // dBm, population mean
+  int rssiSpread = 8;            // dBm, stddev between tags
+  int rssiJitter = 3;            // dBm, stddev between reads of one tag
+  float corruptRate = 0.0f;      // fraction of frames damaged on the wire
+  uint32_t blankTags = 0;        // all-zero EPCs lying on the reader pad (strongest signal)
+  uint32_t foreignTags = 0;      // neighbouring stock with another EPC prefix, on top of tagCount
+  int foreignRssi = 0;           // dBm, foreign tags' mean RSSI; 0 = same as rssiMean
+  int sensitivity = -100;        // dBm, weaker replies are not heard
+  uint32_t baud = 115200;        // 0 = unlimited link speed
+  bool slotted = false;          // 2^Q slots per round, collisions and session flags
+  uint32_t seed = 1;
+};
+
+// Air time per round and slot for the slotted model, and how long a tag's
+// inventoried flag persists once read
+#define R200_SIM_ROUND_US 1500      // Select + Query
+#define R200_SIM_EMPTY_SLOT_US 250
+#define R200_SIM_COLLISION_US 500
+#define R200_SIM_READ_US 1800       // RN16, ACK, PC + EPC + CRC
+#define R200_SIM_S1_PERSIST_US 1000000
+#define R200_SIM_S23_PERSIST_US 4000000
+#define R200_SIM_REF_POWER 3000  // centi-dBm the RSSI means are given at
+
+struct R200SimStats {
+  uint64_t framesSent;
+  uint64_t framesCorrupted;
+  uint64_t framesDroppedByLink;  // notifications that did not fit the baud rate
+  uint64_t bytesSent;
+  uint32_t commandsReceived;
+  uint32_t rounds;  // inventory rounds run while polling
+  uint64_t slots;   // slotted model only
+  uint64_t collisions;
+};
+
+class R200Simulator {
+public:
+  explicit R200Simulator(const R200SimConfig& config) : cfg(config), rng(config.seed) {
+    stats = R200SimStats();
+    std::normal_distribution<float> spread(cfg.rssiMean, cfg.rssiSpread);
+    std::normal_distribution<float> foreignSpread(cfg.foreignRssi ? cfg.foreignRssi : cfg.rssiMean, cfg.rssiSpread);
+    tags.resize(cfg.tagCount + cfg.foreignTags);
+    for (uint32_t i = 0; i < tags.size(); i++) {
+      // Same prefix the dashboard uses for auto-generated EPCs
+      const uint8_t prefix[4] = {0xE2, 0x80, 0x69, 0x15};
+      const uint8_t foreign[4] = {0xE2, 0x00, 0x34, 0x12};
+      for (int b = 0; b < 4; b++) tags[i].epc[b] = i < cfg.tagCount ? prefix[b] : foreign[b];
+      for (int b = 4; b < 12; b++) tags[i].epc[b] = (uint8_t)rng();
+      tags[i].rssiMean = i < cfg.tagCount ? spread(rng) : foreignSpread(rng);
+      if (i < cfg.blankTags) {
+        memset(tags[i].epc, 0, sizeof(tags[i].epc));
+        tags[i].rssiMean = -30;
+      }
+      order.push_back(i);
+    }
+  }
+
+  // Bytes written by the host
+  void receive(const uint8_t* data, size_t len) {
+    hostParser.push(data, len, [this](const R200Frame& frame) { onCommand(frame); });
+  }
+
+  // Generate the traffic for the next `ms` milliseconds
+  void advance(uint32_t ms, std::vector<uint8_t>& out) {
+    // Command responses go out first and are never dropped or damaged
+    out.insert(out.end(), replies.begin(), replies.end());
+    stats.bytesSent += replies.size();
+    replies.clear();
+
+    if (cfg.slotted) {
+      // Rounds run back to back for as long as they take; each adds its own
+      // air time to the link budget
+      clockUs += ms * 1000ull;
+      if (!polling) roundDueUs = clockUs;
+      while (polling && roundDueUs < clockUs) {
+        stats.rounds++;
+        roundDueUs += runSlottedRound(out);
+        if (pollsRemaining > 0 && --pollsRemaining == 0) polling = false;
+      }
+      return;
+    }
+    if (cfg.baud > 0) {
+      double bytesPerSecond = cfg.baud / 10.0;  // 8N1 = 10 bits per byte
+      linkBudget += bytesPerSecond * ms / 1000.0;
+      if (linkBudget > bytesPerSecond / 10) linkBudget = bytesPerSecond / 10;
+    }
+    roundCarry += (double)cfg.roundsPerSecond * ms / 1000.0;
+    while (roundCarry >= 1.0) {
+      roundCarry -= 1.0;
+      if (!polling) continue;
+      stats.rounds++;
+      runRound(out);
+      if (pollsRemaining > 0 && --pollsRemaining == 0) polling = false;
+    }
+    if (cfg.baud == 0) linkBudget = 0;
+  }
+
+  // Take tags out of the field; they stop answering from now on
+  void removeTags(uint32_t count) {
+    for (uint32_t i = 0; i < count && i < tags.size(); i++) tags[tags.size() - 1 - i].gone = true;
+  }
+
+  bool isPolling() const { return polling; }
+  uint32_t tagCount() const { return tags.size(); }
+  const uint8_t* tagEpc(uint32_t i) const { return tags[i].epc; }
+  bool tagGone(uint32_t i) const { return tags[i].gone; }
+  const R200SimStats& getStats() const { return stats; }
+
+private:
+  struct SimTag {
+    uint8_t epc[12];
+    float rssiMean;
+    bool gone = false;
+    uint64_t quietUntilUs = 0;  // inventoried flag still flipped (slotted model)
+  };
+
+  R200SimConfig cfg;
+  std::mt19937 rng;
+  std::vector<SimTag> tags;
+  std::vector<uint32_t> order;  // answer order, reshuffled every round like random slots
+  R200FrameParser hostParser;
+  R200SimStats stats;
+  std::vector<uint8_t> replies;  // responses waiting for the next advance()
+  bool polling = false;
+  uint32_t pollsRemaining = 0;
+  int power = 2600;
+  uint16_t queryParam = 0x1020;  // Q=4, S0, target A
+  uint8_t region = 0x03;
+  uint8_t channel = 0;
+  std::vector<uint8_t> select = {0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00};  // EPC bank, no mask
+  uint8_t selectMode = 0x01;
+  double roundCarry = 0;
+  double linkBudget = 0;
+  uint64_t clockUs = 0;
+  uint64_t roundDueUs = 0;
+  std::vector<int> slotTag;  // per slot: tag index, -1 empty, -2 collision
+  std::vector<float> roundRssi;  // per tag, this round's reply strength
+
+  float powerShift() const { return (power - R200_SIM_REF_POWER) / 100.0f; }
+
+  void onCommand(const R200Frame& frame) {
+    stats.commandsReceived++;
+    switch (frame.command) {
+      case 0x22:  // single poll
+        polling = true;
+        pollsRemaining = 1;
+        break;
+      case 0x27:  // multiple poll: reserved byte, then 16-bit poll count
+        polling = true;
+        pollsRemaining = frame.length >= 3 ? ((uint32_t)frame.payload[1] << 8) | frame.payload[2] : 0;
+        break;
+      case 0x28:  // stop
+        polling = false;
+        reply(0x28, 0x00);
+        break;
+      case 0xB6:  // set power (centi-dBm)
+        if (frame.length >= 2) power = (frame.payload[0] << 8) | frame.payload[1];
+        reply(0xB6, 0x00);
+        break;
+      case 0xB7: {  // get power
+        const uint8_t p[] = {(uint8_t)(power >> 8), (uint8_t)power};
+        reply(0xB7, p, sizeof(p));
+        break;
+      }
+      case 0x03: {  // module info: 0x00 hardware, 0x01 software
+        static const char hw[] = "\x00M100 26dBm V1.0";
+        static const char sw[] = "\x01V2.3.5";
+        bool hardware = frame.length < 1 || frame.payload[0] == 0x00;
+        reply(0x03, (const uint8_t*)(hardware ? hw : sw), hardware ? sizeof(hw) - 1 : sizeof(sw) - 1);
+        break;
+      }
+      case 0x49:  // write: password (4), bank, word address (2), word count (2), data
+        writeTag(frame);
+        break;
+      case 0x0D: {  // get query parameters
+        const uint8_t p[] = {(uint8_t)(queryParam >> 8), (uint8_t)queryParam};
+        reply(0x0D, p, sizeof(p));
+        break;
+      }
+      case 0x0E:  // set query parameters
+        if (frame.length >= 2) queryParam = (frame.payload[0] << 8) | frame.payload[1];
+        reply(0x0E, 0x00);
+        break;
+      case 0x0B:  // get select: parameter, pointer (4), mask bits, truncate, mask
+        reply(0x0B, select.data(), select.size());
+        break;
+      case 0x0C:  // set select
+        if (frame.length >= 7) select.assign(frame.payload, frame.payload + frame.length);
+        reply(0x0C, 0x00);
+        break;
+      case 0x12:  // select mode
+        if (frame.length >= 1) selectMode = frame.payload[0];
+        reply(0x12, 0x00);
+        break;
+      case 0x08:  // get region
+        reply(0x08, region);
+        break;
+      case 0x07:  // set region
+        if (frame.length >= 1) region = frame.payload[0];
+        reply(0x07, 0x00);
+        break;
+      case 0xAA:  // get channel
+        reply(0xAA, channel);
+        break;
+      case 0xAB:  // set channel
+        if (frame.length >= 1) channel = frame.payload[0];
+        reply(0xAB, 0x00);
+        break;
+      case 0xAD:  // frequency hopping on/off
+        reply(0xAD, 0x00);
+        break;
+      default:
+        break;
+    }
+  }
+
+  // The module writes to the strongest tag that answers; none -> error 0x10
+  void writeTag(const R200Frame& frame) {
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    int target = -1;
+    for (size_t i = 0; i < tags.size(); i++) {
+      if (tags[i].gone || chance(rng) > cfg.readProbability) continue;
+      if (target < 0 || tags[i].rssiMean > tags[target].rssiMean) target = (int)i;
+    }
+    if (target < 0) {
+      reply(0xFF, 0x10);
+      return;
+    }
+
+    SimTag& tag = tags[target];
+    uint8_t answer[16];
+    answer[0] = 14;  // UL: PC + EPC bytes
+    answer[1] = 0x30;
+    answer[2] = 0x00;
+    memcpy(answer + 3, tag.epc, 12);
+    answer[15] = 0x00;
+    // EPC bank, word address 2, 6 words
+    const uint8_t* p = frame.payload;
+    if (frame.length >= 21 && p[4] == 0x01 && p[5] == 0x00 && p[6] == 0x02 && p[7] == 0x00 && p[8] == 0x06) {
+      memcpy(tag.epc, p + 9, 12);
+    }
+    reply(0x49, answer, sizeof(answer));
+  }
+
+  void reply(uint8_t command, const uint8_t* payload, size_t len) {
+    uint8_t sum = R200_TYPE_RESPONSE + command + (uint8_t)(len >> 8) + (uint8_t)len;
+    replies.push_back(R200_FRAME_HEADER);
+    replies.push_back(R200_TYPE_RESPONSE);
+    replies.push_back(command);
+    replies.push_back((uint8_t)(len >> 8));
+    replies.push_back((uint8_t)len);
+    for (size_t i = 0; i < len; i++) {
+      replies.push_back(payload[i]);
+      sum += payload[i];
+    }
+    replies.push_back(sum);
+    replies.push_back(R200_FRAME_END);
+  }
+
+  void reply(uint8_t command, uint8_t status) { reply(command, &status, 1); }
+
+  // Select on the EPC bank: tags whose bits from the pointer differ from the
+  // mask sit out the round
+  bool selected(const SimTag& tag) const {
+    if (selectMode != 0x00 || select.size() < 7 || (select[0] & 0x03) != 0x01) return true;
+    uint32_t pointer = (uint32_t)select[1] << 24 | select[2] << 16 | select[3] << 8 | select[4];
+    for (uint32_t k = 0; k < select[5] && 7 + k / 8 < select.size(); k++) {
+      uint32_t bit = pointer - 0x20 + k;
+      if (bit >= 96) return false;
+      bool want = select[7 + k / 8] & (0x80 >> (k % 8));
+      bool have = tag.epc[bit / 8] & (0x80 >> (bit % 8));
+      if (want != have) return false;
+    }
+    return true;
+  }
+
+  void runRound(std::vector<uint8_t>& out) {
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    std::normal_distribution<float> jitter(0.0f, (float)cfg.rssiJitter);
+    std::shuffle(order.begin(), order.end(), rng);
+    bool anyRead = false;
+    for (size_t i = 0; i < order.size(); i++) {
+      const SimTag& tag = tags[order[i]];
+      if (tag.gone || !selected(tag) || chance(rng) > cfg.readProbability) continue;
+      float rssi = tag.rssiMean + powerShift() + jitter(rng);
+      if (rssi < cfg.sensitivity) continue;
+      anyRead = true;
+      if (rssi > -20) rssi = -20;
+      if (rssi < -90) rssi = -90;
+      emitTag(tag, (int)lroundf(rssi), out);
+    }
+    if (!anyRead) {
+      // No tag answered: the module reports error 0x15
+      const uint8_t err[] = {0xAA, 0x01, 0xFF, 0x00, 0x01, 0x15, 0x16, 0xDD};
+      emit(err, sizeof(err), out);
+    }
+  }
+
+  // One round of 2^Q slots; returns its air time in us. The query target
+  // is not modelled: tags are taken to start on the flag it asks for.
+  uint32_t runSlottedRound(std::vector<uint8_t>& out) {
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    std::normal_distribution<float> jitter(0.0f, (float)cfg.rssiJitter);
+    uint8_t q = (queryParam >> 3) & 15;
+    uint8_t session = (queryParam >> 8) & 3;
+    slotTag.assign(1u << q, -1);
+    roundRssi.resize(tags.size());
+    for (size_t i = 0; i < tags.size(); i++) {
+      const SimTag& tag = tags[i];
+      if (tag.gone || !selected(tag) || tag.quietUntilUs > roundDueUs || chance(rng) > cfg.readProbability) continue;
+      roundRssi[i] = tag.rssiMean + powerShift() + jitter(rng);
+      if (roundRssi[i] < cfg.sensitivity) continue;
+      int& slot = slotTag[rng() & (slotTag.size() - 1)];
+      slot = slot == -1 ? (int)i : -2;
+    }
+
+    uint32_t airUs = R200_SIM_ROUND_US;
+    for (size_t s = 0; s < slotTag.size(); s++) {
+      airUs += slotTag[s] == -1 ? R200_SIM_EMPTY_SLOT_US : slotTag[s] == -2 ? R200_SIM_COLLISION_US : R200_SIM_READ_US;
+    }
+    if (cfg.baud > 0) {
+      double bytesPerSecond = cfg.baud / 10.0;  // 8N1 = 10 bits per byte
+      linkBudget += bytesPerSecond * airUs / 1e6;
+      if (linkBudget > bytesPerSecond * airUs / 1e6 + bytesPerSecond / 10) {
+        linkBudget = bytesPerSecond * airUs / 1e6 + bytesPerSecond / 10;
+      }
+    }
+
+    bool anyRead = false;
+    for (size_t s = 0; s < slotTag.size(); s++) {
+      if (slotTag[s] == -2) {
+        stats.collisions++;
+      } else if (slotTag[s] >= 0) {
+        SimTag& tag = tags[slotTag[s]];
+        anyRead = true;
+        if (session != 0) {
+          tag.quietUntilUs = roundDueUs + (session == 1 ? R200_SIM_S1_PERSIST_US : R200_SIM_S23_PERSIST_US);
+        }
+        float rssi = roundRssi[slotTag[s]];
+        if (rssi > -20) rssi = -20;
+        if (rssi < -90) rssi = -90;
+        emitTag(tag, (int)lroundf(rssi), out);
+      }
+    }
+    stats.slots += slotTag.size();
+    if (!anyRead) {
+      const uint8_t err[] = {0xAA, 0x01, 0xFF, 0x00, 0x01, 0x15, 0x16, 0xDD};
+      emit(err, sizeof(err), out);
+    }
+    return airUs;
+  }
+
+  void emitTag(const SimTag& tag, int rssi, std::vector<uint8_t>& out) {
+    uint8_t f[24];
+    f[0] = 0xAA;
+    f[1] = 0x02;
+    f[2] = 0x22;
+    f[3] = 0x00;
+    f[4] = 0x11;
+    f[5] = (uint8_t)(rssi & 0xFF);
+    f[6] = 0x30;  // PC: 6 EPC words
+    f[7] = 0x00;
+    for (int i = 0; i < 12; i++) f[8 + i] = tag.epc[i];
+    f[20] = (uint8_t)rng();  // CRC is not checked by the host
+    f[21] = (uint8_t)rng();
+    uint8_t sum = 0;
+    for (int i = 1; i < 22; i++) sum += f[i];
+    f[22] = sum;
+    f[23] = 0xDD;
+    emit(f, sizeof(f), out);
+  }
+
+  void emit(const uint8_t* frame, size_t len, std::vector<uint8_t>& out) {
+    if (cfg.baud > 0) {
+      if (linkBudget < len) {
+        stats.framesDroppedByLink++;
+        return;
+      }
+      linkBudget -= len;
+    }
+
+    size_t start = out.size();
+    out.insert(out.end(), frame, frame + len);
+
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    if (cfg.corruptRate > 0 && chance(rng) < cfg.corruptRate) {
+      stats.framesCorrupted++;
+      switch (rng() % 3) {
+        case 0:  // bit error
+          out[start + 1 + rng() % (len - 1)] ^= (uint8_t)(1 << (rng() % 8));
+          break;
+        case 1:  // truncated frame
+          out.resize(start + 1 + rng() % (len - 1));
+          break;
+        default:  // line noise ahead of the frame
+          out.insert(out.begin() + start, (uint8_t)0xAA);
+          out.insert(out.begin() + start + 1, (uint8_t)rng());
+          break;
+      }
+    }
+    stats.framesSent++;
+    stats.bytesSent += out.size() - start;
+  }
+};
+
+#endif
@@ -0,0 +1,201 @@
+// EpcIndex on the host: pio test -e native -f test_epc_index
+
+#include <unity.h>
+
+#include "tag_store.h"
+
+struct Record {
+  uint8_t epc[EPC_LEN];
+};
+
+#define MAX_RECORDS 8
+#define TABLE_SIZE 16  // tableSizeFor(MAX_RECORDS)
+#define TABLE_MASK (TABLE_SIZE - 1)
+
+static Record records[MAX_RECORDS];
+static uint16_t table[TABLE_SIZE];
+static EpcIndex<Record> epcIndex;
+
+static uint32_t nextCandidate;
+
+// Next EPC (after the last one handed out) whose home slot is the one given,
+// so tests can line up collisions without depending on hash values
+static void epcWithHome(size_t home, uint8_t* epc) {
+  memset(epc, 0, EPC_LEN);
+  epc[0] = 0xE2;
+  while (true) {
+    uint32_t n = nextCandidate++;
+    memcpy(epc + EPC_LEN - sizeof(n), &n, sizeof(n));
+    if ((epcHash(epc) & TABLE_MASK) == home) return;
+  }
+}
+
+// Record r gets an EPC homed at the given slot and goes into the index
+static void add(uint16_t r, size_t home) {
+  epcWithHome(home, records[r].epc);
+  epcIndex.insert(records[r].epc, r);
+}
+
+static int slotOf(uint16_t r) {
+  for (int i = 0; i < TABLE_SIZE; i++) {
+    if (table[i] == r + 1) return i;
+  }
+  return -1;
+}
+
+static void assertAllFound(int count) {
+  for (int r = 0; r < count; r++) TEST_ASSERT_EQUAL_INT(r, epcIndex.find(records[r].epc));
+}
+
+void setUp() {
+  memset(records, 0, sizeof(records));
+  epcIndex.begin(records, table, TABLE_SIZE);
+  nextCandidate = 0;
+}
+
+void tearDown() {}
+
+void test_table_size() {
+  TEST_ASSERT_EQUAL_INT(16, EpcIndex<Record>::tableSizeFor(1));
+  TEST_ASSERT_EQUAL_INT(TABLE_SIZE, EpcIndex<Record>::tableSizeFor(MAX_RECORDS));
+  TEST_ASSERT_EQUAL_INT(32, EpcIndex<Record>::tableSizeFor(9));
+  TEST_ASSERT_EQUAL_INT(1024, EpcIndex<Record>::tableSizeFor(500));
+}
+
+void test_lookup_missing() {
+  uint8_t epc[EPC_LEN];
+  epcWithHome(3, epc);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(epc));
+  add(0, 3);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(epc));
+  TEST_ASSERT_EQUAL_INT(0, epcIndex.find(records[0].epc));
+}
+
+void test_colliding_hashes() {
+  add(0, 5);
+  add(1, 5);
+  add(2, 5);
+  TEST_ASSERT_EQUAL_INT(5, slotOf(0));
+  TEST_ASSERT_EQUAL_INT(6, slotOf(1));
+  TEST_ASSERT_EQUAL_INT(7, slotOf(2));
+  assertAllFound(3);
+
+  // Same home, not stored: the probe walks the chain and stops at the gap
+  uint8_t missing[EPC_LEN];
+  epcWithHome(5, missing);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(missing));
+}
+
+// A chain homed at the last slot continues at slot 0
+void test_wraparound() {
+  add(0, TABLE_MASK);
+  add(1, TABLE_MASK);
+  add(2, TABLE_MASK);
+  add(3, 0);
+  TEST_ASSERT_EQUAL_INT(TABLE_MASK, slotOf(0));
+  TEST_ASSERT_EQUAL_INT(0, slotOf(1));
+  TEST_ASSERT_EQUAL_INT(1, slotOf(2));
+  TEST_ASSERT_EQUAL_INT(2, slotOf(3));
+  assertAllFound(4);
+
+  uint8_t missing[EPC_LEN];
+  epcWithHome(TABLE_MASK, missing);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(missing));
+}
+
+// Removing the head of a chain pulls the displaced keys back so they are
+// still found, with no tombstone left behind
+void test_remove_then_lookup_displaced() {
+  add(0, 4);
+  add(1, 4);
+  add(2, 5);  // displaced to 6 by record 1
+  add(3, 4);  // displaced to 7
+  epcIndex.remove(records[0].epc);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(records[0].epc));
+  TEST_ASSERT_EQUAL_INT(1, epcIndex.find(records[1].epc));
+  TEST_ASSERT_EQUAL_INT(2, epcIndex.find(records[2].epc));
+  TEST_ASSERT_EQUAL_INT(3, epcIndex.find(records[3].epc));
+  TEST_ASSERT_EQUAL_INT(4, slotOf(1));
+  TEST_ASSERT_EQUAL_INT(5, slotOf(2));
+  TEST_ASSERT_EQUAL_INT(6, slotOf(3));
+  TEST_ASSERT_EQUAL_INT(0, table[7]);
+}
+
+// An entry sitting in its home slot must not be moved into an earlier hole
+void test_remove_keeps_entries_at_home() {
+  add(0, 4);
+  add(1, 4);  // 5
+  add(2, 6);  // at home
+  add(3, 4);  // 7
+  epcIndex.remove(records[1].epc);
+  TEST_ASSERT_EQUAL_INT(4, slotOf(0));
+  TEST_ASSERT_EQUAL_INT(5, slotOf(3));
+  TEST_ASSERT_EQUAL_INT(6, slotOf(2));
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(records[1].epc));
+  TEST_ASSERT_EQUAL_INT(0, epcIndex.find(records[0].epc));
+  TEST_ASSERT_EQUAL_INT(2, epcIndex.find(records[2].epc));
+  TEST_ASSERT_EQUAL_INT(3, epcIndex.find(records[3].epc));
+}
+
+void test_remove_across_wraparound() {
+  add(0, TABLE_MASK - 1);
+  add(1, TABLE_MASK - 1);  // last slot
+  add(2, TABLE_MASK);      // 0
+  add(3, TABLE_MASK - 1);  // 1
+  add(4, 0);               // 2
+  epcIndex.remove(records[0].epc);
+  TEST_ASSERT_EQUAL_INT(-1, epcIndex.find(records[0].epc));
+  for (int r = 1; r < 5; r++) TEST_ASSERT_EQUAL_INT(r, epcIndex.find(records[r].epc));
+  TEST_ASSERT_EQUAL_INT(TABLE_MASK - 1, slotOf(1));
+  TEST_ASSERT_EQUAL_INT(TABLE_MASK, slotOf(2));
+  TEST_ASSERT_EQUAL_INT(0, slotOf(3));
+  TEST_ASSERT_EQUAL_INT(1, slotOf(4));
+  TEST_ASSERT_EQUAL_INT(0, table[2]);
+}
+
+void test_remove_missing_is_noop() {
+  add(0, 9);
+  add(1, 9);
+  uint8_t missing[EPC_LEN];
+  epcWithHome(9, missing);
+  epcIndex.remove(missing);
+  assertAllFound(2);
+  TEST_ASSERT_EQUAL_INT(9, slotOf(0));
+  TEST_ASSERT_EQUAL_INT(10, slotOf(1));
+}
+
+// Churn through the records the way the tag table recycles them, checking
+// every lookup against what should be stored
+void test_churn() {
+  bool stored[MAX_RECORDS] = {false};
+  uint32_t seed = 1;
+  for (int round = 0; round < 2000; round++) {
+    seed = seed * 1103515245u + 12345u;
+    uint16_t r = (seed >> 16) % MAX_RECORDS;
+    if (stored[r]) {
+      epcIndex.remove(records[r].epc);
+      stored[r] = false;
+    } else {
+      // Few distinct homes, so chains collide and wrap
+      add(r, (TABLE_MASK - 1 + (seed >> 24) % 4) & TABLE_MASK);
+      stored[r] = true;
+    }
+    for (int k = 0; k < MAX_RECORDS; k++) {
+      TEST_ASSERT_EQUAL_INT(stored[k] ? k : -1, epcIndex.find(records[k].epc));
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_size);
+  RUN_TEST(test_lookup_missing);
+  RUN_TEST(test_colliding_hashes);
+  RUN_TEST(test_wraparound);
+  RUN_TEST(test_remove_then_lookup_displaced);
+  RUN_TEST(test_remove_keeps_entries_at_home);
+  RUN_TEST(test_remove_across_wraparound);
+  RUN_TEST(test_remove_missing_is_noop);
+  RUN_TEST(test_churn);
+  return UNITY_END();
+}
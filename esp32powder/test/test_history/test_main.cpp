@@ -0,0 +1,255 @@
+// Reading history ring and /api/status?since=N on the host:
+//   pio test -e native -f test_history
+
+#include <unity.h>
+
+#include "config.h"
+#include "history_log.h"
+#include "tracker.h"
+#include "../../src/native/host.h"
+
+// ----- HistoryLog -----
+// Each record's timestamp is set to its sequence number, so at() can be
+// checked against the record it should find
+
+#define RING_CAPACITY 4
+
+static ReadingHistory ring[RING_CAPACITY];
+static HistoryLog readings;
+
+static uint32_t appendReadings(uint32_t n) {
+  uint32_t seq = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    seq = readings.lastSeq() + 1;
+    readings.append().timestamp = seq;
+  }
+  return seq;
+}
+
+void setUp() {
+  memset(ring, 0, sizeof(ring));
+  readings = HistoryLog();
+  readings.begin(ring, RING_CAPACITY);
+}
+
+void tearDown() {}
+
+void test_history_empty() {
+  TEST_ASSERT_EQUAL_UINT32(0, readings.size());
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY, readings.capacity());
+  TEST_ASSERT_EQUAL_UINT32(1, readings.firstSeq());
+  TEST_ASSERT_EQUAL_UINT32(0, readings.lastSeq());
+  TEST_ASSERT_FALSE(readings.contains(0));
+  TEST_ASSERT_FALSE(readings.contains(1));
+}
+
+void test_history_fills() {
+  appendReadings(3);
+  TEST_ASSERT_EQUAL_UINT32(3, readings.size());
+  TEST_ASSERT_EQUAL_UINT32(1, readings.firstSeq());
+  TEST_ASSERT_EQUAL_UINT32(3, readings.lastSeq());
+  TEST_ASSERT_EQUAL_UINT32(0, readings.droppedCount());
+  for (uint32_t seq = 1; seq <= 3; seq++) {
+    TEST_ASSERT_TRUE(readings.contains(seq));
+    TEST_ASSERT_EQUAL_UINT32(seq, readings.at(seq).timestamp);
+  }
+  TEST_ASSERT_FALSE(readings.contains(0));
+  TEST_ASSERT_FALSE(readings.contains(4));
+}
+
+// firstSeq is derived as nextSeq - count; once the ring is full it moves on
+// with every append and the overwritten records count as dropped
+void test_history_wraparound() {
+  appendReadings(RING_CAPACITY * 2 + 2);
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY, readings.size());
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY + 2, readings.droppedCount());
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY + 3, readings.firstSeq());
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY * 2 + 2, readings.lastSeq());
+  TEST_ASSERT_EQUAL_UINT32(readings.lastSeq() - readings.size() + 1, readings.firstSeq());
+  TEST_ASSERT_FALSE(readings.contains(1));
+  TEST_ASSERT_FALSE(readings.contains(readings.firstSeq() - 1));
+  TEST_ASSERT_FALSE(readings.contains(readings.lastSeq() + 1));
+  for (uint32_t seq = readings.firstSeq(); seq <= readings.lastSeq(); seq++) {
+    TEST_ASSERT_TRUE(readings.contains(seq));
+    TEST_ASSERT_EQUAL_UINT32(seq, readings.at(seq).timestamp);
+  }
+}
+
+// Many laps of the ring: the window always holds the newest records
+void test_history_many_laps() {
+  for (uint32_t n = 1; n <= 50; n++) {
+    appendReadings(1);
+    uint32_t held = n < RING_CAPACITY ? n : RING_CAPACITY;
+    TEST_ASSERT_EQUAL_UINT32(held, readings.size());
+    TEST_ASSERT_EQUAL_UINT32(n - held + 1, readings.firstSeq());
+    TEST_ASSERT_EQUAL_UINT32(n, readings.lastSeq());
+    TEST_ASSERT_EQUAL_UINT32(n - held, readings.droppedCount());
+    for (uint32_t seq = readings.firstSeq(); seq <= n; seq++) TEST_ASSERT_EQUAL_UINT32(seq, readings.at(seq).timestamp);
+  }
+}
+
+// A clear empties the window but sequence numbers carry on, so a client
+// holding an old number never mistakes new records for ones it has
+void test_history_clear_keeps_seq() {
+  appendReadings(RING_CAPACITY + 1);
+  uint32_t last = readings.lastSeq();
+  readings.clear();
+  TEST_ASSERT_EQUAL_UINT32(0, readings.size());
+  TEST_ASSERT_EQUAL_UINT32(0, readings.droppedCount());
+  TEST_ASSERT_EQUAL_UINT32(last, readings.lastSeq());
+  TEST_ASSERT_EQUAL_UINT32(last + 1, readings.firstSeq());
+  TEST_ASSERT_FALSE(readings.contains(last));
+  appendReadings(2);
+  TEST_ASSERT_EQUAL_UINT32(last + 1, readings.firstSeq());
+  TEST_ASSERT_EQUAL_UINT32(last + 2, readings.lastSeq());
+  TEST_ASSERT_EQUAL_UINT32(last + 2, readings.at(last + 2).timestamp);
+}
+
+// ----- /api/status?since=N -----
+
+// Reader that never answers; commands just wait in the queue
+class QuietPort : public ReaderPort {
+public:
+  int available() override { return 0; }
+  int read() override { return -1; }
+  size_t write(const uint8_t*, size_t len) override { return len; }
+};
+
+static QuietPort port;
+static MemoryStore store;
+
+static void startTracker() {
+  static bool started = false;
+  if (started) return;
+  started = true;
+  TEST_ASSERT_TRUE(trackerBegin(port, store, DEFAULT_POWER, 16, 64));
+}
+
+static void makeEpc(uint8_t id, uint8_t* epc) {
+  memset(epc, 0, EPC_LEN);
+  epc[0] = 0xE2;
+  epc[EPC_LEN - 1] = id;
+}
+
+// One inventory notification for the tag, as the R200 sends it
+static void readTag(const uint8_t* epc) {
+  uint8_t f[24] = {R200_FRAME_HEADER, R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, 0x00, 0x11, (uint8_t)-50, 0x30, 0x00};
+  memcpy(f + 8, epc, EPC_LEN);
+  uint8_t sum = 0;
+  for (int i = 1; i < 22; i++) sum += f[i];
+  f[22] = sum;
+  f[23] = R200_FRAME_END;
+  for (uint8_t b : f) ingestByte(b);
+  trackerPoll();
+}
+
+static std::string status(uint32_t since) {
+  CaptureRequest req;
+  req.keepBody = true;
+  if (since) req.args["since"] = std::to_string(since);
+  handleStatus(req);
+  return req.body;
+}
+
+static uint32_t seqOf(const std::string& body) {
+  size_t at = body.find("\"seq\":");
+  return at == std::string::npos ? 0 : strtoul(body.c_str() + at + 6, NULL, 10);
+}
+
+static bool isFull(const std::string& body) { return body.find("\"full\":true") != std::string::npos; }
+
+static bool hasModeFields(const std::string& body) { return body.find("\"scanning\":") != std::string::npos; }
+
+static bool hasTag(const std::string& body, const uint8_t* epc) {
+  return body.find("\"epc\":\"" + toHex(epc, EPC_LEN) + "\"") != std::string::npos;
+}
+
+void test_status_full_then_delta() {
+  startTracker();
+  uint8_t a[EPC_LEN], b[EPC_LEN];
+  makeEpc(1, a);
+  makeEpc(2, b);
+  readTag(a);
+  readTag(b);
+
+  std::string body = status(0);
+  TEST_ASSERT_TRUE(isFull(body));
+  TEST_ASSERT_TRUE(hasModeFields(body));
+  TEST_ASSERT_TRUE(hasTag(body, a));
+  TEST_ASSERT_TRUE(hasTag(body, b));
+  uint32_t seq = seqOf(body);
+  TEST_ASSERT_EQUAL_UINT32(statusSeq, seq);
+
+  // Nothing changed: no tags, no mode fields, same sequence
+  body = status(seq);
+  TEST_ASSERT_FALSE(isFull(body));
+  TEST_ASSERT_FALSE(hasModeFields(body));
+  TEST_ASSERT_FALSE(hasTag(body, a));
+  TEST_ASSERT_FALSE(hasTag(body, b));
+  TEST_ASSERT_EQUAL_UINT32(seq, seqOf(body));
+
+  // Only the tag read since comes back
+  readTag(b);
+  body = status(seq);
+  TEST_ASSERT_FALSE(isFull(body));
+  TEST_ASSERT_FALSE(hasTag(body, a));
+  TEST_ASSERT_TRUE(hasTag(body, b));
+  TEST_ASSERT_TRUE(seqOf(body) > seq);
+
+  // An older sequence still gets everything changed after it
+  body = status(seq - 1);
+  TEST_ASSERT_TRUE(hasTag(body, b));
+}
+
+void test_status_mode_change() {
+  startTracker();
+  uint32_t seq = seqOf(status(0));
+  CaptureRequest power;
+  power.args["value"] = std::to_string(DEFAULT_POWER - 500);
+  handlePower(power);
+  TEST_ASSERT_EQUAL_INT(200, power.code);
+  std::string body = status(seq);
+  TEST_ASSERT_FALSE(isFull(body));
+  TEST_ASSERT_TRUE(hasModeFields(body));
+  TEST_ASSERT_TRUE(seqOf(body) > seq);
+  TEST_ASSERT_FALSE(hasModeFields(status(seqOf(body))));
+}
+
+// A sequence from before a clear, or from ahead of the device (it rebooted),
+// cannot be served as a delta
+void test_status_full_after_clear_or_reboot() {
+  startTracker();
+  uint8_t a[EPC_LEN];
+  makeEpc(3, a);
+  readTag(a);
+  uint32_t seq = seqOf(status(0));
+
+  std::string body = status(seq + 1000);
+  TEST_ASSERT_TRUE(isFull(body));
+  TEST_ASSERT_TRUE(hasTag(body, a));
+
+  CaptureRequest clear;
+  handleClear(clear);
+  body = status(seq);
+  TEST_ASSERT_TRUE(isFull(body));
+  TEST_ASSERT_FALSE(hasTag(body, a));
+
+  readTag(a);
+  uint32_t after = seqOf(body);
+  body = status(after);
+  TEST_ASSERT_FALSE(isFull(body));
+  TEST_ASSERT_TRUE(hasTag(body, a));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_history_empty);
+  RUN_TEST(test_history_fills);
+  RUN_TEST(test_history_wraparound);
+  RUN_TEST(test_history_many_laps);
+  RUN_TEST(test_history_clear_keeps_seq);
+  RUN_TEST(test_status_full_then_delta);
+  RUN_TEST(test_status_mode_change);
+  RUN_TEST(test_status_full_after_clear_or_reboot);
+  return UNITY_END();
+}
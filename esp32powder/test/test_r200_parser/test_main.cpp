@@ -0,0 +1,273 @@
+// R200FrameParser on the host: pio test -e native -f test_r200_parser
+
+#include <unity.h>
+
+#include "r200_parser.h"
+
+static R200FrameParser parser;
+
+// What the frame callback saw; payload is copied out, as the parser's
+// pointer is only valid inside the callback
+static int framesSeen;
+static uint8_t lastType;
+static uint8_t lastCommand;
+static uint16_t lastLength;
+static uint8_t lastPayload[R200_MAX_PAYLOAD];
+
+static void onFrame(const R200Frame& frame) {
+  framesSeen++;
+  lastType = frame.type;
+  lastCommand = frame.command;
+  lastLength = frame.length;
+  memcpy(lastPayload, frame.payload, frame.length);
+}
+
+static void feed(const uint8_t* data, size_t len) {
+  parser.push(data, len, onFrame);
+}
+
+// Whole frame around a payload; returns its size
+static size_t makeFrame(uint8_t type, uint8_t command, const uint8_t* payload, uint16_t len, uint8_t* out) {
+  out[0] = R200_FRAME_HEADER;
+  out[1] = type;
+  out[2] = command;
+  out[3] = len >> 8;
+  out[4] = len & 0xFF;
+  memcpy(out + 5, payload, len);
+  uint8_t sum = 0;
+  for (size_t i = 1; i < 5u + len; i++) sum += out[i];
+  out[5 + len] = sum;
+  out[6 + len] = R200_FRAME_END;
+  return len + R200_FRAME_OVERHEAD;
+}
+
+static const uint8_t TAG_PAYLOAD[] = {0xC8, 0x34, 0x00, 0xE2, 0x00, 0x00, 0x17, 0x22,
+                                      0x0A, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0x12, 0x34};
+
+void setUp() {
+  parser.reset();
+  parser.clearStats();
+  framesSeen = 0;
+  lastLength = 0;
+}
+
+void tearDown() {}
+
+void test_whole_frame() {
+  uint8_t frame[64];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), frame);
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8(R200_TYPE_NOTICE, lastType);
+  TEST_ASSERT_EQUAL_HEX8(R200_CMD_SINGLE_POLL, lastCommand);
+  TEST_ASSERT_EQUAL_INT(sizeof(TAG_PAYLOAD), lastLength);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(TAG_PAYLOAD, lastPayload, sizeof(TAG_PAYLOAD));
+  TEST_ASSERT_EQUAL_UINT32(1, parser.getStats().frames);
+  TEST_ASSERT_EQUAL_UINT32(0, parser.getStats().bytesDiscarded);
+}
+
+void test_empty_payload() {
+  uint8_t frame[8];
+  size_t n = makeFrame(R200_TYPE_RESPONSE, 0x03, nullptr, 0, frame);
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_INT(0, lastLength);
+}
+
+// UART reads hand over whatever has arrived, so a frame can be cut anywhere
+void test_split_frames() {
+  uint8_t frame[64];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), frame);
+  for (size_t cut = 1; cut < n; cut++) {
+    feed(frame, cut);
+    TEST_ASSERT_EQUAL_INT(0, framesSeen);
+    feed(frame + cut, n - cut);
+    TEST_ASSERT_EQUAL_INT(1, framesSeen);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(TAG_PAYLOAD, lastPayload, sizeof(TAG_PAYLOAD));
+    framesSeen = 0;
+  }
+  for (size_t i = 0; i < n; i++) feed(frame + i, 1);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_UINT32(n, parser.getStats().frames);
+  TEST_ASSERT_EQUAL_UINT32(0, parser.getStats().bytesDiscarded);
+}
+
+void test_back_to_back_frames() {
+  uint8_t stream[128];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream);
+  n += makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + n);
+  n += makeFrame(R200_TYPE_RESPONSE, R200_CMD_ERROR, TAG_PAYLOAD, 1, stream + n);
+  feed(stream, n);
+  TEST_ASSERT_EQUAL_INT(3, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8(R200_CMD_ERROR, lastCommand);
+  TEST_ASSERT_EQUAL_UINT32(0, parser.getStats().bytesDiscarded);
+}
+
+void test_leading_noise_discarded() {
+  static const uint8_t noise[] = {0x00, 0xDD, 0x13, 0x7F, 0xFF};
+  uint8_t frame[64];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), frame);
+  feed(noise, sizeof(noise));
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(noise), parser.getStats().bytesDiscarded);
+}
+
+void test_bad_checksum_then_valid_frame() {
+  uint8_t stream[128];
+  size_t bad = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream);
+  stream[bad - 2] ^= 0x01;
+  size_t n = bad + makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + bad);
+  feed(stream, n);
+  const R200ParserStats& stats = parser.getStats();
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(TAG_PAYLOAD, lastPayload, sizeof(TAG_PAYLOAD));
+  TEST_ASSERT_EQUAL_UINT32(1, stats.checksumErrors);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.framingErrors);
+  // The payload holds no 0xAA, so the whole bad frame goes, end byte included
+  TEST_ASSERT_EQUAL_UINT32(bad, stats.bytesDiscarded);
+}
+
+// A payload byte of 0xAA is data, not a frame start
+void test_header_byte_inside_payload() {
+  static const uint8_t payload[] = {0x01, 0xAA, 0x00, 0x02, 0xAA, 0xAA};
+  uint8_t frame[32];
+  size_t n = makeFrame(R200_TYPE_RESPONSE, 0x07, payload, sizeof(payload), frame);
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_INT(sizeof(payload), lastLength);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(payload, lastPayload, sizeof(payload));
+  TEST_ASSERT_EQUAL_UINT32(0, parser.getStats().bytesDiscarded);
+}
+
+// After a corrupt frame the parser restarts at the 0xAA in its payload; that
+// false start has to fail too without eating the real frame behind it
+void test_false_start_inside_corrupt_payload() {
+  static const uint8_t payload[] = {0x10, 0xAA, 0x01, 0x22, 0x00, 0x08, 0x55};
+  uint8_t stream[128];
+  size_t bad = makeFrame(R200_TYPE_RESPONSE, 0x07, payload, sizeof(payload), stream);
+  stream[bad - 2] ^= 0xFF;
+  size_t good = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + bad);
+  feed(stream, bad + good);
+  const R200ParserStats& stats = parser.getStats();
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8(R200_CMD_SINGLE_POLL, lastCommand);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(TAG_PAYLOAD, lastPayload, sizeof(TAG_PAYLOAD));
+  TEST_ASSERT_EQUAL_UINT32(2, stats.checksumErrors);
+  TEST_ASSERT_EQUAL_UINT32(bad, stats.bytesDiscarded);
+}
+
+// A false start with a long length field holds the frames behind it back
+// until that many bytes have come in, then hands them all over
+void test_false_start_long_length_delays_frames() {
+  static const uint8_t payload[] = {0x10, 0xAA, 0x01, 0x22, 0x00, 0x40, 0x55};
+  uint8_t stream[256];
+  size_t bad = makeFrame(R200_TYPE_RESPONSE, 0x07, payload, sizeof(payload), stream);
+  stream[bad - 2] ^= 0xFF;
+  size_t good = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + bad);
+  feed(stream, bad + good);
+  TEST_ASSERT_EQUAL_INT(0, framesSeen);
+  for (int i = 0; i < 3; i++) feed(stream + bad, good);
+  TEST_ASSERT_EQUAL_INT(4, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(TAG_PAYLOAD, lastPayload, sizeof(TAG_PAYLOAD));
+  TEST_ASSERT_EQUAL_UINT32(bad, parser.getStats().bytesDiscarded);
+}
+
+void test_oversized_length_is_framing_error() {
+  static const uint8_t header[] = {R200_FRAME_HEADER, R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, 0x01, 0x00};
+  uint8_t frame[64];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), frame);
+  feed(header, sizeof(header));
+  TEST_ASSERT_EQUAL_UINT32(1, parser.getStats().framingErrors);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(header), parser.getStats().bytesDiscarded);
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+}
+
+void test_bad_type_is_framing_error() {
+  static const uint8_t junk[] = {R200_FRAME_HEADER, 0x03};
+  uint8_t frame[64];
+  size_t n = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), frame);
+  feed(junk, sizeof(junk));
+  feed(frame, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_UINT32(1, parser.getStats().framingErrors);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(junk), parser.getStats().bytesDiscarded);
+}
+
+void test_missing_end_byte_is_framing_error() {
+  uint8_t stream[128];
+  size_t bad = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream);
+  stream[bad - 1] = 0x00;
+  size_t n = bad + makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + bad);
+  feed(stream, n);
+  TEST_ASSERT_EQUAL_INT(1, framesSeen);
+  TEST_ASSERT_EQUAL_UINT32(1, parser.getStats().framingErrors);
+  TEST_ASSERT_EQUAL_UINT32(0, parser.getStats().checksumErrors);
+  TEST_ASSERT_EQUAL_UINT32(bad, parser.getStats().bytesDiscarded);
+}
+
+// A frame cut short (dropped bytes on the UART) swallows the start of the
+// next one; the error is only seen further in, and the replay has to find the
+// next frame's header among the bytes already consumed
+void test_truncated_frame_replayed() {
+  uint8_t stream[128];
+  size_t cut = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream) - 6;
+  size_t good = makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, TAG_PAYLOAD, sizeof(TAG_PAYLOAD), stream + cut);
+  size_t after = makeFrame(R200_TYPE_RESPONSE, 0x03, TAG_PAYLOAD, 2, stream + cut + good);
+  feed(stream, cut + good + after);
+  const R200ParserStats& stats = parser.getStats();
+  TEST_ASSERT_EQUAL_INT(2, framesSeen);
+  TEST_ASSERT_EQUAL_HEX8(0x03, lastCommand);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.frames);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.checksumErrors + stats.framingErrors);
+  TEST_ASSERT_EQUAL_UINT32(cut, stats.bytesDiscarded);
+}
+
+// Every byte is either part of a delivered frame or counted as discarded,
+// whatever mix of errors the stream holds
+void test_discarded_accounting() {
+  static const uint8_t payload[] = {0xAA, 0x02, 0x22, 0x00, 0x11, 0xAA};
+  uint8_t stream[512];
+  size_t n = 0;
+  size_t delivered = 0;
+  uint32_t seed = 12345;
+  for (int round = 0; round < 12; round++) {
+    seed = seed * 1103515245u + 12345u;
+    size_t start = n;
+    n += makeFrame(R200_TYPE_NOTICE, R200_CMD_SINGLE_POLL, payload, sizeof(payload), stream + n);
+    switch ((seed >> 16) % 4) {
+      case 0: delivered += n - start; break;
+      case 1: stream[n - 2] ^= 0x5A; break;  // checksum
+      case 2: stream[n - 1] = 0xAA; break;   // end byte
+      case 3: stream[n++] = 0x42; delivered += n - 1 - start; break;  // trailing noise
+    }
+  }
+  // Clean tail, so nothing is left half-parsed
+  size_t tail = makeFrame(R200_TYPE_RESPONSE, 0x03, nullptr, 0, stream + n);
+  n += tail;
+  delivered += tail;
+  feed(stream, n);
+  const R200ParserStats& stats = parser.getStats();
+  TEST_ASSERT_EQUAL_UINT32(n, stats.bytesDiscarded + delivered);
+  TEST_ASSERT_EQUAL_UINT32(framesSeen, stats.frames);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_whole_frame);
+  RUN_TEST(test_empty_payload);
+  RUN_TEST(test_split_frames);
+  RUN_TEST(test_back_to_back_frames);
+  RUN_TEST(test_leading_noise_discarded);
+  RUN_TEST(test_bad_checksum_then_valid_frame);
+  RUN_TEST(test_header_byte_inside_payload);
+  RUN_TEST(test_false_start_inside_corrupt_payload);
+  RUN_TEST(test_false_start_long_length_delays_frames);
+  RUN_TEST(test_oversized_length_is_framing_error);
+  RUN_TEST(test_bad_type_is_framing_error);
+  RUN_TEST(test_missing_end_byte_is_framing_error);
+  RUN_TEST(test_truncated_frame_replayed);
+  RUN_TEST(test_discarded_accounting);
+  return UNITY_END();
+}